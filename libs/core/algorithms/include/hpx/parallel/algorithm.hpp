@@ -19,11 +19,13 @@
 #include <hpx/parallel/algorithms/all_any_none.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/count.hpp>
+#include <hpx/parallel/algorithms/counting_sort.hpp>
 #include <hpx/parallel/algorithms/equal.hpp>
 #include <hpx/parallel/algorithms/fill.hpp>
 #include <hpx/parallel/algorithms/find.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/algorithms/generate.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
 #include <hpx/parallel/algorithms/includes.hpp>
 #include <hpx/parallel/algorithms/is_heap.hpp>
 #include <hpx/parallel/algorithms/is_partitioned.hpp>
@@ -38,6 +40,7 @@
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 #include <hpx/parallel/algorithms/partial_sort_copy.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
 #include <hpx/parallel/algorithms/remove.hpp>
 #include <hpx/parallel/algorithms/remove_copy.hpp>
 #include <hpx/parallel/algorithms/replace.hpp>
@@ -0,0 +1,314 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/counting_sort.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order of
+    /// the integral keys returned by the projection. The order of elements
+    /// with equal keys is preserved. The keys are not compared but counted,
+    /// the elements are moved to the positions following from the counts of
+    /// all smaller keys.
+    ///
+    /// \note   Complexity: O(N + K), where N = std::distance(first, last)
+    ///                     and K is the number of distinct values between the
+    ///                     smallest and the largest key, if K < N. Otherwise
+    ///                     the elements are sorted using \a radix_sort.
+    ///
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type has to be
+    ///                     default constructible and move assignable.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity. The
+    ///                     projection has to return an integral value (other
+    ///                     than bool).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     its key.
+    ///
+    /// \returns  The \a counting_sort algorithm returns nothing.
+    ///
+    template <typename RandomIt, typename Proj>
+    void counting_sort(RandomIt first, RandomIt last, Proj&& proj);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order of
+    /// the integral keys returned by the projection. The order of elements
+    /// with equal keys is preserved. The keys are not compared but counted,
+    /// the elements are moved to the positions following from the counts of
+    /// all smaller keys.
+    ///
+    /// \note   Complexity: O(N + K), where N = std::distance(first, last)
+    ///                     and K is the number of distinct values between the
+    ///                     smallest and the largest key, if K < N. Otherwise
+    ///                     the elements are sorted using \a radix_sort.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type has to be
+    ///                     default constructible and move assignable.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity. The
+    ///                     projection has to return an integral value (other
+    ///                     than bool).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     its key.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// The parallel versions count the keys of each task, compute the
+    /// positions of the elements of all tasks from the counts and move the
+    /// elements to their destination. A temporary buffer holding N elements
+    /// is allocated.
+    ///
+    /// \returns  The \a counting_sort algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns nothing
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    typename parallel::util::detail::algorithm_result<ExPolicy>::type
+    counting_sort(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Proj&& proj);
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/counting_sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/type_support/void_guard.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // counting_sort
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        static constexpr std::size_t counting_sort_limit_per_task = 1 << 16;
+
+        template <typename RandomIt>
+        struct counting_sort
+          : public detail::algorithm<counting_sort<RandomIt>, RandomIt>
+        {
+            counting_sort()
+              : counting_sort::algorithm("counting_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Sent, typename Proj>
+            static RandomIt sequential(
+                ExPolicy, RandomIt first, Sent last, Proj&& proj)
+            {
+                auto last_iter = detail::advance_to_sentinel(first, last);
+
+                // a single task does not use the executor
+                parallel_counting_sort(hpx::execution::sequenced_executor{},
+                    first, last_iter, proj, 1, counting_sort_limit_per_task);
+                return last_iter;
+            }
+
+            template <typename ExPolicy, typename Sent, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(
+                ExPolicy&& policy, RandomIt first, Sent last_s, Proj&& proj)
+            {
+                auto last = detail::advance_to_sentinel(first, last_s);
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+                try
+                {
+                    std::size_t const count = last - first;
+
+                    // figure out the chunk size to use
+                    std::size_t const cores =
+                        execution::processing_units_count(
+                            policy.parameters(), policy.executor());
+
+                    std::size_t max_chunks =
+                        execution::maximal_number_of_chunks(
+                            policy.parameters(), policy.executor(), cores,
+                            count);
+
+                    std::size_t chunk_size = execution::get_chunk_size(
+                        policy.parameters(), policy.executor(),
+                        [](std::size_t) { return 0; }, cores, count);
+
+                    util::detail::adjust_chunk_size_and_max_chunks(
+                        cores, count, max_chunks, chunk_size);
+
+                    // we should not get smaller than our
+                    // counting_sort_limit_per_task
+                    chunk_size =
+                        (std::max)(chunk_size, counting_sort_limit_per_task);
+
+                    if (count < 2 * chunk_size)
+                    {
+                        parallel_counting_sort(policy.executor(), first, last,
+                            proj, 1, chunk_size);
+                        return algorithm_result::get(HPX_MOVE(last));
+                    }
+
+                    // exceptions are handled as for the synchronous version
+                    // of the caller's policy, for task policies the returned
+                    // future will hold them
+                    using non_task_policy_type = std::decay_t<decltype(
+                        policy(hpx::execution::non_task))>;
+
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [exec = policy.executor(), first, last,
+                            proj = HPX_FORWARD(Proj, proj), cores,
+                            chunk_size]() mutable -> RandomIt {
+                            try
+                            {
+                                parallel_counting_sort(exec, first, last, proj,
+                                    cores, chunk_size);
+                            }
+                            catch (...)
+                            {
+                                handle_exception<non_task_policy_type,
+                                    RandomIt>::call();
+                            }
+                            return last;
+                        }));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::experimental::counting_sort
+    inline constexpr struct counting_sort_t final
+      : hpx::detail::tag_parallel_algorithm<counting_sort_t>
+    {
+        // clang-format off
+        template <typename RandomIt,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandomIt> &&
+                parallel::traits::is_projected<Proj, RandomIt>::value &&
+                parallel::v1::detail::is_counting_sortable_v<
+                    hpx::util::invoke_result_t<Proj&,
+                        typename std::iterator_traits<RandomIt>::reference>>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(hpx::experimental::counting_sort_t,
+            RandomIt first, RandomIt last, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            hpx::parallel::v1::detail::counting_sort<RandomIt>().call(
+                hpx::execution::seq, first, last, HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                parallel::traits::is_projected<Proj, RandomIt>::value &&
+                parallel::v1::detail::is_counting_sortable_v<
+                    hpx::util::invoke_result_t<Proj&,
+                        typename std::iterator_traits<RandomIt>::reference>>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(hpx::experimental::counting_sort_t,
+            ExPolicy&& policy, RandomIt first, RandomIt last,
+            Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                typename hpx::parallel::util::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::v1::detail::counting_sort<RandomIt>().call(
+                       HPX_FORWARD(ExPolicy, policy), first, last,
+                       HPX_FORWARD(Proj, proj));
+        }
+    } counting_sort{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,182 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr bool is_counting_sortable_v =
+        std::is_integral_v<std::decay_t<T>> &&
+        !std::is_same_v<std::decay_t<T>, bool>;
+
+    // Maps the encoded keys in [lowest, lowest + num_keys) onto the bins
+    // [0, num_keys).
+    template <typename T>
+    class key_bins
+    {
+    public:
+        using traits = radix_key_traits<T>;
+        using key_type = typename traits::key_type;
+
+        key_bins(key_type lowest, std::size_t num_keys) noexcept
+          : lowest_(lowest)
+          , num_keys_(num_keys)
+        {
+        }
+
+        std::size_t size() const noexcept
+        {
+            return num_keys_;
+        }
+
+        std::size_t operator()(T value) const noexcept
+        {
+            return static_cast<std::size_t>(traits::encode(value) - lowest_);
+        }
+
+    private:
+        key_type lowest_;
+        std::size_t num_keys_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stable counting sort for elements with integral keys (as returned by
+    // the projection) using up to num_tasks concurrent tasks on the given
+    // executor. Ranges smaller than min_task_size elements are handled by a
+    // single task.
+    //
+    // Each task counts the keys of its chunk of the input, the position of
+    // the elements of a key for each task is the prefix sum over all
+    // counters. The elements are moved to a temporary buffer and back
+    // afterwards. Inputs whose keys span more distinct values than there
+    // are elements are sorted using the radix sort instead, this keeps the
+    // counters smaller than the input.
+    template <typename Exec, typename Iter, typename Proj>
+    void parallel_counting_sort(Exec&& exec, Iter first, Iter last,
+        Proj&& proj, std::size_t num_tasks, std::size_t min_task_size)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using projected_type = std::decay_t<hpx::util::invoke_result_t<Proj&,
+            typename std::iterator_traits<Iter>::reference>>;
+        using bins_type = key_bins<projected_type>;
+        using traits = typename bins_type::traits;
+        using key_type = typename bins_type::key_type;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < 2)
+        {
+            return;
+        }
+
+        min_task_size = (std::max)(min_task_size, std::size_t(1));
+        num_tasks = (std::max)(std::size_t(1),
+            (std::min)(num_tasks, count / min_task_size));
+
+        auto chunk_first = [&](std::size_t t) {
+            return t * count / num_tasks;
+        };
+
+        // determine the range of the keys
+        std::vector<std::pair<key_type, key_type>> ranges(num_tasks);
+        histogram_run(exec, num_tasks, [&](std::size_t t) {
+            Iter it = first + chunk_first(t);
+            key_type lowest = traits::encode(HPX_INVOKE(proj, *it));
+            key_type highest = lowest;
+            for (std::size_t i = chunk_first(t) + 1; i != chunk_first(t + 1);
+                 ++i)
+            {
+                key_type const key = traits::encode(HPX_INVOKE(proj, *++it));
+                lowest = (std::min)(lowest, key);
+                highest = (std::max)(highest, key);
+            }
+            ranges[t] = std::make_pair(lowest, highest);
+        });
+
+        key_type lowest = ranges[0].first;
+        key_type highest = ranges[0].second;
+        for (auto const& r : ranges)
+        {
+            lowest = (std::min)(lowest, r.first);
+            highest = (std::max)(highest, r.second);
+        }
+
+        if (lowest == highest)
+        {
+            return;    // all keys are equal
+        }
+
+        if (std::uint64_t(key_type(highest - lowest)) >= count)
+        {
+            parallel_radix_sort(HPX_FORWARD(Exec, exec), first, last,
+                HPX_FORWARD(Proj, proj), num_tasks, min_task_size);
+            return;
+        }
+
+        bins_type const bins(lowest, std::size_t(highest - lowest) + 1);
+        std::size_t const stride = bins.size() + 1;
+
+        // the counters of all tasks together should not outnumber the
+        // elements
+        num_tasks = (std::max)(
+            std::size_t(1), (std::min)(num_tasks, count / stride));
+
+        std::vector<std::size_t> counts(num_tasks * stride);
+        histogram_run(exec, num_tasks, [&](std::size_t t) {
+            sequential_histogram(hpx::execution::seq, first + chunk_first(t),
+                chunk_first(t + 1) - chunk_first(t), &counts[t * stride],
+                bins, proj);
+        });
+
+        // the elements of key k of task t follow the ones of all smaller
+        // keys and the ones of key k of all previous tasks
+        std::size_t sum = 0;
+        for (std::size_t k = 0; k != bins.size(); ++k)
+        {
+            for (std::size_t t = 0; t != num_tasks; ++t)
+            {
+                std::size_t& c = counts[t * stride + k];
+                std::size_t const size = c;
+                c = sum;
+                sum += size;
+            }
+        }
+
+        std::unique_ptr<value_type[]> buffer(new value_type[count]);
+        histogram_run(exec, num_tasks, [&](std::size_t t) {
+            std::size_t* offsets = &counts[t * stride];
+            Iter it = first + chunk_first(t);
+            for (std::size_t i = chunk_first(t); i != chunk_first(t + 1);
+                 ++i, ++it)
+            {
+                buffer[offsets[bins(HPX_INVOKE(proj, *it))]++] = HPX_MOVE(*it);
+            }
+        });
+
+        histogram_run(exec, num_tasks, [&](std::size_t t) {
+            std::move(buffer.get() + chunk_first(t),
+                buffer.get() + chunk_first(t + 1), first + chunk_first(t));
+        });
+    }
+}}}}    // namespace hpx::parallel::v1::detail
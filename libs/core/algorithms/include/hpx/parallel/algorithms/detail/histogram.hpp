@@ -0,0 +1,310 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The per-task counters are merged pairwise, the merge steps run
+    // concurrently only if the histograms are at least this large.
+    inline constexpr std::size_t histogram_parallel_merge_limit = 1 << 12;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // uniform_bins<T> maps a value onto one of num_bins bins of equal width
+    // covering [lower, upper). Values outside of this interval (including
+    // NaNs) are mapped onto num_bins.
+    template <typename T>
+    class uniform_bins
+    {
+        static_assert(std::is_arithmetic_v<T>,
+            "uniform bins require an arithmetic value type");
+
+        // integral values are mapped using exact unsigned arithmetic
+        using offset_type = std::uint64_t;
+
+    public:
+        uniform_bins(std::size_t num_bins, T lower, T upper) noexcept
+          : num_bins_(num_bins)
+          , lower_(lower)
+          , upper_(num_bins != 0 ? upper : lower)
+        {
+            if (!(lower_ < upper_))
+            {
+                return;    // all values are outside of the bins
+            }
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                scale_ = static_cast<T>(num_bins_) / (upper_ - lower_);
+            }
+            else
+            {
+                width_ = offset_type(upper_) - offset_type(lower_);
+                exact_ = width_ <=
+                    (std::numeric_limits<offset_type>::max)() / num_bins_;
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return num_bins_;
+        }
+
+        T lower() const noexcept
+        {
+            return lower_;
+        }
+
+        T upper() const noexcept
+        {
+            return upper_;
+        }
+
+        T scale() const noexcept
+        {
+            return scale_;
+        }
+
+        // Maps (value - lower) * scale of a floating point value inside of
+        // [lower, upper) onto its bin. Positions which were rounded up to
+        // num_bins belong to the last bin.
+        std::size_t position_to_bin(T position) const noexcept
+        {
+            auto const bin = static_cast<std::size_t>(position);
+            return bin < num_bins_ ? bin : num_bins_ - 1;
+        }
+
+        std::size_t operator()(T value) const noexcept
+        {
+            if (!(lower_ <= value && value < upper_))
+            {
+                return num_bins_;
+            }
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                return position_to_bin((value - lower_) * scale_);
+            }
+            else
+            {
+                offset_type const offset =
+                    offset_type(value) - offset_type(lower_);
+                if (exact_)
+                {
+                    return static_cast<std::size_t>(
+                        offset * num_bins_ / width_);
+                }
+
+                auto const bin = static_cast<std::size_t>(
+                    static_cast<long double>(offset) * num_bins_ / width_);
+                return bin < num_bins_ ? bin : num_bins_ - 1;
+            }
+        }
+
+    private:
+        std::size_t num_bins_;
+        T lower_;
+        T upper_;
+        T scale_ = T(0);
+        offset_type width_ = 0;
+        bool exact_ = true;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // edge_bins<Iter> maps a value onto the bin [edges[i], edges[i + 1]) it
+    // falls into, the edges have to be sorted in ascending order. Values
+    // outside of [edges[0], edges[N - 1]) are mapped onto N - 1.
+    template <typename Iter>
+    class edge_bins
+    {
+    public:
+        edge_bins(Iter first, Iter last)
+          : first_(first)
+          , last_(last)
+          , num_bins_(0)
+        {
+            auto const num_edges = std::distance(first, last);
+            if (num_edges > 1)
+            {
+                num_bins_ = static_cast<std::size_t>(num_edges - 1);
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return num_bins_;
+        }
+
+        template <typename T>
+        std::size_t operator()(T const& value) const
+        {
+            Iter const it = std::upper_bound(first_, last_, value);
+            if (it == first_ || it == last_)
+            {
+                return num_bins_;
+            }
+            return static_cast<std::size_t>(std::distance(first_, it)) - 1;
+        }
+
+    private:
+        Iter first_;
+        Iter last_;
+        std::size_t num_bins_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Count the elements of [first, first + count) in counts[bins(value)],
+    // counts has bins.size() + 1 entries. The last entry collects the values
+    // outside of all bins, which avoids a branch per element.
+    template <typename Iter, typename Bins, typename Proj>
+    constexpr Iter sequential_histogram_helper(Iter first, std::size_t count,
+        std::size_t* counts, Bins const& bins, Proj&& proj)
+    {
+        for (/* */; count != 0; (void) --count, ++first)
+        {
+            ++counts[bins(HPX_INVOKE(proj, *first))];
+        }
+        return first;
+    }
+
+    struct sequential_histogram_t
+      : hpx::functional::detail::tag_fallback<sequential_histogram_t>
+    {
+    private:
+        template <typename ExPolicy, typename Iter, typename Bins,
+            typename Proj>
+        friend constexpr Iter tag_fallback_invoke(sequential_histogram_t,
+            ExPolicy&&, Iter first, std::size_t count, std::size_t* counts,
+            Bins const& bins, Proj&& proj)
+        {
+            return sequential_histogram_helper(
+                first, count, counts, bins, HPX_FORWARD(Proj, proj));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_histogram_t sequential_histogram =
+        sequential_histogram_t{};
+#else
+    template <typename ExPolicy, typename Iter, typename Bins, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter sequential_histogram(
+        ExPolicy&& policy, Iter first, std::size_t count, std::size_t* counts,
+        Bins const& bins, Proj&& proj)
+    {
+        return sequential_histogram_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            count, counts, bins, HPX_FORWARD(Proj, proj));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f(i) for all i in [0, count) on the given executor and wait for
+    // all invocations to finish.
+    template <typename Exec, typename F>
+    void histogram_run(Exec&& exec, std::size_t count, F&& f)
+    {
+        if (count == 1)
+        {
+            f(std::size_t(0));
+            return;
+        }
+
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(count));
+
+        hpx::wait_all(execution::bulk_async_execute(exec, f, shape));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Builds the histogram of [first, first + count) using up to num_tasks
+    // concurrent tasks on the executor of the given policy. Each task counts
+    // a chunk of at least min_task_size elements into private counters. The
+    // counters are merged pairwise along a binary tree, which takes
+    // log2(num_tasks) merge steps of concurrently running tasks.
+    //
+    // The returned vector holds bins.size() + 1 counts, the last one is the
+    // number of values outside of all bins.
+    template <typename ExPolicy, typename Iter, typename Bins, typename Proj>
+    std::vector<std::size_t> parallel_histogram(ExPolicy& policy, Iter first,
+        std::size_t count, Bins const& bins, Proj& proj, std::size_t num_tasks,
+        std::size_t min_task_size)
+    {
+        std::size_t const stride = bins.size() + 1;
+
+        // the private counters of all tasks together should not outnumber
+        // the elements
+        min_task_size = (std::max)(min_task_size, std::size_t(1));
+        num_tasks = (std::max)(std::size_t(1),
+            (std::min)({num_tasks, count / min_task_size, count / stride}));
+
+        auto chunk_size = [&](std::size_t t) {
+            return (t + 1) * count / num_tasks - t * count / num_tasks;
+        };
+
+        std::vector<Iter> starts;
+        starts.reserve(num_tasks);
+        for (std::size_t t = 0; t != num_tasks; ++t)
+        {
+            starts.push_back(first);
+            std::advance(first, chunk_size(t));
+        }
+
+        std::vector<std::size_t> counts(num_tasks * stride);
+        histogram_run(policy.executor(), num_tasks, [&](std::size_t t) {
+            sequential_histogram(policy, starts[t], chunk_size(t),
+                &counts[t * stride], bins, proj);
+        });
+
+        for (std::size_t step = 1; step < num_tasks; step *= 2)
+        {
+            // the counters of task t + step are added to the ones of task t
+            // for t = 0, 2 * step, 4 * step, ...
+            auto merge = [&](std::size_t i) {
+                std::size_t* to = &counts[2 * step * i * stride];
+                std::size_t const* from = to + step * stride;
+                for (std::size_t b = 0; b != stride; ++b)
+                {
+                    to[b] += from[b];
+                }
+            };
+
+            std::size_t const merges =
+                (num_tasks - step + 2 * step - 1) / (2 * step);
+            if (stride < histogram_parallel_merge_limit)
+            {
+                for (std::size_t i = 0; i != merges; ++i)
+                {
+                    merge(i);
+                }
+            }
+            else
+            {
+                histogram_run(policy.executor(), merges, merge);
+            }
+        }
+
+        counts.resize(stride);
+        return counts;
+    }
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,998 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The algorithm implemented here follows the in-place parallel super scalar
+// samplesort (IPS4o) described in: M. Axtmann, S. Witt, D. Ferizovic,
+// P. Sanders, "In-Place Parallel Super Scalar Samplesort (IPS4o)", ESA 2017.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each partitioning step distributes the elements into up to
+    // 2^in_place_sample_sort_log_buckets buckets (twice as many if equality
+    // buckets are used).
+    inline constexpr std::size_t in_place_sample_sort_log_buckets = 8;
+
+    // Elements are moved between buckets in blocks of about this many bytes.
+    inline constexpr std::size_t in_place_sample_sort_block_bytes = 2048;
+
+    // Inputs fitting into this many bytes (about half of a typical L1 data
+    // cache) are sorted directly.
+    inline constexpr std::size_t in_place_sample_sort_base_case_bytes =
+        16 * 1024;
+
+    // Number of elements classified at once to increase instruction level
+    // parallelism.
+    inline constexpr std::size_t in_place_sample_sort_unroll = 8;
+
+    // Beyond this recursion depth the remaining ranges are sorted using
+    // std::sort, this guarantees termination for adversarial inputs.
+    inline constexpr int in_place_sample_sort_max_depth = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // In-place parallel samplesort.
+    //
+    // Every partitioning step draws a sample to select splitters, which are
+    // organized as an implicit search tree to classify elements without
+    // branches. The elements are then distributed into buckets in four
+    // phases:
+    //
+    //  1. Local classification: each task classifies its stripe of the input
+    //     into per-bucket buffers of one block. Full buffers are flushed back
+    //     to the front of the stripe.
+    //  2. Empty block movement: the full blocks of every bucket's block
+    //     aligned region are moved to the front of the region.
+    //  3. Block permutation: the tasks move blocks to their bucket's region,
+    //     each bucket keeps a read and write pointer protected by a spinlock.
+    //  4. Cleanup: the elements which were left in the per-task buffers and
+    //     the parts of blocks overlapping a bucket boundary are moved to
+    //     their final positions.
+    //
+    // Only the per-task buffers (one block per bucket) are required as
+    // additional memory. The buckets are sorted recursively, large buckets in
+    // parallel, small ones sequentially.
+    template <typename Exec, typename Iter, typename Comp>
+    class in_place_sample_sorter
+    {
+    public:
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        static constexpr std::size_t block_size = (std::max)(std::size_t(1),
+            in_place_sample_sort_block_bytes / sizeof(value_type));
+
+        static constexpr std::size_t base_case_size = (std::max)(
+            std::size_t(16),
+            in_place_sample_sort_base_case_bytes / sizeof(value_type));
+
+        in_place_sample_sorter(Exec& exec, Comp& comp) noexcept
+          : exec_(exec)
+          , comp_(comp)
+        {
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Uninitialized storage for up to block_size elements.
+        class block_buffer
+        {
+        public:
+            block_buffer() = default;
+
+            block_buffer(block_buffer const&) = delete;
+            block_buffer& operator=(block_buffer const&) = delete;
+
+            ~block_buffer()
+            {
+                clear();
+            }
+
+            value_type* data() noexcept
+            {
+                return std::launder(reinterpret_cast<value_type*>(storage_));
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            bool full() const noexcept
+            {
+                return size_ == block_size;
+            }
+
+            void push_back(value_type&& val)
+            {
+                HPX_ASSERT(size_ < block_size);
+                ::new (static_cast<void*>(data() + size_))
+                    value_type(HPX_MOVE(val));
+                ++size_;
+            }
+
+            // move the first count elements from the given position into
+            // the (empty) buffer
+            template <typename It>
+            void read_from(It it, std::size_t count)
+            {
+                HPX_ASSERT(size_ == 0 && count <= block_size);
+                for (std::size_t i = 0; i != count; ++i, ++it)
+                {
+                    push_back(HPX_MOVE(*it));
+                }
+            }
+
+            // move all elements to the given position and empty the buffer
+            void write_to(Iter it)
+            {
+                std::move(data(), data() + size_, it);
+                clear();
+            }
+
+            void clear() noexcept
+            {
+                value_type* p = data();
+                for (std::size_t i = 0; i != size_; ++i)
+                {
+                    p[i].~value_type();
+                }
+                size_ = 0;
+            }
+
+        private:
+            std::size_t size_ = 0;
+            alignas(value_type) unsigned char storage_[sizeof(value_type) *
+                block_size];
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The buffers used by a single task during one partitioning step.
+        // Sequential recursion reuses the buffers of the parent step.
+        struct local_data
+        {
+            void reset(std::size_t num_buckets)
+            {
+                if (num_buckets > capacity)
+                {
+                    buffers.reset(new block_buffer[num_buckets]);
+                    capacity = num_buckets;
+                }
+                bucket_sizes.assign(num_buckets, 0);
+                first_empty_block = 0;
+            }
+
+            std::unique_ptr<block_buffer[]> buffers;
+            std::size_t capacity = 0;
+            std::vector<std::size_t> bucket_sizes;
+            block_buffer swap[2];
+
+            // block index (relative to the start of the input) of the first
+            // block in this task's stripe which was not written during the
+            // local classification
+            std::size_t first_empty_block = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The splitters organized as an implicit binary search tree.
+        // classify() returns the number of splitters not greater than the
+        // classified element. If equality buckets are used, elements equal to
+        // a splitter are put into a separate bucket preceding the bucket of
+        // the elements greater than the splitter. Equality buckets don't need
+        // to be sorted any further.
+        class classifier
+        {
+        public:
+            explicit classifier(Comp& comp) noexcept
+              : comp_(comp)
+            {
+            }
+
+            std::size_t num_buckets() const noexcept
+            {
+                return num_buckets_ << (use_equal_buckets_ ? 1 : 0);
+            }
+
+            bool use_equal_buckets() const noexcept
+            {
+                return use_equal_buckets_;
+            }
+
+            bool is_equal_bucket(std::size_t bucket) const noexcept
+            {
+                return use_equal_buckets_ && (bucket % 2) == 1;
+            }
+
+            // Select the splitters from the sorted sample.
+            void build(Iter sample_first, std::size_t sample_size,
+                std::size_t log_buckets)
+            {
+                std::size_t const num_buckets = std::size_t(1) << log_buckets;
+                std::size_t const step = sample_size / num_buckets;
+                HPX_ASSERT(step != 0);
+
+                std::vector<value_type> splitters;
+                splitters.reserve(num_buckets);
+                for (std::size_t i = 1; i != num_buckets; ++i)
+                {
+                    value_type const& candidate = sample_first[i * step - 1];
+                    if (splitters.empty() || comp_(splitters.back(), candidate))
+                    {
+                        splitters.push_back(candidate);
+                    }
+                    else
+                    {
+                        use_equal_buckets_ = true;
+                    }
+                }
+
+                // duplicate splitters reduce the number of required buckets
+                log_buckets_ = 1;
+                while ((std::size_t(1) << log_buckets_) <= splitters.size())
+                {
+                    ++log_buckets_;
+                }
+                num_buckets_ = std::size_t(1) << log_buckets_;
+
+                // pad with the largest splitter, the corresponding buckets
+                // will stay empty
+                while (splitters.size() != num_buckets_ - 1)
+                {
+                    splitters.push_back(splitters.back());
+                }
+
+                tree_.clear();
+                tree_.reserve(num_buckets_);
+                tree_.push_back(splitters[0]);    // unused
+                for (std::size_t level = 0; level != log_buckets_; ++level)
+                {
+                    std::size_t const first_node = std::size_t(1) << level;
+                    std::size_t const shift = log_buckets_ - level - 1;
+                    for (std::size_t node = 0; node != first_node; ++node)
+                    {
+                        tree_.push_back(
+                            splitters[((2 * node + 1) << shift) - 1]);
+                    }
+                }
+
+                // lower_bounds_[b] is the splitter preceding bucket b
+                if (use_equal_buckets_)
+                {
+                    lower_bounds_.clear();
+                    lower_bounds_.reserve(num_buckets_);
+                    lower_bounds_.push_back(splitters[0]);    // unused
+                    for (std::size_t i = 0; i != num_buckets_ - 1; ++i)
+                    {
+                        lower_bounds_.push_back(splitters[i]);
+                    }
+                }
+            }
+
+            template <typename T>
+            std::size_t classify(T const& val) const
+            {
+                std::size_t b = 1;
+                for (std::size_t l = 0; l != log_buckets_; ++l)
+                {
+                    b = 2 * b + !comp_(val, tree_[b]);
+                }
+                b -= num_buckets_;
+
+                if (use_equal_buckets_)
+                {
+                    b = 2 * b -
+                        std::size_t((b != 0) & !comp_(lower_bounds_[b], val));
+                }
+                return b;
+            }
+
+            // Classify all elements in [first, last), calling f(bucket, it)
+            // for each element. f is invoked only after all elements of a
+            // batch have been classified.
+            template <typename F>
+            void classify(Iter first, Iter last, F&& f) const
+            {
+                constexpr std::size_t unroll = in_place_sample_sort_unroll;
+
+                std::size_t b[unroll];
+                while (std::size_t(last - first) >= unroll)
+                {
+                    for (std::size_t i = 0; i != unroll; ++i)
+                    {
+                        b[i] = 1;
+                    }
+                    for (std::size_t l = 0; l != log_buckets_; ++l)
+                    {
+                        for (std::size_t i = 0; i != unroll; ++i)
+                        {
+                            b[i] = 2 * b[i] + !comp_(first[i], tree_[b[i]]);
+                        }
+                    }
+                    for (std::size_t i = 0; i != unroll; ++i)
+                    {
+                        b[i] -= num_buckets_;
+                    }
+                    if (use_equal_buckets_)
+                    {
+                        for (std::size_t i = 0; i != unroll; ++i)
+                        {
+                            b[i] = 2 * b[i] -
+                                std::size_t((b[i] != 0) &
+                                    !comp_(lower_bounds_[b[i]], first[i]));
+                        }
+                    }
+                    for (std::size_t i = 0; i != unroll; ++i)
+                    {
+                        f(b[i], first + i);
+                    }
+                    first += unroll;
+                }
+
+                for (/**/; first != last; ++first)
+                {
+                    f(classify(*first), first);
+                }
+            }
+
+        private:
+            Comp& comp_;
+            std::vector<value_type> tree_;
+            std::vector<value_type> lower_bounds_;
+            std::size_t log_buckets_ = 0;
+            std::size_t num_buckets_ = 0;
+            bool use_equal_buckets_ = false;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct bucket_pointers
+        {
+            hpx::spinlock mtx;
+
+            // block index of the next block to write
+            difference_type write = 0;
+
+            // block index of the last unprocessed block, the unprocessed
+            // blocks are [write, read]
+            difference_type read = 0;
+        };
+
+        // The state shared by all tasks of a partitioning step.
+        struct step_data
+        {
+            step_data(Comp& comp, Iter first, std::size_t size,
+                std::size_t num_tasks)
+              : first(first)
+              , size(size)
+              , num_blocks(size / block_size)
+              , num_tasks(num_tasks)
+              , cls(comp)
+            {
+            }
+
+            Iter first;
+            std::size_t size;
+
+            // number of complete blocks in the input
+            std::size_t num_blocks;
+            std::size_t num_tasks;
+
+            classifier cls;
+            std::vector<local_data*> locals;
+
+            // element offset of the first element of each bucket
+            std::vector<std::size_t> bucket_start;
+
+            // block index of the first block of each bucket's region
+            std::vector<std::size_t> region_start;
+
+            std::unique_ptr<util::cache_line_data<bucket_pointers>[]> bptrs;
+
+            // elements of a bucket's last block overlapping the next bucket
+            std::unique_ptr<block_buffer[]> spill;
+
+            // the last (incomplete) block of the input can't be written in
+            // place
+            block_buffer overflow;
+            std::size_t overflow_bucket = std::size_t(-1);
+
+            std::size_t stripe_first_block(std::size_t task) const noexcept
+            {
+                return task * num_blocks / num_tasks;
+            }
+
+            // A block written during the local classification is 'full', all
+            // other blocks are empty.
+            bool is_full_block(std::size_t block) const noexcept
+            {
+                std::size_t task = (block * num_tasks) / (num_blocks + 1);
+                while (task + 1 < num_tasks &&
+                    stripe_first_block(task + 1) <= block)
+                {
+                    ++task;
+                }
+                while (stripe_first_block(task) > block)
+                {
+                    --task;
+                }
+                return block < locals[task]->first_empty_block;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke f(i) for all i in [0, count) and wait for all invocations
+        // to finish.
+        template <typename F>
+        void run(std::size_t count, F&& f)
+        {
+            if (count == 1)
+            {
+                f(std::size_t(0));
+                return;
+            }
+
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(count));
+
+            hpx::wait_all(execution::bulk_async_execute(exec_, f, shape));
+        }
+
+        template <typename F>
+        void run_sequential(std::size_t count, F&& f)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(i);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        static std::uint64_t next_random(std::uint64_t& state) noexcept
+        {
+            // xorshift64*
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 2685821657736338717ull;
+        }
+
+        static std::size_t log2_floor(std::size_t n) noexcept
+        {
+            std::size_t log = 0;
+            while (n >>= 1)
+            {
+                ++log;
+            }
+            return log;
+        }
+
+        // Select the splitters from a random sample which is moved to the
+        // front of the input.
+        void sample(step_data& data, std::uint64_t seed)
+        {
+            std::size_t const n = data.size;
+            std::size_t const log_n = log2_floor(n);
+
+            std::size_t log_buckets = (std::min)(
+                in_place_sample_sort_log_buckets,
+                log2_floor(n / base_case_size));
+            log_buckets = (std::max)(log_buckets, std::size_t(1));
+
+            std::size_t const num_buckets = std::size_t(1) << log_buckets;
+            std::size_t const oversampling =
+                (std::max)(std::size_t(1), log_n / 5);
+            std::size_t const sample_size =
+                (std::min)(oversampling * num_buckets, n / 2);
+
+            std::uint64_t state = seed | 1;
+            for (std::size_t i = 0; i != sample_size; ++i)
+            {
+                std::size_t const j = i + next_random(state) % (n - i);
+#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                std::ranges::iter_swap(data.first + i, data.first + j);
+#else
+                std::iter_swap(data.first + i, data.first + j);
+#endif
+            }
+
+            std::sort(data.first, data.first + sample_size, comp_);
+            data.cls.build(data.first, sample_size, log_buckets);
+        }
+
+        // Phase 1: classify the elements of the stripe of the given task.
+        void local_classification(step_data& data, std::size_t task)
+        {
+            local_data& local = *data.locals[task];
+
+            std::size_t const first_block = data.stripe_first_block(task);
+            Iter const begin = data.first + first_block * block_size;
+            Iter const end = task + 1 == data.num_tasks ?
+                data.first + data.size :
+                data.first +
+                    data.stripe_first_block(task + 1) * block_size;
+
+            Iter write = begin;
+            data.cls.classify(begin, end, [&](std::size_t bucket, Iter it) {
+                block_buffer& buffer = local.buffers[bucket];
+                if (buffer.full())
+                {
+                    // all elements before the current one have been read
+                    buffer.write_to(write);
+                    write += block_size;
+                }
+                buffer.push_back(HPX_MOVE(*it));
+                ++local.bucket_sizes[bucket];
+            });
+
+            local.first_empty_block =
+                first_block + std::size_t(write - begin) / block_size;
+        }
+
+        // Compute the bucket boundaries from the per-task bucket sizes.
+        void compute_bucket_boundaries(step_data& data)
+        {
+            std::size_t const num_buckets = data.cls.num_buckets();
+
+            data.bucket_start.assign(num_buckets + 1, 0);
+            data.region_start.assign(num_buckets + 1, 0);
+
+            std::size_t sum = 0;
+            for (std::size_t b = 0; b != num_buckets; ++b)
+            {
+                data.bucket_start[b] = sum;
+                data.region_start[b] = (sum + block_size - 1) / block_size;
+                for (local_data* local : data.locals)
+                {
+                    sum += local->bucket_sizes[b];
+                }
+            }
+            HPX_ASSERT(sum == data.size);
+
+            data.bucket_start[num_buckets] = sum;
+            data.region_start[num_buckets] =
+                (sum + block_size - 1) / block_size;
+
+            data.bptrs.reset(
+                new util::cache_line_data<bucket_pointers>[num_buckets]);
+            data.spill.reset(new block_buffer[num_buckets]);
+        }
+
+        // Phase 2: move the full blocks of each region to its front and
+        // initialize the bucket pointers.
+        void move_empty_blocks(step_data& data, std::size_t bucket)
+        {
+            std::size_t const region_first = data.region_start[bucket];
+            std::size_t const region_last = (std::min)(
+                data.region_start[bucket + 1], data.num_blocks);
+
+            std::size_t full_blocks = 0;
+            for (std::size_t i = region_first; i < region_last; ++i)
+            {
+                if (data.is_full_block(i))
+                {
+                    ++full_blocks;
+                }
+            }
+
+            if (full_blocks != 0)
+            {
+                std::size_t i = region_first;
+                std::size_t j = region_last - 1;
+                while (i < j)
+                {
+                    if (data.is_full_block(i))
+                    {
+                        ++i;
+                    }
+                    else if (!data.is_full_block(j))
+                    {
+                        --j;
+                    }
+                    else
+                    {
+                        Iter const from = data.first + j * block_size;
+                        std::move(from, from + block_size,
+                            data.first + i * block_size);
+                        ++i;
+                        --j;
+                    }
+                }
+            }
+
+            bucket_pointers& bptr = data.bptrs[bucket].data_;
+            bptr.write = difference_type(region_first);
+            bptr.read = difference_type(region_first + full_blocks) - 1;
+        }
+
+        // take an unprocessed block from the given bucket
+        bool pop_block(step_data& data, std::size_t bucket, block_buffer& dest)
+        {
+            bucket_pointers& bptr = data.bptrs[bucket].data_;
+
+            std::lock_guard<hpx::spinlock> l(bptr.mtx);
+            if (bptr.read < bptr.write)
+            {
+                return false;
+            }
+
+            dest.read_from(
+                data.first + std::size_t(bptr.read) * block_size, block_size);
+            --bptr.read;
+            return true;
+        }
+
+        // Phase 3: move blocks into their bucket's region. Each task starts
+        // with a different bucket to reduce contention.
+        void permute_blocks(step_data& data, std::size_t task)
+        {
+            local_data& local = *data.locals[task];
+            std::size_t const num_buckets = data.cls.num_buckets();
+            std::size_t const first_bucket =
+                task * num_buckets / data.num_tasks;
+
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                std::size_t const bucket = (first_bucket + i) % num_buckets;
+                while (pop_block(data, bucket, local.swap[0]))
+                {
+                    std::size_t current = 0;
+                    while (true)
+                    {
+                        // all elements of a block belong to the same bucket
+                        std::size_t const dest =
+                            data.cls.classify(local.swap[current].data()[0]);
+                        bucket_pointers& bptr = data.bptrs[dest].data_;
+
+                        std::lock_guard<hpx::spinlock> l(bptr.mtx);
+                        std::size_t const slot = std::size_t(bptr.write++);
+                        Iter const pos = data.first + slot * block_size;
+
+                        if (difference_type(slot) <= bptr.read)
+                        {
+                            // the slot holds an unprocessed block, swap it
+                            // with the one we are holding
+                            local.swap[1 - current].read_from(pos, block_size);
+                            local.swap[current].write_to(pos);
+                            current = 1 - current;
+                        }
+                        else
+                        {
+                            if ((slot + 1) * block_size > data.size)
+                            {
+                                // the slot extends beyond the end of the
+                                // input
+                                HPX_ASSERT(data.overflow.size() == 0);
+                                data.overflow.read_from(
+                                    local.swap[current].data(), block_size);
+                                local.swap[current].clear();
+                                data.overflow_bucket = dest;
+                            }
+                            else
+                            {
+                                local.swap[current].write_to(pos);
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        // the position of an element written during the block permutation
+        value_type& written_element(step_data& data, std::size_t bucket,
+            std::size_t pos) noexcept
+        {
+            std::size_t const overflow_first = data.num_blocks * block_size;
+            if (bucket == data.overflow_bucket && pos >= overflow_first)
+            {
+                return data.overflow.data()[pos - overflow_first];
+            }
+            return data.first[pos];
+        }
+
+        // Phase 4a: save the elements of the last written block of a bucket
+        // which overlap the next bucket, move the elements of the overflow
+        // block into place.
+        void save_spill(step_data& data, std::size_t bucket)
+        {
+            std::size_t const end = data.bucket_start[bucket + 1];
+            std::size_t const written_first =
+                data.region_start[bucket] * block_size;
+            std::size_t const written_last = std::size_t(
+                data.bptrs[bucket].data_.write) * block_size;
+
+            if (written_first == written_last)
+            {
+                return;
+            }
+
+            if (bucket == data.overflow_bucket)
+            {
+                std::size_t const overflow_first =
+                    data.num_blocks * block_size;
+                for (std::size_t pos = overflow_first; pos < end; ++pos)
+                {
+                    data.first[pos] = HPX_MOVE(
+                        data.overflow.data()[pos - overflow_first]);
+                }
+            }
+
+            block_buffer& spill = data.spill[bucket];
+            for (std::size_t pos = (std::max)(end, written_first);
+                 pos < written_last; ++pos)
+            {
+                spill.push_back(
+                    HPX_MOVE(written_element(data, bucket, pos)));
+            }
+        }
+
+        // Phase 4b: fill the gaps at the beginning and at the end of each
+        // bucket with the elements left in the buffers.
+        void fill_bucket(step_data& data, std::size_t bucket)
+        {
+            std::size_t const first = data.bucket_start[bucket];
+            std::size_t const last = data.bucket_start[bucket + 1];
+            std::size_t const written_first =
+                data.region_start[bucket] * block_size;
+            std::size_t const written_last = std::size_t(
+                data.bptrs[bucket].data_.write) * block_size;
+
+            // the gaps to fill
+            std::size_t gap_first[2] = {first, written_last};
+            std::size_t gap_last[2] = {last, last};
+            if (written_first != written_last)
+            {
+                gap_last[0] = written_first;
+            }
+            else
+            {
+                gap_first[1] = last;
+            }
+
+            std::size_t gap = 0;
+            std::size_t pos = gap_first[0];
+            auto write = [&](block_buffer& buffer) {
+                value_type* p = buffer.data();
+                for (std::size_t i = 0; i != buffer.size(); ++i)
+                {
+                    while (pos >= gap_last[gap])
+                    {
+                        ++gap;
+                        HPX_ASSERT(gap != 2);
+                        pos = gap_first[gap];
+                    }
+                    data.first[pos++] = HPX_MOVE(p[i]);
+                }
+                buffer.clear();
+            };
+
+            write(data.spill[bucket]);
+            for (local_data* local : data.locals)
+            {
+                write(local->buffers[bucket]);
+            }
+        }
+
+        // Partition the input of the given step into buckets, the phases are
+        // executed concurrently by the step's tasks.
+        void partition(step_data& data, local_data* locals)
+        {
+            sample(data,
+                std::uint64_t(data.size) * 0x9e3779b97f4a7c15ull +
+                    data.num_tasks);
+
+            std::size_t const num_buckets = data.cls.num_buckets();
+            std::size_t const num_tasks = data.num_tasks;
+
+            data.locals.resize(num_tasks);
+            for (std::size_t t = 0; t != num_tasks; ++t)
+            {
+                locals[t].reset(num_buckets);
+                data.locals[t] = &locals[t];
+            }
+
+            run(num_tasks,
+                [&](std::size_t t) { local_classification(data, t); });
+
+            compute_bucket_boundaries(data);
+
+            auto for_each_bucket = [&](auto&& f) {
+                run(num_tasks, [&](std::size_t t) {
+                    std::size_t const last = (t + 1) * num_buckets / num_tasks;
+                    for (std::size_t b = t * num_buckets / num_tasks; b != last;
+                         ++b)
+                    {
+                        f(b);
+                    }
+                });
+            };
+
+            for_each_bucket([&](std::size_t b) { move_empty_blocks(data, b); });
+
+            run(num_tasks, [&](std::size_t t) { permute_blocks(data, t); });
+
+            for_each_bucket([&](std::size_t b) { save_spill(data, b); });
+            for_each_bucket([&](std::size_t b) { fill_bucket(data, b); });
+        }
+
+        // Partition using the given number of tasks, returns the bucket
+        // boundaries and which of the buckets are equality buckets.
+        void partition(Iter first, std::size_t n, std::size_t num_tasks,
+            local_data* locals, std::vector<std::size_t>& bucket_start,
+            std::vector<bool>& equal_bucket)
+        {
+            step_data data(comp_, first, n, num_tasks);
+            partition(data, locals);
+
+            bucket_start = HPX_MOVE(data.bucket_start);
+            equal_bucket.resize(data.cls.num_buckets());
+            for (std::size_t b = 0; b != equal_bucket.size(); ++b)
+            {
+                equal_bucket[b] = data.cls.is_equal_bucket(b);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void sort_sequential(
+            Iter first, Iter last, local_data& local, int depth)
+        {
+            std::size_t const n = std::size_t(last - first);
+            if (n <= 2 * base_case_size ||
+                depth > in_place_sample_sort_max_depth)
+            {
+                std::sort(first, last, comp_);
+                return;
+            }
+
+            // the buffers are reused by the recursive calls
+            std::vector<std::size_t> bucket_start;
+            std::vector<bool> equal_bucket;
+            partition(first, n, 1, &local, bucket_start, equal_bucket);
+
+            for (std::size_t b = 0; b != equal_bucket.size(); ++b)
+            {
+                if (!equal_bucket[b] &&
+                    bucket_start[b + 1] - bucket_start[b] > 1)
+                {
+                    sort_sequential(first + bucket_start[b],
+                        first + bucket_start[b + 1], local, depth + 1);
+                }
+            }
+        }
+
+    public:
+        void sort_parallel(Iter first, Iter last, std::size_t num_tasks,
+            std::size_t min_task_size, int depth = 0)
+        {
+            std::size_t const n = std::size_t(last - first);
+
+            // every task should classify at least a couple of blocks
+            num_tasks = (std::min)(num_tasks, n / (8 * block_size) + 1);
+            min_task_size = (std::max)(min_task_size, 2 * base_case_size);
+
+            if (num_tasks < 2 || n < 2 * min_task_size ||
+                depth > in_place_sample_sort_max_depth)
+            {
+                local_data local;
+                sort_sequential(first, last, local, depth);
+                return;
+            }
+
+            std::vector<std::size_t> bucket_start;
+            std::vector<bool> equal_bucket;
+            {
+                std::unique_ptr<local_data[]> locals(
+                    new local_data[num_tasks]);
+                partition(first, n, num_tasks, locals.get(), bucket_start,
+                    equal_bucket);
+            }
+
+            // Group the buckets into jobs, large buckets are sorted in
+            // parallel by a proportional share of the tasks.
+            struct job
+            {
+                std::size_t first_bucket;
+                std::size_t last_bucket;
+                std::size_t num_tasks;
+            };
+
+            std::size_t const num_buckets = bucket_start.size() - 1;
+            std::size_t const grain =
+                (std::max)(n / (2 * num_tasks), min_task_size);
+
+            std::vector<job> jobs;
+            std::size_t b = 0;
+            while (b != num_buckets)
+            {
+                std::size_t const size = bucket_start[b + 1] - bucket_start[b];
+                if (size >= 2 * grain)
+                {
+                    jobs.push_back(job{b, b + 1,
+                        (std::max)(std::size_t(1), size * num_tasks / n)});
+                    ++b;
+                    continue;
+                }
+
+                std::size_t const first_bucket = b;
+                while (b != num_buckets &&
+                    bucket_start[b + 1] - bucket_start[first_bucket] < grain &&
+                    bucket_start[b + 1] - bucket_start[b] < 2 * grain)
+                {
+                    ++b;
+                }
+                if (b == first_bucket)
+                {
+                    ++b;
+                }
+                jobs.push_back(job{first_bucket, b, 1});
+            }
+
+            run(jobs.size(), [&](std::size_t i) {
+                job const& j = jobs[i];
+                if (j.num_tasks > 1)
+                {
+                    sort_parallel(first + bucket_start[j.first_bucket],
+                        first + bucket_start[j.last_bucket], j.num_tasks,
+                        min_task_size, depth + 1);
+                    return;
+                }
+
+                local_data local;
+                for (std::size_t b = j.first_bucket; b != j.last_bucket; ++b)
+                {
+                    if (!equal_bucket[b] &&
+                        bucket_start[b + 1] - bucket_start[b] > 1)
+                    {
+                        sort_sequential(first + bucket_start[b],
+                            first + bucket_start[b + 1], local, depth + 1);
+                    }
+                }
+            });
+        }
+
+    private:
+        Exec& exec_;
+        Comp& comp_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort [first, last) using up to num_tasks concurrent tasks on the given
+    // executor. Ranges smaller than min_task_size elements are sorted
+    // sequentially.
+    template <typename Exec, typename Iter, typename Comp>
+    void in_place_sample_sort(Exec&& exec, Iter first, Iter last, Comp&& comp,
+        std::size_t num_tasks, std::size_t min_task_size)
+    {
+        using exec_type = std::decay_t<Exec>;
+        using comp_type = std::decay_t<Comp>;
+
+        exec_type e = HPX_FORWARD(Exec, exec);
+        comp_type c = HPX_FORWARD(Comp, comp);
+        in_place_sample_sorter<exec_type, Iter, comp_type> sorter(e, c);
+        sorter.sort_parallel(first, last, num_tasks, min_task_size);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,86 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/is_value_proxy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    util::min_max_result<FwdIter> sequential_minmax_element_helper(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        util::min_max_result<FwdIter> result = {it, it};
+
+        if (count == 0 || count == 1)
+            return result;
+
+        using element_type = hpx::traits::proxy_value_t<
+            typename std::iterator_traits<FwdIter>::value_type>;
+
+        element_type min_value = HPX_INVOKE(proj, *it);
+        element_type max_value = min_value;
+        util::loop_n<ExPolicy>(
+            ++it, count - 1, [&](FwdIter const& curr) -> void {
+                element_type curr_value = HPX_INVOKE(proj, *curr);
+                if (HPX_INVOKE(f, curr_value, min_value))
+                {
+                    result.min = curr;
+                    min_value = curr_value;
+                }
+
+                if (!HPX_INVOKE(f, curr_value, max_value))
+                {
+                    result.max = curr;
+                    max_value = HPX_MOVE(curr_value);
+                }
+            });
+
+        return result;
+    }
+
+    struct sequential_minmax_element_t
+      : hpx::functional::detail::tag_fallback<sequential_minmax_element_t>
+    {
+    private:
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        friend util::min_max_result<FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t, ExPolicy&&, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            return sequential_minmax_element_helper<std::decay_t<ExPolicy>>(
+                it, count, f, proj);
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_minmax_element_t sequential_minmax_element =
+        sequential_minmax_element_t{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<FwdIter>
+    sequential_minmax_element(ExPolicy&& policy, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        return sequential_minmax_element_t{}(
+            HPX_FORWARD(ExPolicy, policy), it, count, f, proj);
+    }
+#endif
+
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,571 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/parallel/algorithms/detail/insertion_sort.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The keys are sorted one byte (digit) at a time.
+    inline constexpr std::size_t radix_sort_digit_bits = 8;
+    inline constexpr std::size_t radix_sort_buckets = std::size_t(1)
+        << radix_sort_digit_bits;
+
+    // Ranges smaller than this are sorted using insertion sort.
+    inline constexpr std::size_t radix_sort_insertion_limit = 64;
+
+    // Larger ranges are distributed by their most significant digit first,
+    // this keeps the data of the subsequent LSD passes in the cache.
+    inline constexpr std::size_t radix_sort_msd_limit = 1 << 15;
+
+    // The scatter step collects the elements for each bucket in buffers of
+    // this size before writing them to the destination.
+    inline constexpr std::size_t radix_sort_line_bytes = 64;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_key_traits<T>::encode maps an arithmetic value onto an unsigned
+    // integer such that the order of the integers matches the order of the
+    // values.
+    template <typename T, typename Enable = void>
+    struct radix_key_traits
+    {
+        static constexpr bool is_radix_sortable = false;
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool is_radix_sortable = true;
+
+        using key_type = std::make_unsigned_t<T>;
+
+        static constexpr key_type encode(T value) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // flip the sign bit, negative values are ordered first
+                return static_cast<key_type>(static_cast<key_type>(value) ^
+                    (key_type(1) << (sizeof(T) * CHAR_BIT - 1)));
+            }
+            else
+            {
+                return value;
+            }
+        }
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool is_radix_sortable = true;
+
+        using key_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static key_type encode(T value) noexcept
+        {
+            key_type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+
+            // invert all bits of negative values, flip the sign bit of
+            // positive values. NaNs are ordered before all negative or after
+            // all positive values depending on their sign.
+            constexpr key_type sign_bit = key_type(1)
+                << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign_bit) ? key_type(~bits) :
+                                       key_type(bits | sign_bit);
+        }
+    };
+
+    template <typename T>
+    inline constexpr bool is_radix_sortable_v =
+        radix_key_traits<std::decay_t<T>>::is_radix_sortable;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stable radix sort for elements with arithmetic keys (as returned by
+    // the projection).
+    //
+    // Larger inputs are distributed by the most significant digit in which
+    // the keys differ (MSD) into a temporary buffer. Each task builds a
+    // histogram for its chunk of the input, the bucket offsets of each task
+    // are the prefix sums over all histograms. Afterwards, the buckets are
+    // sorted independently by the remaining digits starting with the least
+    // significant one (LSD), large buckets in parallel. Digits which are
+    // equal for all keys of a range are skipped.
+    //
+    // The distribution passes over the whole input write the elements
+    // through small per-bucket buffers which are flushed one cache line at a
+    // time, this reduces the number of cache lines and TLB entries touched
+    // concurrently. The LSD passes over a single bucket operate in the cache
+    // and scatter the elements directly.
+    template <typename Exec, typename Iter, typename Proj>
+    class radix_sorter
+    {
+    public:
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using buffer_iterator = value_type*;
+
+        using projected_type = std::decay_t<hpx::util::invoke_result_t<Proj&,
+            typename std::iterator_traits<Iter>::reference>>;
+        using traits = radix_key_traits<projected_type>;
+        using key_type = typename traits::key_type;
+
+        static constexpr std::size_t num_digits = sizeof(key_type);
+
+        // buffering the elements pays off only if they can be copied cheaply
+        static constexpr std::size_t line_size =
+            std::is_trivially_copyable_v<value_type> ?
+            (std::max)(
+                std::size_t(1), radix_sort_line_bytes / sizeof(value_type)) :
+            std::size_t(1);
+
+        radix_sorter(Exec& exec, Proj& proj) noexcept
+          : exec_(exec)
+          , proj_(proj)
+        {
+        }
+
+    private:
+        template <typename It>
+        key_type key(It it) const
+        {
+            return traits::encode(HPX_INVOKE(proj_, *it));
+        }
+
+        static constexpr std::size_t digit(key_type key, std::size_t d) noexcept
+        {
+            return static_cast<std::size_t>(
+                       key >> (d * radix_sort_digit_bits)) &
+                (radix_sort_buckets - 1);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke f(i) for all i in [0, count) and wait for all invocations
+        // to finish.
+        template <typename F>
+        void run(std::size_t count, F&& f)
+        {
+            if (count == 1)
+            {
+                f(std::size_t(0));
+                return;
+            }
+
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(count));
+
+            hpx::wait_all(execution::bulk_async_execute(exec_, f, shape));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Move the elements of [first, last) to dest according to digit d,
+        // offsets holds the next position of each bucket in dest.
+        template <typename Src, typename Dest>
+        void scatter(Src first, Src last, Dest dest, std::size_t d,
+            std::size_t* offsets, value_type* lines = nullptr)
+        {
+            if (line_size == 1 || lines == nullptr)
+            {
+                for (/**/; first != last; ++first)
+                {
+                    dest[offsets[digit(key(first), d)]++] = HPX_MOVE(*first);
+                }
+                return;
+            }
+
+            std::size_t fill[radix_sort_buckets] = {};
+            for (/**/; first != last; ++first)
+            {
+                std::size_t const b = digit(key(first), d);
+                value_type* line = lines + b * line_size;
+
+                line[fill[b]] = HPX_MOVE(*first);
+                if (++fill[b] == line_size)
+                {
+                    std::move(line, line + line_size, dest + offsets[b]);
+                    offsets[b] += line_size;
+                    fill[b] = 0;
+                }
+            }
+
+            for (std::size_t b = 0; b != radix_sort_buckets; ++b)
+            {
+                value_type* line = lines + b * line_size;
+                std::move(line, line + fill[b], dest + offsets[b]);
+                offsets[b] += fill[b];
+            }
+        }
+
+        // Allocate the line buffers used by scatter if they are worth it.
+        static std::unique_ptr<value_type[]> make_lines(std::size_t count)
+        {
+            if (line_size == 1 || count < 4 * radix_sort_buckets * line_size)
+            {
+                return nullptr;
+            }
+            return std::unique_ptr<value_type[]>(
+                new value_type[radix_sort_buckets * line_size]);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // LSD radix sort of the elements in [first, first + count), the
+        // elements are initially located at the corresponding positions of
+        // the buffer if in_buffer is true. The sorted elements are stored in
+        // [first, first + count).
+        void sort_sequential(Iter first, buffer_iterator buffer,
+            std::size_t count, bool in_buffer)
+        {
+            if (count < radix_sort_insertion_limit)
+            {
+                if (in_buffer)
+                {
+                    std::move(buffer, buffer + count, first);
+                }
+                insertion_sort(first, first + count,
+                    [this](auto const& lhs, auto const& rhs) {
+                        return traits::encode(HPX_INVOKE(proj_, lhs)) <
+                            traits::encode(HPX_INVOKE(proj_, rhs));
+                    });
+                return;
+            }
+
+            // the histograms don't depend on the order of the elements,
+            // build them for all digits at once
+            std::vector<std::size_t> counts(num_digits * radix_sort_buckets);
+            auto count_digits = [&](auto it) {
+                for (std::size_t i = 0; i != count; ++i, ++it)
+                {
+                    key_type const k = key(it);
+                    for (std::size_t d = 0; d != num_digits; ++d)
+                    {
+                        ++counts[d * radix_sort_buckets + digit(k, d)];
+                    }
+                }
+            };
+
+            if (in_buffer)
+            {
+                count_digits(buffer);
+            }
+            else
+            {
+                count_digits(first);
+            }
+
+            for (std::size_t d = 0; d != num_digits; ++d)
+            {
+                std::size_t* offsets = &counts[d * radix_sort_buckets];
+                if (std::find(offsets, offsets + radix_sort_buckets, count) !=
+                    offsets + radix_sort_buckets)
+                {
+                    continue;    // all keys have the same digit
+                }
+
+                std::size_t sum = 0;
+                for (std::size_t b = 0; b != radix_sort_buckets; ++b)
+                {
+                    std::size_t const size = offsets[b];
+                    offsets[b] = sum;
+                    sum += size;
+                }
+
+                if (in_buffer)
+                {
+                    scatter(buffer, buffer + count, first, d, offsets);
+                }
+                else
+                {
+                    scatter(first, first + count, buffer, d, offsets);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                std::move(buffer, buffer + count, first);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // One parallel distribution pass by digit d. Returns the start of
+        // every bucket in dest.
+        template <typename Src, typename Dest>
+        std::vector<std::size_t> parallel_pass(Src src, Dest dest,
+            std::size_t count, std::size_t d, std::size_t num_tasks)
+        {
+            auto chunk_first = [&](std::size_t t) {
+                return t * count / num_tasks;
+            };
+
+            // per-task histograms
+            std::vector<std::size_t> counts(num_tasks * radix_sort_buckets);
+            run(num_tasks, [&](std::size_t t) {
+                std::size_t* hist = &counts[t * radix_sort_buckets];
+                Src it = src + chunk_first(t);
+                for (std::size_t i = chunk_first(t); i != chunk_first(t + 1);
+                     ++i, ++it)
+                {
+                    ++hist[digit(key(it), d)];
+                }
+            });
+
+            // the elements of bucket b of task t follow the ones of all
+            // smaller buckets and the ones of bucket b of all previous tasks
+            std::vector<std::size_t> bucket_start(radix_sort_buckets + 1);
+            std::size_t sum = 0;
+            for (std::size_t b = 0; b != radix_sort_buckets; ++b)
+            {
+                bucket_start[b] = sum;
+                for (std::size_t t = 0; t != num_tasks; ++t)
+                {
+                    std::size_t& c = counts[t * radix_sort_buckets + b];
+                    std::size_t const size = c;
+                    c = sum;
+                    sum += size;
+                }
+            }
+            bucket_start[radix_sort_buckets] = sum;
+
+            run(num_tasks, [&](std::size_t t) {
+                std::unique_ptr<value_type[]> lines =
+                    make_lines(chunk_first(t + 1) - chunk_first(t));
+                scatter(src + chunk_first(t), src + chunk_first(t + 1), dest,
+                    d, &counts[t * radix_sort_buckets], lines.get());
+            });
+
+            return bucket_start;
+        }
+
+        // Move [src, src + count) to dest using the given number of tasks.
+        template <typename Src, typename Dest>
+        void parallel_move(
+            Src src, Dest dest, std::size_t count, std::size_t num_tasks)
+        {
+            run(num_tasks, [&](std::size_t t) {
+                std::size_t const first = t * count / num_tasks;
+                std::size_t const last = (t + 1) * count / num_tasks;
+                std::move(src + first, src + last, dest + first);
+            });
+        }
+
+        // Returns a key having those bits set in which at least two keys of
+        // the range differ.
+        template <typename It>
+        key_type differing_bits(It it, std::size_t count, std::size_t num_tasks)
+        {
+            std::vector<key_type> diffs(num_tasks, key_type(0));
+            key_type const first_key = key(it);
+            run(num_tasks, [&](std::size_t t) {
+                key_type diff = 0;
+                It cur = it + t * count / num_tasks;
+                for (std::size_t i = t * count / num_tasks;
+                     i != (t + 1) * count / num_tasks; ++i, ++cur)
+                {
+                    diff |= key(cur) ^ first_key;
+                }
+                diffs[t] = diff;
+            });
+
+            key_type diff = 0;
+            for (key_type d : diffs)
+            {
+                diff |= d;
+            }
+            return diff;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Parallel LSD radix sort over the digits in which the keys differ.
+        void sort_parallel_lsd(Iter first, buffer_iterator buffer,
+            std::size_t count, bool in_buffer, std::size_t num_tasks)
+        {
+            key_type const diff = in_buffer ?
+                differing_bits(buffer, count, num_tasks) :
+                differing_bits(first, count, num_tasks);
+
+            for (std::size_t d = 0; d != num_digits; ++d)
+            {
+                if (digit(diff, d) == 0)
+                {
+                    continue;
+                }
+
+                if (in_buffer)
+                {
+                    parallel_pass(buffer, first, count, d, num_tasks);
+                }
+                else
+                {
+                    parallel_pass(first, buffer, count, d, num_tasks);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                parallel_move(buffer, first, count, num_tasks);
+            }
+        }
+
+    public:
+        void sort(Iter first, Iter last, std::size_t num_tasks,
+            std::size_t min_task_size)
+        {
+            std::size_t const count = std::size_t(last - first);
+            if (count < 2)
+            {
+                return;
+            }
+
+            if (count < radix_sort_insertion_limit)
+            {
+                sort_sequential(first, nullptr, count, false);
+                return;
+            }
+
+            std::unique_ptr<value_type[]> buffer(new value_type[count]);
+
+            if (count < radix_sort_msd_limit)
+            {
+                sort_sequential(first, buffer.get(), count, false);
+                return;
+            }
+
+            min_task_size =
+                (std::max)(min_task_size, radix_sort_insertion_limit);
+            num_tasks = (std::max)(std::size_t(1),
+                (std::min)(num_tasks, count / min_task_size));
+
+            key_type const diff = differing_bits(first, count, num_tasks);
+            if (diff == 0)
+            {
+                return;    // all keys are equal
+            }
+
+            std::size_t top = num_digits - 1;
+            while (digit(diff, top) == 0)
+            {
+                --top;
+            }
+
+            // distribute by the most significant differing digit
+            std::vector<std::size_t> bucket_start =
+                parallel_pass(first, buffer.get(), count, top, num_tasks);
+
+            // Sort the buckets by the remaining digits. Group small buckets
+            // into jobs, large buckets are sorted in parallel by a
+            // proportional share of the tasks.
+            struct job
+            {
+                std::size_t first_bucket;
+                std::size_t last_bucket;
+                std::size_t num_tasks;
+            };
+
+            std::size_t const grain =
+                (std::max)(count / (2 * num_tasks), min_task_size);
+
+            std::vector<job> jobs;
+            std::size_t b = 0;
+            while (b != radix_sort_buckets)
+            {
+                std::size_t const size = bucket_start[b + 1] - bucket_start[b];
+                if (size >= 2 * grain)
+                {
+                    jobs.push_back(job{b, b + 1,
+                        (std::max)(std::size_t(1), size * num_tasks / count)});
+                    ++b;
+                    continue;
+                }
+
+                std::size_t const first_bucket = b;
+                while (b != radix_sort_buckets &&
+                    bucket_start[b + 1] - bucket_start[first_bucket] < grain &&
+                    bucket_start[b + 1] - bucket_start[b] < 2 * grain)
+                {
+                    ++b;
+                }
+                if (b == first_bucket)
+                {
+                    ++b;
+                }
+                jobs.push_back(job{first_bucket, b, 1});
+            }
+
+            run(jobs.size(), [&](std::size_t i) {
+                job const& j = jobs[i];
+                for (std::size_t b = j.first_bucket; b != j.last_bucket; ++b)
+                {
+                    std::size_t const start = bucket_start[b];
+                    std::size_t const size = bucket_start[b + 1] - start;
+                    if (size == 0)
+                    {
+                        continue;
+                    }
+
+                    if (j.num_tasks > 1)
+                    {
+                        sort_parallel_lsd(first + start, buffer.get() + start,
+                            size, true, j.num_tasks);
+                    }
+                    else
+                    {
+                        sort_sequential(
+                            first + start, buffer.get() + start, size, true);
+                    }
+                }
+            });
+        }
+
+    private:
+        Exec& exec_;
+        Proj& proj_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort [first, last) by the arithmetic keys returned by proj using up to
+    // num_tasks concurrent tasks on the given executor. Ranges smaller than
+    // min_task_size elements are sorted sequentially.
+    template <typename Exec, typename Iter, typename Proj>
+    void parallel_radix_sort(Exec&& exec, Iter first, Iter last, Proj&& proj,
+        std::size_t num_tasks, std::size_t min_task_size)
+    {
+        using exec_type = std::decay_t<Exec>;
+        using proj_type = std::decay_t<Proj>;
+
+        exec_type e = HPX_FORWARD(Exec, exec);
+        proj_type p = HPX_FORWARD(Proj, proj);
+        radix_sorter<exec_type, Iter, proj_type> sorter(e, p);
+        sorter.sort(first, last, num_tasks, min_task_size);
+    }
+}}}}    // namespace hpx::parallel::v1::detail
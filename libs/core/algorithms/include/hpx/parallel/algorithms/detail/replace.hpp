@@ -0,0 +1,64 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Sent, typename T1, typename T2,
+        typename Proj>
+    constexpr Iter sequential_replace_helper(Iter first, Sent last,
+        T1 const& old_value, T2 const& new_value, Proj&& proj)
+    {
+        for (/* */; first != last; ++first)
+        {
+            if (HPX_INVOKE(proj, *first) == old_value)
+            {
+                *first = new_value;
+            }
+        }
+        return first;
+    }
+
+    struct sequential_replace_t
+      : hpx::functional::detail::tag_fallback<sequential_replace_t>
+    {
+    private:
+        template <typename ExPolicy, typename Iter, typename Sent, typename T1,
+            typename T2, typename Proj>
+        friend constexpr Iter tag_fallback_invoke(sequential_replace_t,
+            ExPolicy&&, Iter first, Sent last, T1 const& old_value,
+            T2 const& new_value, Proj&& proj)
+        {
+            return sequential_replace_helper(first, last, old_value, new_value,
+                HPX_FORWARD(Proj, proj));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_replace_t sequential_replace =
+        sequential_replace_t{};
+#else
+    template <typename ExPolicy, typename Iter, typename Sent, typename T1,
+        typename T2, typename Proj>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter sequential_replace(ExPolicy&& policy,
+        Iter first, Sent last, T1 const& old_value, T2 const& new_value,
+        Proj&& proj)
+    {
+        return sequential_replace_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            last, old_value, new_value, HPX_FORWARD(Proj, proj));
+    }
+#endif
+
+}}}}    // namespace hpx::parallel::v1::detail
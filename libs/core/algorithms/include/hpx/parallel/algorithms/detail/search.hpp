@@ -12,7 +12,9 @@
 #include <hpx/config.hpp>
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
 #include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
@@ -30,6 +32,63 @@
 namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
     /// \cond NOINTERNAL
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FwdIter, typename Sent, typename FwdIter2,
+        typename Sent2, typename Pred, typename Proj1, typename Proj2>
+    constexpr FwdIter sequential_search_helper(FwdIter first, Sent last,
+        FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        for (;; ++first)
+        {
+            FwdIter it1 = first;
+            for (FwdIter2 it2 = s_first;; ++it1, ++it2)
+            {
+                if (it2 == s_last)
+                    return first;
+                if (it1 == last)
+                    return it1;
+                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *it1),
+                        HPX_INVOKE(proj2, *it2)))
+                    break;
+            }
+        }
+    }
+
+    struct sequential_search_t
+      : hpx::functional::detail::tag_fallback<sequential_search_t>
+    {
+    private:
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename FwdIter2, typename Sent2, typename Pred, typename Proj1,
+            typename Proj2>
+        friend constexpr FwdIter tag_fallback_invoke(sequential_search_t,
+            ExPolicy&&, FwdIter first, Sent last, FwdIter2 s_first,
+            Sent2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
+        {
+            return sequential_search_helper(first, last, s_first, s_last,
+                HPX_FORWARD(Pred, op), HPX_FORWARD(Proj1, proj1),
+                HPX_FORWARD(Proj2, proj2));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_search_t sequential_search =
+        sequential_search_t{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Sent,
+        typename FwdIter2, typename Sent2, typename Pred, typename Proj1,
+        typename Proj2>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter sequential_search(
+        ExPolicy&& policy, FwdIter first, Sent last, FwdIter2 s_first,
+        Sent2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_search_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            last, s_first, s_last, HPX_FORWARD(Pred, op),
+            HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     // search
     template <typename FwdIter, typename Sent>
@@ -42,24 +101,13 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
         template <typename ExPolicy, typename FwdIter2, typename Sent2,
             typename Pred, typename Proj1, typename Proj2>
-        static FwdIter sequential(ExPolicy, FwdIter first, Sent last,
+        static FwdIter sequential(ExPolicy&& policy, FwdIter first, Sent last,
             FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
-            for (;; ++first)
-            {
-                FwdIter it1 = first;
-                for (FwdIter2 it2 = s_first;; ++it1, ++it2)
-                {
-                    if (it2 == s_last)
-                        return first;
-                    if (it1 == last)
-                        return it1;
-                    if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *it1),
-                            HPX_INVOKE(proj2, *it2)))
-                        break;
-                }
-            }
+            return sequential_search(HPX_FORWARD(ExPolicy, policy), first,
+                last, s_first, s_last, HPX_FORWARD(Pred, op),
+                HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
         }
 
         template <typename ExPolicy, typename FwdIter2, typename Sent2,
@@ -102,43 +150,6 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
             hpx::parallel::util::cancellation_token<difference_type> tok(count);
 
-            auto f1 = [diff, count, tok, s_first, op = HPX_FORWARD(Pred, op),
-                          proj1 = HPX_FORWARD(Proj1, proj1),
-                          proj2 = HPX_FORWARD(Proj2, proj2)](FwdIter it,
-                          std::size_t part_size,
-                          std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                hpx::parallel::util::loop_idx_n<std::decay_t<ExPolicy>>(
-                    base_idx, it, part_size, tok,
-                    [diff, count, s_first, &tok, &curr,
-                        op = HPX_FORWARD(Pred, op),
-                        proj1 = HPX_FORWARD(Proj1, proj1),
-                        proj2 = HPX_FORWARD(Proj2, proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
-                                HPX_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0;
-                                 local_count != diff && len != count;
-                                 ++local_count, ++len, ++mid)
-                            {
-                                if (!HPX_INVOKE(op, HPX_INVOKE(proj1, *mid),
-                                        HPX_INVOKE(proj2, *++needle)))
-                                    break;
-                            }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
-            };
-
             auto f2 = [=](auto&& data) mutable -> FwdIter {
                 // make sure iterators embedded in function object that is
                 // attached to futures are invalidated
@@ -152,8 +163,75 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
                 return HPX_MOVE(first);
             };
-            return partitioner::call_with_index(HPX_FORWARD(ExPolicy, policy),
-                first, count - (diff - 1), 1, HPX_MOVE(f1), HPX_MOVE(f2));
+
+            if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+            {
+                // every partition looks for the matches starting inside of it
+                // using the (vectorized) sequential algorithm
+                auto f1 = [policy, diff, tok, s_first, s_last, op, proj1,
+                              proj2](FwdIter it, std::size_t part_size,
+                              std::size_t base_idx) mutable -> void {
+                    if (tok.was_cancelled(base_idx))
+                        return;
+
+                    FwdIter part_end = std::next(it, part_size + diff - 1);
+                    FwdIter found = sequential_search(policy, it, part_end,
+                        s_first, s_last, op, proj1, proj2);
+                    if (found != part_end)
+                    {
+                        tok.cancel(base_idx + std::distance(it, found));
+                    }
+                };
+
+                return partitioner::call_with_index(
+                    HPX_FORWARD(ExPolicy, policy), first, count - (diff - 1),
+                    1, HPX_MOVE(f1), HPX_MOVE(f2));
+            }
+            else
+            {
+                auto f1 = [diff, count, tok, s_first,
+                              op = HPX_FORWARD(Pred, op),
+                              proj1 = HPX_FORWARD(Proj1, proj1),
+                              proj2 = HPX_FORWARD(Proj2, proj2)](FwdIter it,
+                              std::size_t part_size,
+                              std::size_t base_idx) mutable -> void {
+                    FwdIter curr = it;
+
+                    hpx::parallel::util::loop_idx_n<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_size, tok,
+                        [diff, count, s_first, &tok, &curr,
+                            op = HPX_FORWARD(Pred, op),
+                            proj1 = HPX_FORWARD(Proj1, proj1),
+                            proj2 = HPX_FORWARD(Proj2, proj2)](
+                            reference v, std::size_t i) -> void {
+                            ++curr;
+                            if (HPX_INVOKE(op, HPX_INVOKE(proj1, v),
+                                    HPX_INVOKE(proj2, *s_first)))
+                            {
+                                difference_type local_count = 1;
+                                FwdIter2 needle = s_first;
+                                FwdIter mid = curr;
+
+                                for (difference_type len = 0;
+                                     local_count != diff && len != count;
+                                     ++local_count, ++len, ++mid)
+                                {
+                                    if (!HPX_INVOKE(op,
+                                            HPX_INVOKE(proj1, *mid),
+                                            HPX_INVOKE(proj2, *++needle)))
+                                        break;
+                                }
+
+                                if (local_count == diff)
+                                    tok.cancel(i);
+                            }
+                        });
+                };
+
+                return partitioner::call_with_index(
+                    HPX_FORWARD(ExPolicy, policy), first, count - (diff - 1),
+                    1, HPX_MOVE(f1), HPX_MOVE(f2));
+            }
         }
     };
 
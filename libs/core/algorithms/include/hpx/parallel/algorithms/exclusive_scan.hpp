@@ -399,43 +399,37 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 3
-                // steps. The first calculates the scan results for each
-                // partition. The second accumulates the result from left to
-                // right to be used by the third step--which operates on the
-                // same partitions the first step operated on.
+                // The scan is performed in a single pass over the input. The
+                // first step reduces each partition, the second combines the
+                // results of the preceding partitions, and the third step
+                // scans the partition given the accumulated result of all
+                // partitions to its left.
 
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
 
                 auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
                               T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-                    *dst++ = val;
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
-                        [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    auto iters = part_begin.get_iterator_tuple();
+                    sequential_exclusive_scan_n(get<0>(iters), part_size,
+                        get<1>(iters), HPX_MOVE(val), op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter2>, T>::
+                    util::in_out_result<FwdIter1, FwdIter2>, T, void,
+                    util::scan_partitioner_single_pass_tag>::
                     call(
                         HPX_FORWARD(ExPolicy, policy),
                         make_zip_iterator(first, dest), count, init,
-                        // step 1 performs first part of scan algorithm
-                        [op, last](zip_iterator part_begin,
+                        // step 1 reduces each partition
+                        [op](zip_iterator part_begin,
                             std::size_t part_size) -> T {
-                            T part_init = get<0>(*part_begin++);
-
-                            auto iters = part_begin.get_iterator_tuple();
-                            if (get<0>(iters) != last)
+                            FwdIter1 it =
+                                get<0>(part_begin.get_iterator_tuple());
+                            T part_init = *it;
+                            while (--part_size != 0)
                             {
-                                return sequential_exclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
+                                part_init = HPX_INVOKE(op, part_init, *++it);
                             }
                             return part_init;
                         },
@@ -0,0 +1,561 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements in the range [first, last) falling into each of
+    /// \a num_bins bins of equal width covering [lower, upper) and assigns
+    /// the counts to the range [dest, dest + num_bins). The bin i holds the
+    /// values in [lower + i * w, lower + (i + 1) * w) with
+    /// w = (upper - lower) / num_bins. Values outside of [lower, upper)
+    /// (including NaNs) are not counted.
+    ///
+    /// \note   Complexity: O(N + num_bins), where
+    ///                     N = std::distance(first, last).
+    ///
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam T           The type of the bounds of the bins (deduced). The
+    ///                     values are mapped onto the bins using the common
+    ///                     type of the projected values and \a T, which has
+    ///                     to be arithmetic.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin.
+    /// \param upper        The upper bound of the last bin, it is not part of
+    ///                     the last bin.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// \returns  The \a histogram algorithm returns \a OutIter. The
+    ///           \a histogram algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last count
+    ///           written.
+    ///
+    template <typename FwdIter, typename Sent, typename OutIter, typename T,
+        typename Proj = parallel::util::projection_identity>
+    OutIter histogram(FwdIter first, Sent last, OutIter dest,
+        std::size_t num_bins, T lower, T upper, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements in the range [first, last) falling into each of
+    /// \a num_bins bins of equal width covering [lower, upper) and assigns
+    /// the counts to the range [dest, dest + num_bins). The bin i holds the
+    /// values in [lower + i * w, lower + (i + 1) * w) with
+    /// w = (upper - lower) / num_bins. Values outside of [lower, upper)
+    /// (including NaNs) are not counted.
+    ///
+    /// \note   Complexity: O(N + P * num_bins), where
+    ///                     N = std::distance(first, last) and P is the
+    ///                     number of tasks used.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam T           The type of the bounds of the bins (deduced). The
+    ///                     values are mapped onto the bins using the common
+    ///                     type of the projected values and \a T, which has
+    ///                     to be arithmetic.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin.
+    /// \param upper        The upper bound of the last bin, it is not part of
+    ///                     the last bin.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// The parallel versions count the elements of each task into private
+    /// counters which are merged pairwise afterwards. The number of tasks
+    /// is limited such that all private counters together do not outnumber
+    /// the elements. The data parallel policies compute the bins of floating
+    /// point values using vector instructions.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<OutIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a OutIter
+    ///           otherwise.
+    ///           The \a histogram algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           count written.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Sent,
+        typename OutIter, typename T,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy, OutIter>::type
+    histogram(ExPolicy&& policy, FwdIter first, Sent last, OutIter dest,
+        std::size_t num_bins, T lower, T upper, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements in the range [first, last) falling into each of
+    /// the bins defined by the sorted range of edges
+    /// [edges_first, edges_last) and assigns the counts to the range
+    /// [dest, dest + M - 1), where M = std::distance(edges_first, edges_last).
+    /// The bin i holds the values in [edges[i], edges[i + 1]). Values outside
+    /// of [edges[0], edges[M - 1]) are not counted.
+    ///
+    /// \note   Complexity: O(N * log(M) + M), where
+    ///                     N = std::distance(first, last).
+    ///
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter.
+    /// \tparam EdgeIter    The type of the iterators referring to the edges
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param edges_first  Refers to the beginning of the ascending sequence
+    ///                     of bin edges.
+    /// \param edges_last   Refers to the end of the ascending sequence of bin
+    ///                     edges.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// \returns  The \a histogram algorithm returns \a OutIter. The
+    ///           \a histogram algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last count
+    ///           written.
+    ///
+    template <typename FwdIter, typename Sent, typename EdgeIter,
+        typename OutIter,
+        typename Proj = parallel::util::projection_identity>
+    OutIter histogram(FwdIter first, Sent last, EdgeIter edges_first,
+        EdgeIter edges_last, OutIter dest, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements in the range [first, last) falling into each of
+    /// the bins defined by the sorted range of edges
+    /// [edges_first, edges_last) and assigns the counts to the range
+    /// [dest, dest + M - 1), where M = std::distance(edges_first, edges_last).
+    /// The bin i holds the values in [edges[i], edges[i + 1]). Values outside
+    /// of [edges[0], edges[M - 1]) are not counted.
+    ///
+    /// \note   Complexity: O(N * log(M) + P * M), where
+    ///                     N = std::distance(first, last) and P is the
+    ///                     number of tasks used.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Sent        The type of the source sentinel (deduced). This
+    ///                     sentinel type must be a sentinel for FwdIter.
+    /// \tparam EdgeIter    The type of the iterators referring to the edges
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param edges_first  Refers to the beginning of the ascending sequence
+    ///                     of bin edges.
+    /// \param edges_last   Refers to the end of the ascending sequence of bin
+    ///                     edges.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// The parallel versions count the elements of each task into private
+    /// counters which are merged pairwise afterwards. The number of tasks
+    /// is limited such that all private counters together do not outnumber
+    /// the elements.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<OutIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a OutIter
+    ///           otherwise.
+    ///           The \a histogram algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           count written.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Sent,
+        typename EdgeIter, typename OutIter,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy, OutIter>::type
+    histogram(ExPolicy&& policy, FwdIter first, Sent last,
+        EdgeIter edges_first, EdgeIter edges_last, OutIter dest,
+        Proj&& proj = Proj());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        static constexpr std::size_t histogram_limit_per_task = 1 << 14;
+
+        template <typename OutIter>
+        struct histogram
+          : public detail::algorithm<histogram<OutIter>, OutIter>
+        {
+            histogram()
+              : histogram::algorithm("histogram")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent,
+                typename Bins, typename Proj>
+            static OutIter sequential(ExPolicy&& policy, FwdIter first,
+                Sent last, OutIter dest, Bins const& bins, Proj&& proj)
+            {
+                std::vector<std::size_t> counts(bins.size() + 1);
+                sequential_histogram(HPX_FORWARD(ExPolicy, policy), first,
+                    static_cast<std::size_t>(detail::distance(first, last)),
+                    counts.data(), bins, proj);
+
+                // the last counter holds the values outside of all bins
+                return std::copy(counts.begin(), counts.end() - 1, dest);
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent,
+                typename Bins, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                OutIter>::type
+            parallel(ExPolicy&& policy, FwdIter first, Sent last,
+                OutIter dest, Bins const& bins, Proj&& proj)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, OutIter>;
+
+                try
+                {
+                    std::size_t const count =
+                        static_cast<std::size_t>(detail::distance(first, last));
+
+                    // figure out the chunk size to use
+                    std::size_t const cores =
+                        execution::processing_units_count(
+                            policy.parameters(), policy.executor());
+
+                    std::size_t max_chunks =
+                        execution::maximal_number_of_chunks(
+                            policy.parameters(), policy.executor(), cores,
+                            count);
+
+                    std::size_t chunk_size = execution::get_chunk_size(
+                        policy.parameters(), policy.executor(),
+                        [](std::size_t) { return 0; }, cores, count);
+
+                    util::detail::adjust_chunk_size_and_max_chunks(
+                        cores, count, max_chunks, chunk_size);
+
+                    // we should not get smaller than our
+                    // histogram_limit_per_task
+                    chunk_size =
+                        (std::max)(chunk_size, histogram_limit_per_task);
+
+                    if (count < 2 * chunk_size)
+                    {
+                        return algorithm_result::get(
+                            sequential(policy, first, last, dest, bins, proj));
+                    }
+
+                    // exceptions are handled as for the synchronous version
+                    // of the caller's policy, for task policies the returned
+                    // future will hold them
+                    using non_task_policy_type = std::decay_t<decltype(
+                        policy(hpx::execution::non_task))>;
+
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, first, count, dest, bins,
+                            proj = HPX_FORWARD(Proj, proj), cores,
+                            chunk_size]() mutable -> OutIter {
+                            try
+                            {
+                                std::vector<std::size_t> counts =
+                                    parallel_histogram(policy, first, count,
+                                        bins, proj, cores, chunk_size);
+                                return std::copy(
+                                    counts.begin(), counts.end() - 1, dest);
+                            }
+                            catch (...)
+                            {
+                                handle_exception<non_task_policy_type,
+                                    OutIter>::call();
+                            }
+                            return dest;
+                        }));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, OutIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+
+        // The bins of uniform histograms are computed using the common type
+        // of the projected values and the bounds.
+        template <typename Iter, typename Proj, typename T>
+        using histogram_value_t = std::common_type_t<
+            std::decay_t<hpx::util::invoke_result_t<Proj&,
+                typename std::iterator_traits<Iter>::reference>>,
+            T>;
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::experimental::histogram
+    inline constexpr struct histogram_t final
+      : hpx::detail::tag_parallel_algorithm<histogram_t>
+    {
+        // clang-format off
+        template <typename FwdIter, typename Sent, typename OutIter,
+            typename T, typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_sentinel_for<Sent, FwdIter>::value &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                std::is_arithmetic_v<T> &&
+                parallel::traits::is_projected<Proj, FwdIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(hpx::experimental::histogram_t,
+            FwdIter first, Sent last, OutIter dest, std::size_t num_bins,
+            T lower, T upper, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            using value_type =
+                parallel::v1::detail::histogram_value_t<FwdIter, Proj, T>;
+
+            return hpx::parallel::v1::detail::histogram<OutIter>().call(
+                hpx::execution::seq, first, last, dest,
+                hpx::parallel::v1::detail::uniform_bins<value_type>(
+                    num_bins, lower, upper),
+                HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename OutIter, typename T,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_sentinel_for<Sent, FwdIter>::value &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                std::is_arithmetic_v<T> &&
+                parallel::traits::is_projected<Proj, FwdIter>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_fallback_invoke(hpx::experimental::histogram_t, ExPolicy&& policy,
+            FwdIter first, Sent last, OutIter dest, std::size_t num_bins,
+            T lower, T upper, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            using value_type =
+                parallel::v1::detail::histogram_value_t<FwdIter, Proj, T>;
+
+            return hpx::parallel::v1::detail::histogram<OutIter>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, dest,
+                hpx::parallel::v1::detail::uniform_bins<value_type>(
+                    num_bins, lower, upper),
+                HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename Sent, typename EdgeIter,
+            typename OutIter,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_sentinel_for<Sent, FwdIter>::value &&
+                hpx::traits::is_iterator_v<EdgeIter> &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                parallel::traits::is_projected<Proj, FwdIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(hpx::experimental::histogram_t,
+            FwdIter first, Sent last, EdgeIter edges_first,
+            EdgeIter edges_last, OutIter dest, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<EdgeIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::histogram<OutIter>().call(
+                hpx::execution::seq, first, last, dest,
+                hpx::parallel::v1::detail::edge_bins<EdgeIter>(
+                    edges_first, edges_last),
+                HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename EdgeIter, typename OutIter,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator_v<FwdIter> &&
+                hpx::traits::is_sentinel_for<Sent, FwdIter>::value &&
+                hpx::traits::is_iterator_v<EdgeIter> &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                parallel::traits::is_projected<Proj, FwdIter>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_fallback_invoke(hpx::experimental::histogram_t, ExPolicy&& policy,
+            FwdIter first, Sent last, EdgeIter edges_first,
+            EdgeIter edges_last, OutIter dest, Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<EdgeIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::histogram<OutIter>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, dest,
+                hpx::parallel::v1::detail::edge_bins<EdgeIter>(
+                    edges_first, edges_last),
+                HPX_FORWARD(Proj, proj));
+        }
+    } histogram{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -432,6 +432,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -445,6 +446,7 @@ namespace hpx {
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <numeric>
 #include <type_traits>
@@ -500,6 +502,35 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return init;
         }
 
+        // Reduces the partition [first, first + count) (count != 0). Sums of
+        // arithmetic values are computed using the (vectorized) sequential
+        // reduce if the execution policy requests vectorization.
+        template <typename ExPolicy, typename T, typename InIter, typename Op>
+        T sequential_inclusive_scan_reduce_n(
+            InIter first, std::size_t count, Op const& op)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+
+            T init = *first;
+            if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+                std::is_arithmetic_v<T> && std::is_same_v<value_type, T> &&
+                (std::is_same_v<Op, std::plus<>> ||
+                    std::is_same_v<Op, std::plus<T>>))
+            {
+                return sequential_reduce<ExPolicy>(
+                    ++first, count - 1, HPX_MOVE(init), std::plus<>{});
+            }
+            else
+            {
+                while (--count != 0)
+                {
+                    init = HPX_INVOKE(op, init, *++first);
+                }
+                return init;
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct inclusive_scan
@@ -554,45 +585,35 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 3
-                // steps. The first calculates the scan results for each
-                // partition. The second accumulates the result from left to
-                // right to be used by the third step--which operates on the
-                // same partitions the first step operated on.
+                // The scan is performed in a single pass over the input. The
+                // first step reduces each partition, the second combines the
+                // results of the preceding partitions, and the third step
+                // scans the partition given the accumulated result of all
+                // partitions to its left.
 
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
 
                 auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
                               T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size, [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    auto iters = part_begin.get_iterator_tuple();
+                    sequential_inclusive_scan_n(get<0>(iters), part_size,
+                        get<1>(iters), HPX_MOVE(val), op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter2>, T>::
+                    util::in_out_result<FwdIter1, FwdIter2>, T, void,
+                    util::scan_partitioner_single_pass_tag>::
                     call(
                         HPX_FORWARD(ExPolicy, policy),
                         make_zip_iterator(first, dest), count, init,
-                        // step 1 performs first part of scan algorithm
-                        [op, last](zip_iterator part_begin,
+                        // step 1 reduces each partition
+                        [op](zip_iterator part_begin,
                             std::size_t part_size) -> T {
-                            T part_init = get<0>(*part_begin);
-                            get<1>(*part_begin++) = part_init;
-
-                            auto iters = part_begin.get_iterator_tuple();
-                            if (get<0>(iters) != last)
-                            {
-                                return sequential_inclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
-                            }
-                            return part_init;
+                            return sequential_inclusive_scan_reduce_n<
+                                std::decay_t<ExPolicy>, T>(
+                                get<0>(part_begin.get_iterator_tuple()),
+                                part_size, op);
                         },
                         // step 2 propagates the partition results from left
                         // to right
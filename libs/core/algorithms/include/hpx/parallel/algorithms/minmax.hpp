@@ -376,6 +376,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -723,40 +724,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // minmax_element
     namespace detail {
         /// \cond NOINTERNAL
-        template <typename ExPolicy, typename FwdIter, typename F,
-            typename Proj>
-        minmax_element_result<FwdIter> sequential_minmax_element(ExPolicy&&,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
-        {
-            minmax_element_result<FwdIter> result = {it, it};
-
-            if (count == 0 || count == 1)
-                return result;
-
-            using element_type = hpx::traits::proxy_value_t<
-                typename std::iterator_traits<FwdIter>::value_type>;
-
-            element_type min_value = HPX_INVOKE(proj, *it);
-            element_type max_value = min_value;
-            util::loop_n<std::decay_t<ExPolicy>>(
-                ++it, count - 1, [&](FwdIter const& curr) -> void {
-                    element_type curr_value = HPX_INVOKE(proj, *curr);
-                    if (HPX_INVOKE(f, curr_value, min_value))
-                    {
-                        result.min = curr;
-                        min_value = curr_value;
-                    }
-
-                    if (!HPX_INVOKE(f, curr_value, max_value))
-                    {
-                        result.max = curr;
-                        max_value = HPX_MOVE(curr_value);
-                    }
-                });
-
-            return result;
-        }
-
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<minmax_element<Iter>,
@@ -813,6 +780,25 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 typename F, typename Proj>
             static minmax_element_result<FwdIter> sequential(
                 ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+            {
+                if constexpr (hpx::traits::is_random_access_iterator_v<FwdIter>)
+                {
+                    return sequential_minmax_element(
+                        HPX_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), f, proj);
+                }
+                else
+                {
+                    return sequential_minmax_element_fwd(
+                        HPX_FORWARD(ExPolicy, policy), first, last,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+                }
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Sent,
+                typename F, typename Proj>
+            static minmax_element_result<FwdIter> sequential_minmax_element_fwd(
+                ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
             {
                 auto min = first, max = first;
 
@@ -479,12 +479,15 @@ namespace hpx {
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/replace.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -495,21 +498,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential replace
-        template <typename InIter, typename T1, typename T2, typename Proj>
-        inline InIter sequential_replace(InIter first, InIter last,
-            T1 const& old_value, T2 const& new_value, Proj&& proj)
-        {
-            for (/* */; first != last; ++first)
-            {
-                if (HPX_INVOKE(proj, *first) == old_value)
-                {
-                    *first = new_value;
-                }
-            }
-            return first;
-        }
-
         template <typename Iter>
         struct replace : public detail::algorithm<replace<Iter>, Iter>
         {
@@ -520,11 +508,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename InIter, typename T1,
                 typename T2, typename Proj>
-            static InIter sequential(ExPolicy, InIter first, InIter last,
-                T1 const& old_value, T2 const& new_value, Proj&& proj)
+            static InIter sequential(ExPolicy&& policy, InIter first,
+                InIter last, T1 const& old_value, T2 const& new_value,
+                Proj&& proj)
             {
-                return sequential_replace(
-                    first, last, old_value, new_value, HPX_FORWARD(Proj, proj));
+                return sequential_replace(HPX_FORWARD(ExPolicy, policy), first,
+                    last, old_value, new_value, HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename FwdIter, typename T1,
@@ -534,19 +523,39 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
                     T1 const& old_value, T2 const& new_value, Proj&& proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                if constexpr (hpx::is_vectorpack_execution_policy_v<ExPolicy>)
+                {
+                    // the vectorized replace operates on whole partitions
+                    std::size_t count = std::distance(first, last);
+                    auto f1 = [policy, old_value, new_value,
+                                  proj = HPX_FORWARD(Proj, proj)](
+                                  FwdIter part_begin,
+                                  std::size_t part_size) mutable {
+                        return sequential_replace(policy, part_begin,
+                            std::next(part_begin, part_size), old_value,
+                            new_value, proj);
+                    };
+                    return util::partitioner<ExPolicy, FwdIter>::call(
+                        HPX_FORWARD(ExPolicy, policy), first, count,
+                        HPX_MOVE(f1), [last](auto&&) { return last; });
+                }
+                else
+                {
+                    typedef typename std::iterator_traits<FwdIter>::value_type
+                        type;
 
-                return for_each_n<FwdIter>().call(
-                    HPX_FORWARD(ExPolicy, policy), first,
-                    std::distance(first, last),
-                    [old_value, new_value, proj = HPX_FORWARD(Proj, proj)](
-                        type& t) -> void {
-                        if (HPX_INVOKE(proj, t) == old_value)
-                        {
-                            t = new_value;
-                        }
-                    },
-                    util::projection_identity());
+                    return for_each_n<FwdIter>().call(
+                        HPX_FORWARD(ExPolicy, policy), first,
+                        std::distance(first, last),
+                        [old_value, new_value, proj = HPX_FORWARD(Proj, proj)](
+                            type& t) -> void {
+                            if (HPX_INVOKE(proj, t) == old_value)
+                            {
+                                t = new_value;
+                            }
+                        },
+                        util::projection_identity());
+                }
             }
         };
         /// \endcond
@@ -242,6 +242,7 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/in_place_sample_sort.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
@@ -405,11 +406,45 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::make_ready_future(last);
             }
 
-            return execution::async_execute(policy.executor(),
-                &sort_thread<typename std::decay<ExPolicy>::type, RandomIt,
-                    Comp>,
-                HPX_FORWARD(ExPolicy, policy), first, last,
-                HPX_FORWARD(Comp, comp), chunk_size);
+            using value_type =
+                typename std::iterator_traits<RandomIt>::value_type;
+
+            if constexpr (std::is_copy_constructible_v<value_type>)
+            {
+                // exceptions are handled as for the synchronous version of
+                // the caller's policy, for task policies the returned future
+                // will hold them
+                using non_task_policy_type = std::decay_t<decltype(
+                    policy(hpx::execution::non_task))>;
+
+                // the samplesort partitions the input using all cores from
+                // the first level of the recursion on, the splitters are
+                // copies of elements
+                return execution::async_execute(policy.executor(),
+                    [exec = policy.executor(), first, last,
+                        comp = HPX_FORWARD(Comp, comp), cores,
+                        chunk_size]() mutable -> RandomIt {
+                        try
+                        {
+                            in_place_sample_sort(
+                                exec, first, last, comp, cores, chunk_size);
+                        }
+                        catch (...)
+                        {
+                            handle_exception<non_task_policy_type,
+                                RandomIt>::call();
+                        }
+                        return last;
+                    });
+            }
+            else
+            {
+                return execution::async_execute(policy.executor(),
+                    &sort_thread<typename std::decay<ExPolicy>::type, RandomIt,
+                        Comp>,
+                    HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Comp, comp), chunk_size);
+            }
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -10,8 +10,10 @@
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
 
+#include <hpx/parallel/algorithms/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <algorithm>
 #include <iterator>
@@ -135,12 +137,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
         std::advance(value_last, std::distance(key_first, key_last));
 
         using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using value_type = typename std::iterator_traits<ValueIter>::value_type;
 
-        return detail::get_iter_pair<iterator_type>(
-            detail::sort<iterator_type>().call(HPX_FORWARD(ExPolicy, policy),
-                hpx::util::make_zip_iterator(key_first, value_first),
-                hpx::util::make_zip_iterator(key_last, value_last),
-                HPX_FORWARD(Compare, comp), detail::extract_key()));
+        if constexpr (detail::is_radix_sortable_v<key_type> &&
+            std::is_default_constructible_v<value_type> &&
+            std::is_same_v<std::decay_t<Compare>, detail::less>)
+        {
+            // arithmetic keys ordered by operator< are sorted by their binary
+            // representation instead of comparing them, the radix sort needs
+            // a temporary buffer of default constructed elements
+            HPX_UNUSED(comp);
+            return detail::get_iter_pair<iterator_type>(
+                detail::radix_sort<iterator_type>().call(
+                    HPX_FORWARD(ExPolicy, policy),
+                    hpx::util::make_zip_iterator(key_first, value_first),
+                    hpx::util::make_zip_iterator(key_last, value_last),
+                    detail::extract_key()));
+        }
+        else
+        {
+            return detail::get_iter_pair<iterator_type>(
+                detail::sort<iterator_type>().call(
+                    HPX_FORWARD(ExPolicy, policy),
+                    hpx::util::make_zip_iterator(key_first, value_first),
+                    hpx::util::make_zip_iterator(key_last, value_last),
+                    HPX_FORWARD(Compare, comp), detail::extract_key()));
+        }
 #endif
     }
 }}}    // namespace hpx::parallel::v1
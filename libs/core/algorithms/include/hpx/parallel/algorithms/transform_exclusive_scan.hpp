@@ -328,37 +328,37 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 FwdIter2 final_dest = dest;
                 std::advance(final_dest, count);
 
-                // The overall scan algorithm is performed by executing 2
-                // subsequent parallel steps. The first calculates the scan
-                // results for each partition and the second produces the
-                // overall result
+                // The scan is performed in a single pass over the input. The
+                // first step reduces each partition, the second combines the
+                // results of the preceding partitions, and the third step
+                // scans the partition given the accumulated result of all
+                // partitions to its left.
 
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
 
-                auto f3 = [op](zip_iterator part_begin, std::size_t part_size,
-                              T val) mutable -> void {
-                    FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
-                    *dst++ = val;
-
-                    util::loop_n<std::decay_t<ExPolicy>>(
-                        dst, part_size - 1, [&op, &val](FwdIter2 it) -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                auto f3 = [op, conv](zip_iterator part_begin,
+                              std::size_t part_size, T val) mutable -> void {
+                    auto iters = part_begin.get_iterator_tuple();
+                    sequential_transform_exclusive_scan_n(get<0>(iters),
+                        part_size, get<1>(iters), conv, HPX_MOVE(val), op);
                 };
 
-                return util::scan_partitioner<ExPolicy, result_type, T>::call(
+                return util::scan_partitioner<ExPolicy, result_type, T, void,
+                    util::scan_partitioner_single_pass_tag>::call(
                     HPX_FORWARD(ExPolicy, policy),
                     make_zip_iterator(first, dest), count, init,
-                    // step 1 performs first part of scan algorithm
+                    // step 1 reduces each partition
                     [op, conv](zip_iterator part_begin,
                         std::size_t part_size) mutable -> T {
-                        T part_init = HPX_INVOKE(conv, get<0>(*part_begin++));
-
-                        auto iters = part_begin.get_iterator_tuple();
-                        return sequential_transform_exclusive_scan_n(
-                            get<0>(iters), part_size - 1, get<1>(iters), conv,
-                            part_init, op);
+                        FwdIter1 it = get<0>(part_begin.get_iterator_tuple());
+                        T part_init = HPX_INVOKE(conv, *it);
+                        while (--part_size != 0)
+                        {
+                            part_init = HPX_INVOKE(
+                                op, part_init, HPX_INVOKE(conv, *++it));
+                        }
+                        return part_init;
                     },
                     // step 2 propagates the partition results from left
                     // to right
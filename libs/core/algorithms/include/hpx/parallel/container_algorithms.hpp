@@ -14,6 +14,7 @@
 #include <hpx/parallel/container_algorithms/all_any_none.hpp>
 #include <hpx/parallel/container_algorithms/copy.hpp>
 #include <hpx/parallel/container_algorithms/count.hpp>
+#include <hpx/parallel/container_algorithms/counting_sort.hpp>
 #include <hpx/parallel/container_algorithms/ends_with.hpp>
 #include <hpx/parallel/container_algorithms/equal.hpp>
 #include <hpx/parallel/container_algorithms/fill.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/parallel/container_algorithms/for_each.hpp>
 #include <hpx/parallel/container_algorithms/for_loop.hpp>
 #include <hpx/parallel/container_algorithms/generate.hpp>
+#include <hpx/parallel/container_algorithms/histogram.hpp>
 #include <hpx/parallel/container_algorithms/includes.hpp>
 #include <hpx/parallel/container_algorithms/is_heap.hpp>
 #include <hpx/parallel/container_algorithms/is_partitioned.hpp>
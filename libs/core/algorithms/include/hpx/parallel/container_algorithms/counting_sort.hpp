@@ -0,0 +1,195 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/counting_sort.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges { namespace experimental {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements of the range \a rng in ascending order of the
+    /// integral keys returned by the projection. The order of elements with
+    /// equal keys is preserved. The keys are not compared but counted, the
+    /// elements are moved to the positions following from the counts of all
+    /// smaller keys.
+    ///
+    /// \note   Complexity: O(N + K), where N = std::size(rng) and K is the
+    ///                     number of distinct values between the smallest
+    ///                     and the largest key, if K < N. Otherwise the
+    ///                     elements are sorted using a radix sort.
+    ///
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity. The
+    ///                     projection has to return an integral value (other
+    ///                     than bool).
+    ///
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     its key.
+    ///
+    /// \returns  The \a counting_sort algorithm returns an iterator referring
+    ///           to the end of the range \a rng.
+    ///
+    template <typename Rng,
+        typename Proj = parallel::util::projection_identity>
+    typename hpx::traits::range_iterator<Rng>::type
+    counting_sort(Rng&& rng, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements of the range \a rng in ascending order of the
+    /// integral keys returned by the projection. The order of elements with
+    /// equal keys is preserved. The keys are not compared but counted, the
+    /// elements are moved to the positions following from the counts of all
+    /// smaller keys.
+    ///
+    /// \note   Complexity: O(N + K), where N = std::size(rng) and K is the
+    ///                     number of distinct values between the smallest
+    ///                     and the largest key, if K < N. Otherwise the
+    ///                     elements are sorted using a radix sort.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity. The
+    ///                     projection has to return an integral value (other
+    ///                     than bool).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     its key.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a counting_sort algorithm returns a
+    ///           \a hpx::future<Iter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a Iter
+    ///           otherwise, where \a Iter is the iterator type of \a rng.
+    ///           The iterator refers to the end of the range \a rng.
+    ///
+    template <typename ExPolicy, typename Rng,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy,
+        typename hpx::traits::range_iterator<Rng>::type>::type
+    counting_sort(ExPolicy&& policy, Rng&& rng, Proj&& proj = Proj());
+
+    // clang-format on
+}}}    // namespace hpx::ranges::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/parallel/algorithms/counting_sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::ranges::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::ranges::experimental::counting_sort
+    inline constexpr struct counting_sort_t final
+      : hpx::detail::tag_parallel_algorithm<counting_sort_t>
+    {
+    private:
+        // clang-format off
+        template <typename Rng,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng>::value &&
+                parallel::traits::is_projected_range<Proj, Rng>::value &&
+                parallel::v1::detail::is_counting_sortable_v<
+                    hpx::util::invoke_result_t<Proj&,
+                        typename std::iterator_traits<typename hpx::traits::
+                            range_iterator<Rng>::type>::reference>>
+            )>
+        // clang-format on
+        friend typename hpx::traits::range_iterator<Rng>::type
+        tag_fallback_invoke(hpx::ranges::experimental::counting_sort_t,
+            Rng&& rng, Proj&& proj = Proj())
+        {
+            using iterator_type =
+                typename hpx::traits::range_iterator<Rng>::type;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator_v<iterator_type>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::v1::detail::counting_sort<iterator_type>()
+                .call(hpx::execution::seq, hpx::util::begin(rng),
+                    hpx::util::end(rng), HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng>::value &&
+                parallel::traits::is_projected_range<Proj, Rng>::value &&
+                parallel::v1::detail::is_counting_sortable_v<
+                    hpx::util::invoke_result_t<Proj&,
+                        typename std::iterator_traits<typename hpx::traits::
+                            range_iterator<Rng>::type>::reference>>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            typename hpx::traits::range_iterator<Rng>::type>::type
+        tag_fallback_invoke(hpx::ranges::experimental::counting_sort_t,
+            ExPolicy&& policy, Rng&& rng, Proj&& proj = Proj())
+        {
+            using iterator_type =
+                typename hpx::traits::range_iterator<Rng>::type;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator_v<iterator_type>,
+                "Requires a random access iterator.");
+
+            return hpx::parallel::v1::detail::counting_sort<iterator_type>()
+                .call(HPX_FORWARD(ExPolicy, policy), hpx::util::begin(rng),
+                    hpx::util::end(rng), HPX_FORWARD(Proj, proj));
+        }
+    } counting_sort{};
+}    // namespace hpx::ranges::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,351 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/histogram.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges { namespace experimental {
+    // clang-format off
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements of the range \a rng falling into each of
+    /// \a num_bins bins of equal width covering [lower, upper) and assigns
+    /// the counts to the range [dest, dest + num_bins). The bin i holds the
+    /// values in [lower + i * w, lower + (i + 1) * w) with
+    /// w = (upper - lower) / num_bins. Values outside of [lower, upper)
+    /// (including NaNs) are not counted.
+    ///
+    /// \note   Complexity: O(N + num_bins), where N = std::size(rng).
+    ///
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam T           The type of the bounds of the bins (deduced). The
+    ///                     values are mapped onto the bins using the common
+    ///                     type of the projected values and \a T, which has
+    ///                     to be arithmetic.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin.
+    /// \param upper        The upper bound of the last bin, it is not part of
+    ///                     the last bin.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// \returns  The \a histogram algorithm returns \a OutIter. The
+    ///           \a histogram algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last count
+    ///           written.
+    ///
+    template <typename Rng, typename OutIter, typename T,
+        typename Proj = parallel::util::projection_identity>
+    OutIter histogram(Rng&& rng, OutIter dest, std::size_t num_bins,
+        T lower, T upper, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements of the range \a rng falling into each of
+    /// \a num_bins bins of equal width covering [lower, upper) and assigns
+    /// the counts to the range [dest, dest + num_bins). The bin i holds the
+    /// values in [lower + i * w, lower + (i + 1) * w) with
+    /// w = (upper - lower) / num_bins. Values outside of [lower, upper)
+    /// (including NaNs) are not counted.
+    ///
+    /// \note   Complexity: O(N + P * num_bins), where N = std::size(rng)
+    ///                     and P is the number of tasks used.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam T           The type of the bounds of the bins (deduced). The
+    ///                     values are mapped onto the bins using the common
+    ///                     type of the projected values and \a T, which has
+    ///                     to be arithmetic.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param num_bins     The number of bins.
+    /// \param lower        The lower bound of the first bin.
+    /// \param upper        The upper bound of the last bin, it is not part of
+    ///                     the last bin.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<OutIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a OutIter
+    ///           otherwise.
+    ///           The \a histogram algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           count written.
+    ///
+    template <typename ExPolicy, typename Rng, typename OutIter, typename T,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy, OutIter>::type
+    histogram(ExPolicy&& policy, Rng&& rng, OutIter dest,
+        std::size_t num_bins, T lower, T upper, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements of the range \a rng falling into each of the bins
+    /// defined by the sorted range of edges \a edges and assigns the counts
+    /// to the range [dest, dest + M - 1), where M = std::size(edges). The
+    /// bin i holds the values in [edges[i], edges[i + 1]). Values outside of
+    /// [edges[0], edges[M - 1]) are not counted.
+    ///
+    /// \note   Complexity: O(N * log(M) + M), where N = std::size(rng).
+    ///
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam EdgeRng     The type of the range of edges (deduced). The
+    ///                     iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param edges        Refers to the ascending sequence of bin edges.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// \returns  The \a histogram algorithm returns \a OutIter. The
+    ///           \a histogram algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last count
+    ///           written.
+    ///
+    template <typename Rng, typename EdgeRng, typename OutIter,
+        typename Proj = parallel::util::projection_identity>
+    OutIter histogram(
+        Rng&& rng, EdgeRng&& edges, OutIter dest, Proj&& proj = Proj());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the elements of the range \a rng falling into each of the bins
+    /// defined by the sorted range of edges \a edges and assigns the counts
+    /// to the range [dest, dest + M - 1), where M = std::size(edges). The
+    /// bin i holds the values in [edges[i], edges[i + 1]). Values outside of
+    /// [edges[0], edges[M - 1]) are not counted.
+    ///
+    /// \note   Complexity: O(N * log(M) + P * M), where N = std::size(rng)
+    ///                     and P is the number of tasks used.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam EdgeRng     The type of the range of edges (deduced). The
+    ///                     iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam OutIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     output iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param edges        Refers to the ascending sequence of bin edges.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     receiving the counts.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to obtain
+    ///                     the value to count.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<OutIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a OutIter
+    ///           otherwise.
+    ///           The \a histogram algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           count written.
+    ///
+    template <typename ExPolicy, typename Rng, typename EdgeRng,
+        typename OutIter,
+        typename Proj = parallel::util::projection_identity>
+    typename parallel::util::detail::algorithm_result<ExPolicy, OutIter>::type
+    histogram(ExPolicy&& policy, Rng&& rng, EdgeRng&& edges, OutIter dest,
+        Proj&& proj = Proj());
+
+    // clang-format on
+}}}    // namespace hpx::ranges::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::ranges::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // DPO for hpx::ranges::experimental::histogram
+    inline constexpr struct histogram_t final
+      : hpx::detail::tag_parallel_algorithm<histogram_t>
+    {
+    private:
+        // clang-format off
+        template <typename Rng, typename OutIter, typename T,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng>::value &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                std::is_arithmetic_v<T> &&
+                parallel::traits::is_projected_range<Proj, Rng>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(
+            hpx::ranges::experimental::histogram_t, Rng&& rng, OutIter dest,
+            std::size_t num_bins, T lower, T upper, Proj&& proj = Proj())
+        {
+            return hpx::experimental::histogram(hpx::util::begin(rng),
+                hpx::util::end(rng), dest, num_bins, lower, upper,
+                HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng, typename OutIter,
+            typename T, typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng>::value &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                std::is_arithmetic_v<T> &&
+                parallel::traits::is_projected_range<Proj, Rng>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_fallback_invoke(hpx::ranges::experimental::histogram_t,
+            ExPolicy&& policy, Rng&& rng, OutIter dest, std::size_t num_bins,
+            T lower, T upper, Proj&& proj = Proj())
+        {
+            return hpx::experimental::histogram(HPX_FORWARD(ExPolicy, policy),
+                hpx::util::begin(rng), hpx::util::end(rng), dest, num_bins,
+                lower, upper, HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename Rng, typename EdgeRng, typename OutIter,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng>::value &&
+                hpx::traits::is_range<EdgeRng>::value &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                parallel::traits::is_projected_range<Proj, Rng>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(
+            hpx::ranges::experimental::histogram_t, Rng&& rng,
+            EdgeRng&& edges, OutIter dest, Proj&& proj = Proj())
+        {
+            return hpx::experimental::histogram(hpx::util::begin(rng),
+                hpx::util::end(rng), hpx::util::begin(edges),
+                hpx::util::end(edges), dest, HPX_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng, typename EdgeRng,
+            typename OutIter,
+            typename Proj = parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng>::value &&
+                hpx::traits::is_range<EdgeRng>::value &&
+                hpx::traits::is_iterator_v<OutIter> &&
+                parallel::traits::is_projected_range<Proj, Rng>::value
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_fallback_invoke(hpx::ranges::experimental::histogram_t,
+            ExPolicy&& policy, Rng&& rng, EdgeRng&& edges, OutIter dest,
+            Proj&& proj = Proj())
+        {
+            return hpx::experimental::histogram(HPX_FORWARD(ExPolicy, policy),
+                hpx::util::begin(rng), hpx::util::end(rng),
+                hpx::util::begin(edges), hpx::util::end(edges), dest,
+                HPX_FORWARD(Proj, proj));
+        }
+    } histogram{};
+}    // namespace hpx::ranges::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,127 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The range check and the scaling of the values are computed for whole
+    // vector packs, only the increments of the counters are done one value
+    // at a time.
+    template <typename Iterator>
+    struct datapar_histogram_helper
+    {
+        using iterator_type = std::decay_t<Iterator>;
+        using value_type =
+            typename std::iterator_traits<iterator_type>::value_type;
+        using V =
+            typename hpx::parallel::traits::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+        template <typename Iter>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static Iter call(Iter first,
+            std::size_t count, std::size_t* counts,
+            uniform_bins<value_type> const& bins)
+        {
+            std::size_t len = count;
+            for (; !hpx::parallel::util::detail::is_data_aligned(first) &&
+                 len != 0;
+                 --len, ++first)
+            {
+                ++counts[bins(*first)];
+            }
+
+            // values outside of the bins get a negative position
+            V const lower(bins.lower());
+            V const upper(bins.upper());
+            V const scale(bins.scale());
+            V const outside(value_type(-1));
+            std::size_t const outside_bin = bins.size();
+
+            for (/* */; len >= size; len -= size)
+            {
+                V tmp(traits::vector_pack_load<V, value_type>::aligned(first));
+                V positions = traits::choose((tmp >= lower) && (tmp < upper),
+                    V((tmp - lower) * scale), outside);
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    value_type const position = traits::get(positions, i);
+                    ++counts[position < value_type(0) ?
+                            outside_bin :
+                            bins.position_to_bin(position)];
+                }
+                std::advance(first, size);
+            }
+
+            for (/* */; len != 0; --len, ++first)
+            {
+                ++counts[bins(*first)];
+            }
+            return first;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only uniform bins of floating point values of the same type as the
+    // elements are computed using vector packs.
+    template <typename Iter, typename Bins, typename Proj>
+    struct datapar_histogram_compatible
+      : std::integral_constant<bool,
+            hpx::parallel::util::detail::iterator_datapar_compatible<
+                Iter>::value &&
+                std::is_same_v<std::decay_t<Proj>,
+                    hpx::parallel::util::projection_identity> &&
+                std::is_floating_point_v<
+                    typename std::iterator_traits<Iter>::value_type> &&
+                std::is_same_v<Bins,
+                    uniform_bins<
+                        typename std::iterator_traits<Iter>::value_type>>>
+    {
+    };
+
+    template <typename ExPolicy, typename Iter, typename Bins, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_histogram_t,
+        ExPolicy&& policy, Iter first, std::size_t count, std::size_t* counts,
+        Bins const& bins, Proj&& proj)
+    {
+        if constexpr (datapar_histogram_compatible<Iter, Bins, Proj>::value)
+        {
+            return datapar_histogram_helper<Iter>::call(
+                first, count, counts, bins);
+        }
+        else
+        {
+            return sequential_histogram(
+                hpx::execution::experimental::to_non_simd(policy), first,
+                count, counts, bins, HPX_FORWARD(Proj, proj));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
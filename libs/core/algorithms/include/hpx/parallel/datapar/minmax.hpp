@@ -0,0 +1,137 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    struct datapar_minmax_element_helper
+    {
+        using iterator_type = std::decay_t<Iterator>;
+        using value_type =
+            typename std::iterator_traits<iterator_type>::value_type;
+        using V =
+            typename hpx::parallel::traits::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+        template <typename Iter>
+        static util::min_max_result<Iter> call(Iter it, std::size_t count)
+        {
+            util::min_max_result<Iter> result = {it, it};
+
+            if (count == 0 || count == 1)
+                return result;
+
+            value_type min_value = *it;
+            value_type max_value = min_value;
+
+            auto update = [&](Iter curr) {
+                value_type curr_value = *curr;
+                if (curr_value < min_value)
+                {
+                    result.min = curr;
+                    min_value = curr_value;
+                }
+
+                if (!(curr_value < max_value))
+                {
+                    result.max = curr;
+                    max_value = curr_value;
+                }
+            };
+
+            std::size_t len = count - 1;
+            for (++it; !hpx::parallel::util::detail::is_data_aligned(it) &&
+                 len != 0;
+                 --len, ++it)
+            {
+                update(it);
+            }
+
+            // Only elements comparing less than the current minimum or not
+            // less than the current maximum change the result. Whole packs
+            // without any such element are skipped, all others are processed
+            // element by element, which preserves the positions reported by
+            // the scalar algorithm (first minimum, last maximum).
+            for (/* */; len >= size; len -= size)
+            {
+                V tmp(traits::vector_pack_load<V, value_type>::aligned(it));
+                if (traits::any_of(
+                        (tmp < V(min_value)) || !(tmp < V(max_value))))
+                {
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        update(it + i);
+                    }
+                }
+                std::advance(it, size);
+            }
+
+            for (/* */; len != 0; --len, ++it)
+            {
+                update(it);
+            }
+            return result;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename F>
+    struct is_datapar_less
+      : std::integral_constant<bool,
+            std::is_same_v<F, hpx::parallel::v1::detail::less> ||
+                std::is_same_v<F, std::less<>>>
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    util::min_max_result<FwdIter> tag_invoke(sequential_minmax_element_t,
+        ExPolicy&& policy, FwdIter it, std::size_t count, F const& f,
+        Proj const& proj)
+    {
+        if constexpr (hpx::parallel::util::detail::iterator_datapar_compatible<
+                          FwdIter>::value &&
+            is_datapar_less<std::decay_t<F>>::value &&
+            std::is_same_v<std::decay_t<Proj>,
+                hpx::parallel::util::projection_identity>)
+        {
+            return datapar_minmax_element_helper<FwdIter>::call(it, count);
+        }
+        else
+        {
+            return sequential_minmax_element(
+                hpx::execution::experimental::to_non_simd(policy), it, count,
+                f, proj);
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
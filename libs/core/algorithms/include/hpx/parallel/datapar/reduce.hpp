@@ -16,11 +16,13 @@
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/datapar/handle_local_exceptions.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -80,17 +82,48 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             return init;
         }
 
+        // The full vector packs are accumulated element-wise, the horizontal
+        // reduction of the accumulated pack is performed only once at the end.
         template <typename Iter1, typename Sent, typename Iter2, typename T,
             typename Reduce, typename Convert>
         HPX_HOST_DEVICE HPX_FORCEINLINE static T call(Iter1 first1, Sent last1,
             Iter2 first2, T init, Reduce&& r, Convert&& conv)
         {
-            util::loop2<ExPolicy>(
-                first1, last1, first2, [&init, &r, &conv](auto it1, auto it2) {
-                    auto partial_res = hpx::parallel::traits::reduce(
-                        r, HPX_INVOKE(conv, it1, it2));
-                    init = r(init, partial_res);
-                });
+            using step = util::detail::datapar_loop_step2_ind<Iter1, Iter2>;
+            using value_type = typename std::iterator_traits<Iter1>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+
+            static constexpr std::size_t size =
+                traits::vector_pack_size<V>::value;
+
+            std::size_t len = detail::distance(first1, last1);
+            for (/* */; len != 0 &&
+                 (!util::detail::is_data_aligned(first1) ||
+                     !util::detail::is_data_aligned(first2));
+                 --len)
+            {
+                init = HPX_INVOKE(r, init,
+                    hpx::parallel::traits::reduce(
+                        r, step::call1(conv, first1, first2)));
+            }
+
+            if (len >= size)
+            {
+                auto acc = step::callv(conv, first1, first2);
+                for (len -= size; len >= size; len -= size)
+                {
+                    acc = HPX_INVOKE(r, acc, step::callv(conv, first1, first2));
+                }
+                init = HPX_INVOKE(
+                    r, init, hpx::parallel::traits::reduce(r, acc));
+            }
+
+            for (/* */; len != 0; --len)
+            {
+                init = HPX_INVOKE(r, init,
+                    hpx::parallel::traits::reduce(
+                        r, step::call1(conv, first1, first2)));
+            }
             return init;
         }
     };
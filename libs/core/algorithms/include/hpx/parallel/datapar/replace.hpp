@@ -0,0 +1,114 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/replace.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    struct datapar_replace_helper
+    {
+        using iterator_type = std::decay_t<Iterator>;
+        using value_type =
+            typename std::iterator_traits<iterator_type>::value_type;
+        using V =
+            typename hpx::parallel::traits::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+        template <typename Iter>
+        HPX_HOST_DEVICE HPX_FORCEINLINE static Iter call(Iter first,
+            std::size_t count, value_type old_value, value_type new_value)
+        {
+            std::size_t len = count;
+            for (; !hpx::parallel::util::detail::is_data_aligned(first) &&
+                 len != 0;
+                 --len, ++first)
+            {
+                if (*first == old_value)
+                    *first = new_value;
+            }
+
+            V const old_values(old_value);
+            V const new_values(new_value);
+            for (/* */; len >= size; len -= size)
+            {
+                V tmp(traits::vector_pack_load<V, value_type>::aligned(first));
+                traits::mask_assign(tmp == old_values, tmp, new_values);
+                traits::vector_pack_store<V, value_type>::aligned(tmp, first);
+                std::advance(first, size);
+            }
+
+            for (/* */; len != 0; --len, ++first)
+            {
+                if (*first == old_value)
+                    *first = new_value;
+            }
+            return first;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The comparison of the values is vectorized only if converting the old
+    // value to the value type of the sequence does not change the outcome of
+    // the comparisons.
+    template <typename Iter, typename T1, typename T2, typename Proj>
+    struct datapar_replace_compatible
+      : std::integral_constant<bool,
+            hpx::parallel::util::detail::iterator_datapar_compatible<
+                Iter>::value &&
+                std::is_same_v<std::decay_t<Proj>,
+                    hpx::parallel::util::projection_identity> &&
+                std::is_arithmetic_v<T1> && std::is_arithmetic_v<T2> &&
+                std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+                    std::common_type_t<
+                        typename std::iterator_traits<Iter>::value_type, T1>>>
+    {
+    };
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename T1,
+        typename T2, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(sequential_replace_t,
+        ExPolicy&& policy, Iter first, Sent last, T1 const& old_value,
+        T2 const& new_value, Proj&& proj)
+    {
+        if constexpr (datapar_replace_compatible<Iter, T1, T2, Proj>::value)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            return datapar_replace_helper<Iter>::call(first,
+                std::distance(first, last), static_cast<value_type>(old_value),
+                static_cast<value_type>(new_value));
+        }
+        else
+        {
+            return sequential_replace(
+                hpx::execution::experimental::to_non_simd(policy), first, last,
+                old_value, new_value, HPX_FORWARD(Proj, proj));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/algorithms/detail/search.hpp>
+#include <hpx/parallel/datapar/find.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_search
+    {
+        // The candidate positions are located by searching for the first
+        // element of the needle using the vectorized find, every candidate
+        // is then verified element by element.
+        template <typename FwdIter, typename Sent, typename FwdIter2,
+            typename Sent2>
+        static FwdIter call(
+            FwdIter first, Sent last, FwdIter2 s_first, Sent2 s_last)
+        {
+            auto const diff = detail::distance(s_first, s_last);
+            if (diff <= 0)
+                return first;
+
+            auto const count = detail::distance(first, last);
+            FwdIter const end = std::next(first, count);
+            if (count < diff)
+                return end;
+
+            FwdIter const stop = std::next(first, count - diff + 1);
+            auto const needle = *s_first;
+            for (/* */; /* */; ++first)
+            {
+                first = sequential_find<ExPolicy>(first, stop, needle);
+                if (first == stop)
+                    return end;
+
+                if (std::equal(std::next(first), std::next(first, diff),
+                        std::next(s_first)))
+                {
+                    return first;
+                }
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename FwdIter, typename FwdIter2, typename Pred,
+        typename Proj1, typename Proj2>
+    struct datapar_search_compatible
+      : std::integral_constant<bool,
+            hpx::parallel::util::detail::iterator_datapar_compatible<
+                FwdIter>::value &&
+                hpx::traits::is_random_access_iterator_v<FwdIter2> &&
+                std::is_same_v<
+                    typename std::iterator_traits<FwdIter>::value_type,
+                    typename std::iterator_traits<FwdIter2>::value_type> &&
+                (std::is_same_v<Pred, hpx::parallel::v1::detail::equal_to> ||
+                    std::is_same_v<Pred, std::equal_to<>>) &&
+                std::is_same_v<Proj1,
+                    hpx::parallel::util::projection_identity> &&
+                std::is_same_v<Proj2,
+                    hpx::parallel::util::projection_identity>>
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename Sent,
+        typename FwdIter2, typename Sent2, typename Pred, typename Proj1,
+        typename Proj2,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    FwdIter tag_invoke(sequential_search_t, ExPolicy&& policy, FwdIter first,
+        Sent last, FwdIter2 s_first, Sent2 s_last, Pred&& op, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        if constexpr (datapar_search_compatible<FwdIter, FwdIter2,
+                          std::decay_t<Pred>, std::decay_t<Proj1>,
+                          std::decay_t<Proj2>>::value)
+        {
+            return datapar_search<std::decay_t<ExPolicy>>::call(
+                first, last, s_first, s_last);
+        }
+        else
+        {
+            return sequential_search(
+                hpx::execution::experimental::to_non_simd(policy), first, last,
+                s_first, s_last, HPX_FORWARD(Pred, op),
+                HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -18,7 +18,9 @@
 #endif
 
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -27,10 +29,13 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -44,8 +49,199 @@ namespace hpx { namespace parallel { namespace util {
     {
     };
 
+    // The single-pass scan reads the input only once from memory: f1 reduces
+    // a chunk without writing any output, the exclusive prefix of the chunk
+    // is assembled from the results published by the preceding chunks
+    // (decoupled look-back), and f3 scans the (still cached) chunk starting
+    // with that prefix.
+    struct scan_partitioner_single_pass_tag
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Upper limit for the amount of data (measured in intermediate
+        // results) handled by a single chunk of the single-pass scan. The
+        // input of a chunk should still be cached when f3 runs after f1.
+        static constexpr std::size_t single_pass_scan_chunk_bytes = 32768;
+
+        enum class scan_chunk_state : int
+        {
+            empty = 0,        // nothing was published yet
+            aggregate = 1,    // the reduction of the chunk is available
+            prefix = 2,       // the inclusive prefix of the chunk is available
+            failed = 3        // the chunk will never be completed
+        };
+
+        // The values of a chunk are written before its state is published
+        // (release) and are read only after the state was observed (acquire).
+        // They are optional as Result1 is not required to be default
+        // constructible.
+        template <typename Result1>
+        struct scan_chunk_status
+        {
+            std::atomic<scan_chunk_state> state{scan_chunk_state::empty};
+            std::optional<Result1> aggregate;
+            std::optional<Result1> prefix;
+        };
+
+        // The data shared by all tasks executing a single-pass scan.
+        template <typename FwdIter, typename Result1>
+        struct single_pass_scan_data
+        {
+            template <typename T>
+            single_pass_scan_data(FwdIter first, std::size_t count,
+                std::size_t chunk_size, T&& init)
+              : count_(count)
+              , chunk_size_(chunk_size)
+              , chunks_((count + chunk_size - 1) / chunk_size)
+              , init_(HPX_FORWARD(T, init))
+            {
+                begins_.reserve(chunks_.size());
+                for (std::size_t i = 0; i != chunks_.size(); ++i)
+                {
+                    begins_.push_back(first);
+                    if (i + 1 != chunks_.size())
+                    {
+                        std::advance(first, chunk_size_);
+                    }
+                }
+            }
+
+            std::size_t size(std::size_t chunk) const noexcept
+            {
+                return (std::min)(chunk_size_, count_ - chunk * chunk_size_);
+            }
+
+            // Determine the exclusive prefix of the given chunk from the
+            // results published by the preceding chunks. Returns false if
+            // one of those chunks failed.
+            template <typename F2>
+            bool look_back(std::size_t chunk, F2& f2, Result1& result)
+            {
+                std::optional<Result1> partial;
+                while (chunk-- != 0)
+                {
+                    scan_chunk_status<Result1>& status = chunks_[chunk];
+
+                    scan_chunk_state state = scan_chunk_state::empty;
+                    hpx::util::yield_while([&]() {
+                        state = status.state.load(std::memory_order_acquire);
+                        return state == scan_chunk_state::empty;
+                    });
+
+                    if (state == scan_chunk_state::failed)
+                    {
+                        return false;
+                    }
+
+                    if (state == scan_chunk_state::prefix)
+                    {
+                        result = partial ?
+                            HPX_INVOKE(f2, *status.prefix, *partial) :
+                            *status.prefix;
+                        return true;
+                    }
+
+                    if (partial)
+                    {
+                        partial.emplace(
+                            HPX_INVOKE(f2, *status.aggregate, *partial));
+                    }
+                    else
+                    {
+                        partial.emplace(*status.aggregate);
+                    }
+                }
+
+                // the first chunk always publishes its prefix directly
+                HPX_ASSERT(false);
+                return false;
+            }
+
+            void fail(std::size_t chunk) noexcept
+            {
+                chunks_[chunk].state.store(
+                    scan_chunk_state::failed, std::memory_order_release);
+                failed_.store(true, std::memory_order_relaxed);
+            }
+
+            // Run f1 and f3 on all chunks claimed by the calling task. Chunks
+            // are claimed in ascending order, every chunk this task waits for
+            // has therefore been claimed by a task which is already running.
+            template <typename F1, typename F2, typename F3>
+            void run(F1& f1, F2& f2, F3& f3)
+            {
+                while (!failed_.load(std::memory_order_relaxed))
+                {
+                    std::size_t const chunk = next_chunk_++;
+                    if (chunk >= chunks_.size())
+                    {
+                        break;
+                    }
+
+                    scan_chunk_status<Result1>& status = chunks_[chunk];
+                    try
+                    {
+                        status.aggregate.emplace(
+                            HPX_INVOKE(f1, begins_[chunk], size(chunk)));
+
+                        Result1 prefix = init_;
+                        if (chunk != 0)
+                        {
+                            // make the aggregate visible to the following
+                            // chunks before looking back
+                            status.state.store(scan_chunk_state::aggregate,
+                                std::memory_order_release);
+
+                            if (!look_back(chunk, f2, prefix))
+                            {
+                                fail(chunk);
+                                break;
+                            }
+                        }
+
+                        status.prefix.emplace(
+                            HPX_INVOKE(f2, prefix, *status.aggregate));
+                        status.state.store(scan_chunk_state::prefix,
+                            std::memory_order_release);
+
+                        HPX_INVOKE(f3, begins_[chunk], size(chunk), prefix);
+                    }
+                    catch (...)
+                    {
+                        fail(chunk);
+                        throw;
+                    }
+                }
+            }
+
+            // The exclusive prefixes of all chunks followed by the overall
+            // result, equivalent to the results of step 2 of the other scans.
+            std::vector<Result1> results() const
+            {
+                std::vector<Result1> f2results;
+                f2results.reserve(chunks_.size() + 1);
+                f2results.push_back(init_);
+                for (auto const& status : chunks_)
+                {
+                    HPX_ASSERT(status.prefix);
+                    f2results.push_back(*status.prefix);
+                }
+                return f2results;
+            }
+
+            std::size_t const count_;
+            std::size_t const chunk_size_;
+            std::vector<FwdIter> begins_;
+            std::vector<scan_chunk_status<Result1>> chunks_;
+            Result1 const init_;
+            std::atomic<std::size_t> next_chunk_{0};
+            std::atomic<bool> failed_{false};
+        };
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -319,6 +515,101 @@ namespace hpx { namespace parallel { namespace util {
 #endif
             }
 
+            // f1 reduces a chunk, f3 scans a chunk given its exclusive prefix
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_single_pass_tag, ExPolicy_ policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_UNUSED(policy);
+                HPX_UNUSED(first);
+                HPX_UNUSED(count);
+                HPX_UNUSED(init);
+                HPX_UNUSED(f1);
+                HPX_UNUSED(f2);
+                HPX_UNUSED(f3);
+                HPX_UNUSED(f4);
+                HPX_ASSERT(false);
+                return R();
+#else
+                using data_type = single_pass_scan_data<FwdIter, Result1>;
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::shared_ptr<data_type> data;
+                std::vector<hpx::future<Result2>> finalitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    HPX_ASSERT(count > 0);
+
+                    std::size_t const cores =
+                        execution::processing_units_count(
+                            policy.parameters(), policy.executor());
+
+                    std::size_t max_chunks =
+                        execution::maximal_number_of_chunks(
+                            policy.parameters(), policy.executor(), cores,
+                            count);
+
+                    std::size_t chunk_size = execution::get_chunk_size(
+                        policy.parameters(), policy.executor(),
+                        [](std::size_t) { return 0; }, cores, count);
+
+                    adjust_chunk_size_and_max_chunks(
+                        cores, count, max_chunks, chunk_size);
+
+                    // keep the chunks small enough for their input to stay
+                    // in the cache between the two passes over it
+                    chunk_size = (std::min)(chunk_size,
+                        (std::max)(std::size_t(1),
+                            single_pass_scan_chunk_bytes / sizeof(Result1)));
+
+                    data = std::make_shared<data_type>(
+                        first, count, chunk_size, HPX_FORWARD(T, init));
+
+                    // the chunks are distributed dynamically over one task
+                    // per core
+                    std::size_t const num_tasks =
+                        (std::min)(cores, data->chunks_.size());
+                    finalitems.reserve(num_tasks);
+
+                    for (std::size_t i = 0; i != num_tasks; ++i)
+                    {
+                        finalitems.push_back(execution::async_execute(
+                            policy.executor(),
+                            [data, f1, f2, f3]() mutable -> void {
+                                data->run(f1, f2, f3);
+                            }));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    if (data)
+                    {
+                        // no chunk can be completed anymore
+                        data->failed_.store(true, std::memory_order_relaxed);
+                    }
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                std::vector<Result1> f2results;
+                if (!hpx::wait_all_nothrow(finalitems) && errors.empty())
+                {
+                    f2results = data->results();
+                }
+                return reduce(HPX_MOVE(f2results), HPX_MOVE(finalitems),
+                    HPX_MOVE(errors), HPX_FORWARD(F4, f4));
+#endif
+            }
+
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
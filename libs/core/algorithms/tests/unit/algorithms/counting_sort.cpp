@@ -0,0 +1,180 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/counting_sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// covers the sequential and the parallel code paths
+std::size_t const sizes[] = {0, 1, 63, 1007, 100007, 1000007};
+
+// the keys of the widest range are sorted using the radix sort
+std::int64_t const key_ranges[] = {0, 1, 255, 65535,
+    (std::numeric_limits<std::int32_t>::max)()};
+
+template <typename T>
+std::vector<T> make_input(std::size_t size, std::int64_t range)
+{
+    using dist_type = std::conditional_t<(sizeof(T) < sizeof(int)),
+        std::conditional_t<std::is_signed_v<T>, int, unsigned>, T>;
+
+    // the keys are drawn from [-range, range] clamped to the key type
+    std::int64_t const limit =
+        std::uint64_t(range) < std::uint64_t((std::numeric_limits<T>::max)()) ?
+        range :
+        std::int64_t((std::numeric_limits<T>::max)());
+    std::uniform_int_distribution<dist_type> dis(
+        std::is_signed_v<T> ? dist_type(-limit) : dist_type(0),
+        dist_type(limit));
+
+    std::vector<T> v(size);
+    for (auto& e : v)
+    {
+        e = static_cast<T>(dis(gen));
+    }
+    return v;
+}
+
+template <typename T, typename... Policy>
+void test_counting_sort(Policy... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        for (std::int64_t range : key_ranges)
+        {
+            std::vector<T> c = make_input<T>(size, range);
+            std::vector<T> expected = c;
+            std::sort(expected.begin(), expected.end());
+
+            hpx::experimental::counting_sort(policy..., c.begin(), c.end());
+            HPX_TEST(c == expected);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_counting_sort_async(ExPolicy p)
+{
+    std::vector<std::uint32_t> c = make_input<std::uint32_t>(1000007, 1000);
+    std::vector<std::uint32_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::experimental::counting_sort(p, c.begin(), c.end());
+    f.wait();
+
+    HPX_TEST(c == expected);
+}
+
+template <typename... Policy>
+void test_counting_sort_projection(Policy... policy)
+{
+    // the order of elements with equal keys is preserved
+    for (std::size_t size : sizes)
+    {
+        for (std::int32_t range : {100, 1 << 30})
+        {
+            std::vector<std::pair<std::int32_t, std::size_t>> c(size);
+            std::uniform_int_distribution<std::int32_t> dis(-range, range);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                c[i] = std::make_pair(dis(gen), i);
+            }
+
+            std::vector<std::pair<std::int32_t, std::size_t>> expected = c;
+            std::stable_sort(expected.begin(), expected.end(),
+                [](auto const& lhs, auto const& rhs) {
+                    return lhs.first < rhs.first;
+                });
+
+            hpx::experimental::counting_sort(policy..., c.begin(), c.end(),
+                [](auto const& p) { return p.first; });
+            HPX_TEST(c == expected);
+        }
+    }
+
+    // keys of non-arithmetic elements
+    std::vector<std::string> s = {"ccc", "a", "", "bb", "dddd", "e", "ff"};
+    hpx::experimental::counting_sort(policy..., s.begin(), s.end(),
+        [](std::string const& str) { return str.size(); });
+    HPX_TEST((s ==
+        std::vector<std::string>{"", "a", "e", "bb", "ff", "ccc", "dddd"}));
+}
+
+template <typename... Policy>
+void test_counting_sort_all(Policy... policy)
+{
+    test_counting_sort<std::uint64_t>(policy...);
+    test_counting_sort<std::int32_t>(policy...);
+    test_counting_sort<std::int8_t>(policy...);
+    test_counting_sort<std::uint16_t>(policy...);
+    test_counting_sort_projection(policy...);
+}
+
+void counting_sort_test()
+{
+    using namespace hpx::execution;
+
+    test_counting_sort_all();
+    test_counting_sort_all(seq);
+    test_counting_sort_all(par);
+    test_counting_sort_all(par_unseq);
+
+    test_counting_sort_async(seq(task));
+    test_counting_sort_async(par(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    counting_sort_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,266 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// covers the sequential and the parallel code paths
+std::size_t const sizes[] = {0, 1, 1007, 100007, 1000007};
+
+// the number of bins is chosen such that the private counters of the tasks
+// are merged sequentially and in parallel
+std::size_t const bin_counts[] = {1, 7, 256, 10007};
+
+template <typename... Policy>
+void test_histogram_uniform_int(Policy... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::int32_t> c(size);
+        std::uniform_int_distribution<std::int32_t> dis(-1100, 1100);
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+        for (std::size_t num_bins : bin_counts)
+        {
+            std::int32_t const lower = -1000;
+            std::int32_t const upper = 1000;
+
+            std::vector<std::size_t> expected(num_bins);
+            for (std::int32_t v : c)
+            {
+                if (v >= lower && v < upper)
+                {
+                    ++expected[std::size_t(std::int64_t(v - lower) *
+                        std::int64_t(num_bins) / (upper - lower))];
+                }
+            }
+
+            std::vector<std::size_t> counts(num_bins, std::size_t(42));
+            auto result = hpx::experimental::histogram(policy..., c.begin(),
+                c.end(), counts.begin(), num_bins, lower, upper);
+
+            HPX_TEST(result == counts.end());
+            HPX_TEST(counts == expected);
+        }
+    }
+}
+
+template <typename... Policy>
+void test_histogram_uniform_float(Policy... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<double> c(size);
+        std::uniform_real_distribution<double> dis(-0.5, 10.5);
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+        if (size != 0)
+        {
+            // NaNs, infinities and the bounds themselves
+            c[0] = std::numeric_limits<double>::quiet_NaN();
+            c[size / 2] = std::numeric_limits<double>::infinity();
+            c[size / 3] = 0.0;
+            c[size / 4] = 10.0;
+        }
+
+        for (std::size_t num_bins : bin_counts)
+        {
+            std::vector<int> expected(num_bins);
+            std::size_t total = 0;
+            for (double v : c)
+            {
+                if (v >= 0.0 && v < 10.0)
+                {
+                    std::size_t const bin =
+                        std::size_t(v * (double(num_bins) / 10.0));
+                    ++expected[(std::min)(bin, num_bins - 1)];
+                    ++total;
+                }
+            }
+
+            std::vector<int> counts(num_bins);
+            hpx::experimental::histogram(policy..., c.begin(), c.end(),
+                counts.begin(), num_bins, 0.0, 10.0);
+
+            HPX_TEST(counts == expected);
+            HPX_TEST_EQ(std::size_t(std::accumulate(
+                            counts.begin(), counts.end(), std::size_t(0))),
+                total);
+        }
+    }
+}
+
+template <typename... Policy>
+void test_histogram_edges(Policy... policy)
+{
+    std::vector<double> const edges = {-10.0, -1.0, 0.0, 0.5, 2.0, 100.0};
+
+    for (std::size_t size : sizes)
+    {
+        std::vector<double> c(size);
+        std::uniform_real_distribution<double> dis(-20.0, 120.0);
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+        std::vector<std::size_t> expected(edges.size() - 1);
+        for (double v : c)
+        {
+            for (std::size_t i = 0; i != edges.size() - 1; ++i)
+            {
+                if (v >= edges[i] && v < edges[i + 1])
+                {
+                    ++expected[i];
+                }
+            }
+        }
+
+        std::vector<std::size_t> counts(edges.size() - 1);
+        auto result = hpx::experimental::histogram(policy..., c.begin(),
+            c.end(), edges.begin(), edges.end(), counts.begin());
+
+        HPX_TEST(result == counts.end());
+        HPX_TEST(counts == expected);
+    }
+
+    // a single edge does not define any bins
+    std::vector<double> c = {1.0, 2.0};
+    std::vector<std::size_t> counts;
+    hpx::experimental::histogram(policy..., c.begin(), c.end(), edges.begin(),
+        edges.begin() + 1, std::back_inserter(counts));
+    HPX_TEST(counts.empty());
+}
+
+template <typename... Policy>
+void test_histogram_projection(Policy... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::pair<std::string, std::uint16_t>> c(size);
+        std::uniform_int_distribution<std::uint16_t> dis(0, 99);
+        for (auto& e : c)
+        {
+            e.second = dis(gen);
+        }
+
+        std::vector<std::size_t> expected(10);
+        for (auto const& e : c)
+        {
+            ++expected[e.second / 10];
+        }
+
+        std::vector<std::size_t> counts(10);
+        hpx::experimental::histogram(policy..., c.begin(), c.end(),
+            counts.begin(), 10, 0, 100,
+            [](auto const& e) { return e.second; });
+
+        HPX_TEST(counts == expected);
+    }
+
+    // forward iterators
+    std::list<int> l = {5, 1, 7, 3, 3, 9, -1, 10};
+    std::vector<std::size_t> counts(5);
+    hpx::experimental::histogram(
+        policy..., l.begin(), l.end(), counts.begin(), 5, 0, 10);
+    HPX_TEST((counts == std::vector<std::size_t>{1, 2, 1, 1, 1}));
+}
+
+template <typename ExPolicy>
+void test_histogram_async(ExPolicy p)
+{
+    std::vector<std::uint64_t> c(1000007);
+    std::uniform_int_distribution<std::uint64_t> dis(0, 999);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::vector<std::size_t> expected(100);
+    for (std::uint64_t v : c)
+    {
+        ++expected[v / 10];
+    }
+
+    std::vector<std::size_t> counts(100);
+    auto f = hpx::experimental::histogram(p, c.begin(), c.end(),
+        counts.begin(), 100, std::uint64_t(0), std::uint64_t(1000));
+
+    HPX_TEST(f.get() == counts.end());
+    HPX_TEST(counts == expected);
+}
+
+template <typename... Policy>
+void test_histogram_all(Policy... policy)
+{
+    test_histogram_uniform_int(policy...);
+    test_histogram_uniform_float(policy...);
+    test_histogram_edges(policy...);
+    test_histogram_projection(policy...);
+}
+
+void histogram_test()
+{
+    using namespace hpx::execution;
+
+    test_histogram_all();
+    test_histogram_all(seq);
+    test_histogram_all(par);
+    test_histogram_all(par_unseq);
+
+    test_histogram_async(seq(task));
+    test_histogram_async(par(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    histogram_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -75,6 +75,42 @@ void inclusive_scan_test3()
     test_inclusive_scan3<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan4()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan4(seq, IteratorTag());
+    test_inclusive_scan4(par, IteratorTag());
+    test_inclusive_scan4(par_unseq, IteratorTag());
+
+    test_inclusive_scan4_async(seq(task), IteratorTag());
+    test_inclusive_scan4_async(par(task), IteratorTag());
+}
+
+void inclusive_scan_test4()
+{
+    test_inclusive_scan4<std::random_access_iterator_tag>();
+    test_inclusive_scan4<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan5()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan5(seq, IteratorTag());
+    test_inclusive_scan5(par, IteratorTag());
+}
+
+void inclusive_scan_test5()
+{
+    test_inclusive_scan5<std::random_access_iterator_tag>();
+    test_inclusive_scan5<std::forward_iterator_tag>();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_inclusive_scan_exception()
@@ -146,6 +182,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     inclusive_scan_test1();
     inclusive_scan_test2();
     inclusive_scan_test3();
+    inclusive_scan_test4();
+    inclusive_scan_test5();
 
     inclusive_scan_exception_test();
     inclusive_scan_bad_alloc_test();
@@ -12,6 +12,8 @@
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -334,6 +336,139 @@ void test_inclusive_scan3_async(ExPolicy p, IteratorTag)
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// the composition of affine maps x -> a * x + b is associative but not
+// commutative, the partition results have to be combined in order
+using affine_map = std::pair<std::uint32_t, std::uint32_t>;
+
+inline affine_map compose_affine_maps(affine_map const& f, affine_map const& g)
+{
+    return affine_map(f.first * g.first, g.first * f.second + g.second);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_inclusive_scan4(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<affine_map>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    // large enough to be split into many partitions
+    std::vector<affine_map> c(1000007);
+    std::vector<affine_map> d(c.size());
+    for (affine_map& m : c)
+    {
+        m = affine_map(
+            std::uint32_t(std::rand()) | 1, std::uint32_t(std::rand()));
+    }
+
+    affine_map const val(1, 0);
+    auto op = [](affine_map const& f, affine_map const& g) {
+        return compose_affine_maps(f, g);
+    };
+
+    hpx::inclusive_scan(policy, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(d), op, val);
+
+    // verify values
+    std::vector<affine_map> e(c.size());
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), val, op);
+
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+
+    // scan in place
+    hpx::inclusive_scan(policy, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(c), op, val);
+
+    HPX_TEST(std::equal(std::begin(c), std::end(c), std::begin(e)));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_inclusive_scan4_async(ExPolicy p, IteratorTag)
+{
+    typedef std::vector<affine_map>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<affine_map> c(1000007);
+    std::vector<affine_map> d(c.size());
+    for (affine_map& m : c)
+    {
+        m = affine_map(
+            std::uint32_t(std::rand()) | 1, std::uint32_t(std::rand()));
+    }
+
+    affine_map const val(1, 0);
+    auto op = [](affine_map const& f, affine_map const& g) {
+        return compose_affine_maps(f, g);
+    };
+
+    hpx::future<void> f = hpx::inclusive_scan(p, iterator(std::begin(c)),
+        iterator(std::end(c)), std::begin(d), op, val);
+    f.wait();
+
+    // verify values
+    std::vector<affine_map> e(c.size());
+    hpx::parallel::v1::detail::sequential_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), val, op);
+
+    HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the partial results of the scan are not required to be default
+// constructible
+struct no_default_value
+{
+    explicit no_default_value(std::size_t v)
+      : value(v)
+    {
+    }
+
+    std::size_t value;
+};
+
+inline bool operator==(no_default_value lhs, no_default_value rhs)
+{
+    return lhs.value == rhs.value;
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_inclusive_scan5(ExPolicy policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<no_default_value>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    // large enough to be split into many partitions
+    std::vector<no_default_value> c(100007, no_default_value(0));
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = no_default_value(i);
+    }
+    std::vector<no_default_value> d(c.size(), no_default_value(0));
+
+    no_default_value const val(1);
+    auto op = [](no_default_value const& lhs, no_default_value const& rhs) {
+        return no_default_value(lhs.value + rhs.value);
+    };
+
+    hpx::inclusive_scan(policy, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(d), op, val);
+
+    // verify values
+    std::size_t sum = val.value;
+    for (std::size_t i = 0; i != d.size(); ++i)
+    {
+        sum += i;
+        HPX_TEST_EQ(d[i].value, sum);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_inclusive_scan_exception(ExPolicy policy, IteratorTag)
@@ -0,0 +1,217 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// covers the sequential and the parallel code paths
+std::size_t const sizes[] = {0, 1, 63, 1007, 100007, 1000007};
+
+template <typename T>
+std::vector<T> make_input(std::size_t size, bool duplicates)
+{
+    std::vector<T> v(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+        std::uniform_int_distribution<int> few(-8, 8);
+        for (auto& e : v)
+        {
+            e = duplicates ? T(few(gen)) : dis(gen);
+        }
+    }
+    else
+    {
+        using dist_type = std::conditional_t<(sizeof(T) < sizeof(int)),
+            std::conditional_t<std::is_signed_v<T>, int, unsigned>, T>;
+        std::uniform_int_distribution<dist_type> dis(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::uniform_int_distribution<dist_type> few(0, 8);
+        for (auto& e : v)
+        {
+            e = static_cast<T>(duplicates ? few(gen) : dis(gen));
+        }
+    }
+    return v;
+}
+
+template <typename T, typename... Policy>
+void test_radix_sort(Policy... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        for (bool duplicates : {false, true})
+        {
+            std::vector<T> c = make_input<T>(size, duplicates);
+            std::vector<T> expected = c;
+            std::sort(expected.begin(), expected.end());
+
+            hpx::experimental::radix_sort(policy..., c.begin(), c.end());
+            HPX_TEST(c == expected);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_radix_sort_async(ExPolicy p)
+{
+    std::vector<std::uint64_t> c = make_input<std::uint64_t>(1000007, false);
+    std::vector<std::uint64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::experimental::radix_sort(p, c.begin(), c.end());
+    f.wait();
+
+    HPX_TEST(c == expected);
+}
+
+template <typename... Policy>
+void test_radix_sort_projection(Policy... policy)
+{
+    // the order of elements with equal keys is preserved
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::pair<std::int32_t, std::size_t>> c(size);
+        std::uniform_int_distribution<std::int32_t> dis(-100, 100);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            c[i] = std::make_pair(dis(gen), i);
+        }
+
+        std::vector<std::pair<std::int32_t, std::size_t>> expected = c;
+        std::stable_sort(expected.begin(), expected.end(),
+            [](auto const& lhs, auto const& rhs) {
+                return lhs.first < rhs.first;
+            });
+
+        hpx::experimental::radix_sort(policy..., c.begin(), c.end(),
+            [](auto const& p) { return p.first; });
+        HPX_TEST(c == expected);
+    }
+
+    // keys of non-arithmetic elements
+    std::vector<std::string> s = {"ccc", "a", "", "bb", "dddd", "e", "ff"};
+    hpx::experimental::radix_sort(policy..., s.begin(), s.end(),
+        [](std::string const& str) { return str.size(); });
+    HPX_TEST((s ==
+        std::vector<std::string>{"", "a", "e", "bb", "ff", "ccc", "dddd"}));
+}
+
+template <typename... Policy>
+void test_radix_sort_float_keys(Policy... policy)
+{
+    std::vector<double> c = {3.5, -0.0, 1e300, -1e-300, 0.0,
+        -std::numeric_limits<double>::infinity(), -2.25,
+        std::numeric_limits<double>::infinity(), 1e-300, -1e300};
+    std::vector<double> expected = {-std::numeric_limits<double>::infinity(),
+        -1e300, -2.25, -1e-300, -0.0, 0.0, 1e-300, 3.5, 1e300,
+        std::numeric_limits<double>::infinity()};
+
+    hpx::experimental::radix_sort(policy..., c.begin(), c.end());
+    HPX_TEST(c == expected);
+    HPX_TEST(std::signbit(c[4]) && !std::signbit(c[5]));
+}
+
+template <typename ExPolicy>
+void test_sort_by_key(ExPolicy policy)
+{
+    // arithmetic keys are sorted using the radix sort
+    std::vector<std::int64_t> keys = make_input<std::int64_t>(100007, false);
+    std::vector<std::int64_t> values = keys;
+    std::vector<std::int64_t> expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    hpx::parallel::sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(keys == expected);
+    HPX_TEST(values == expected);
+}
+
+template <typename... Policy>
+void test_radix_sort_all(Policy... policy)
+{
+    test_radix_sort<std::uint64_t>(policy...);
+    test_radix_sort<std::int32_t>(policy...);
+    test_radix_sort<std::int8_t>(policy...);
+    test_radix_sort<std::uint16_t>(policy...);
+    test_radix_sort<double>(policy...);
+    test_radix_sort<float>(policy...);
+    test_radix_sort_projection(policy...);
+    test_radix_sort_float_keys(policy...);
+}
+
+void radix_sort_test()
+{
+    using namespace hpx::execution;
+
+    test_radix_sort_all();
+    test_radix_sort_all(seq);
+    test_radix_sort_all(par);
+    test_radix_sort_all(par_unseq);
+
+    test_radix_sort_async(seq(task));
+    test_radix_sort_async(par(task));
+
+    test_sort_by_key(seq);
+    test_sort_by_key(par);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    radix_sort_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -145,6 +145,20 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+void test_sort3()
+{
+    using namespace hpx::execution;
+
+    // few distinct values, all values equal
+    test_sort3(seq, int(), 16);
+    test_sort3(par, int(), 16);
+    test_sort3(par, int(), 1);
+    test_sort3(par_unseq, double(), 1000);
+
+    test_sort3_async(par(task), int(), 16);
+    test_sort3_async(par(task), std::size_t(), 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -157,6 +171,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort3();
     sort_benchmark();
 
     return hpx::local::finalize();
@@ -13,6 +13,7 @@
 
 #include "test_utils.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iomanip>
@@ -630,6 +631,66 @@ void test_sort2_async(ExPolicy&& policy, T, Compare comp = Compare())
     HPX_TEST(is_sorted);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// many duplicate values
+template <typename ExPolicy, typename T>
+void test_sort3(ExPolicy&& policy, T, std::size_t distinct_values)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), "default", sync,
+        duplicates);
+
+    // Fill vector with few distinct values
+    std::vector<T> c(HPX_SORT_TEST_SIZE);
+    for (auto& val : c)
+    {
+        val = T(std::rand() % distinct_values);
+    }
+
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end());
+
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    // sort, blocking when seq, par, par_vec
+    hpx::sort(std::forward<ExPolicy>(policy), c.begin(), c.end());
+    std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+    bool is_sorted = (verify_(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(is_sorted);
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort3_async(ExPolicy&& policy, T, std::size_t distinct_values)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), "default", async,
+        duplicates);
+
+    // Fill vector with few distinct values
+    std::vector<T> c(HPX_SORT_TEST_SIZE);
+    for (auto& val : c)
+    {
+        val = T(std::rand() % distinct_values);
+    }
+
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end());
+
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    // sort, non blocking
+    hpx::future<void> f =
+        hpx::sort(std::forward<ExPolicy>(policy), c.begin(), c.end());
+    f.get();
+    std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now() - t;
+
+    bool is_sorted = (verify_(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(is_sorted);
+    HPX_TEST(c == expected);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // overload of test routine 1 for strings
 // call sort on a string array with no comparison operator
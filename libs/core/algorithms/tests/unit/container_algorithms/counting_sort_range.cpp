@@ -0,0 +1,138 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/container_algorithms/counting_sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename... Policy>
+void test_counting_sort(Policy... policy)
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1007),
+             std::size_t(1000007)})
+    {
+        std::vector<std::uint16_t> c(size);
+        std::uniform_int_distribution<std::uint16_t> dis(0, 1000);
+        for (auto& e : c)
+        {
+            e = dis(gen);
+        }
+
+        std::vector<std::uint16_t> expected = c;
+        std::sort(expected.begin(), expected.end());
+
+        auto result = hpx::ranges::experimental::counting_sort(policy..., c);
+        HPX_TEST(result == c.end());
+        HPX_TEST(c == expected);
+    }
+}
+
+template <typename... Policy>
+void test_counting_sort_projection(Policy... policy)
+{
+    // the order of elements with equal keys is preserved
+    std::vector<std::pair<std::int8_t, std::size_t>> c(100007);
+    std::uniform_int_distribution<int> dis(-128, 127);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = std::make_pair(std::int8_t(dis(gen)), i);
+    }
+
+    std::vector<std::pair<std::int8_t, std::size_t>> expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    hpx::ranges::experimental::counting_sort(
+        policy..., c, [](auto const& p) { return p.first; });
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_counting_sort_async(ExPolicy p)
+{
+    std::vector<std::int32_t> c(1000007);
+    std::uniform_int_distribution<std::int32_t> dis(-5000, 5000);
+    for (auto& e : c)
+    {
+        e = dis(gen);
+    }
+
+    std::vector<std::int32_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::ranges::experimental::counting_sort(p, c);
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+}
+
+void counting_sort_test()
+{
+    using namespace hpx::execution;
+
+    test_counting_sort();
+    test_counting_sort(seq);
+    test_counting_sort(par);
+    test_counting_sort(par_unseq);
+
+    test_counting_sort_projection();
+    test_counting_sort_projection(seq);
+    test_counting_sort_projection(par);
+    test_counting_sort_projection(par_unseq);
+
+    test_counting_sort_async(seq(task));
+    test_counting_sort_async(par(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    counting_sort_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,161 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/container_algorithms/histogram.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename... Policy>
+void test_histogram_uniform(Policy... policy)
+{
+    std::vector<float> c(100007);
+    std::uniform_real_distribution<float> dis(-1.0f, 101.0f);
+    for (auto& e : c)
+    {
+        e = dis(gen);
+    }
+
+    std::vector<std::size_t> expected(25);
+    for (float v : c)
+    {
+        if (v >= 0.0f && v < 100.0f)
+        {
+            std::size_t const bin = std::size_t(v * (25.0f / 100.0f));
+            ++expected[bin < 25 ? bin : 24];
+        }
+    }
+
+    std::vector<std::size_t> counts(25);
+    auto result = hpx::ranges::experimental::histogram(
+        policy..., c, counts.begin(), 25, 0.0f, 100.0f);
+
+    HPX_TEST(result == counts.end());
+    HPX_TEST(counts == expected);
+}
+
+template <typename... Policy>
+void test_histogram_edges(Policy... policy)
+{
+    std::vector<std::pair<std::int64_t, int>> c(100007);
+    std::uniform_int_distribution<std::int64_t> dis(-100, 10000);
+    for (auto& e : c)
+    {
+        e.first = dis(gen);
+    }
+
+    std::vector<std::int64_t> const edges = {0, 10, 100, 1000, 10000};
+
+    std::vector<std::size_t> expected(edges.size() - 1);
+    for (auto const& e : c)
+    {
+        for (std::size_t i = 0; i != edges.size() - 1; ++i)
+        {
+            if (e.first >= edges[i] && e.first < edges[i + 1])
+            {
+                ++expected[i];
+            }
+        }
+    }
+
+    std::vector<std::size_t> counts(edges.size() - 1);
+    auto result = hpx::ranges::experimental::histogram(policy..., c, edges,
+        counts.begin(), [](auto const& e) { return e.first; });
+
+    HPX_TEST(result == counts.end());
+    HPX_TEST(counts == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram_async(ExPolicy p)
+{
+    std::vector<int> c(100007);
+    std::uniform_int_distribution<int> dis(0, 99);
+    for (auto& e : c)
+    {
+        e = dis(gen);
+    }
+
+    std::vector<std::size_t> expected(10);
+    for (int v : c)
+    {
+        ++expected[v / 10];
+    }
+
+    std::vector<std::size_t> counts(10);
+    auto f = hpx::ranges::experimental::histogram(
+        p, c, counts.begin(), 10, 0, 100);
+
+    HPX_TEST(f.get() == counts.end());
+    HPX_TEST(counts == expected);
+}
+
+void histogram_test()
+{
+    using namespace hpx::execution;
+
+    test_histogram_uniform();
+    test_histogram_uniform(seq);
+    test_histogram_uniform(par);
+    test_histogram_uniform(par_unseq);
+
+    test_histogram_edges();
+    test_histogram_edges(seq);
+    test_histogram_edges(par);
+    test_histogram_edges(par_unseq);
+
+    test_histogram_async(seq(task));
+    test_histogram_async(par(task));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    histogram_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
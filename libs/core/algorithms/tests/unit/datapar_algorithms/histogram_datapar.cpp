@@ -0,0 +1,169 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/histogram.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_histogram(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = typename std::vector<T>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_real_distribution<T> dis(T(-1), T(11));
+    for (std::size_t size : {0, 1, 17, 10007, 1000007})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+        {
+            v = dis(gen);
+        }
+        if (size > 3)
+        {
+            // NaNs, infinities and the bounds themselves
+            c[1] = std::numeric_limits<T>::quiet_NaN();
+            c[2] = -std::numeric_limits<T>::infinity();
+            c[size / 2] = T(0);
+            c[size - 1] = T(10);
+        }
+
+        for (std::size_t num_bins : {1, 7, 1000})
+        {
+            // an unaligned start of the sequence
+            for (std::size_t offset : {0, 1})
+            {
+                if (offset > size)
+                    continue;
+
+                // the scalar code computes the reference counts
+                std::vector<std::size_t> expected(num_bins);
+                hpx::experimental::histogram(std::begin(c) + offset,
+                    std::end(c), std::begin(expected), num_bins, T(0), T(10));
+
+                std::vector<std::size_t> counts(num_bins);
+                hpx::experimental::histogram(policy,
+                    iterator(std::begin(c) + offset), iterator(std::end(c)),
+                    std::begin(counts), num_bins, T(0), T(10));
+
+                HPX_TEST(counts == expected);
+            }
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_histogram_fallback(ExPolicy policy)
+{
+    // integral values and custom edges are counted by the scalar code
+    std::uniform_int_distribution<std::int32_t> dis(-10, 110);
+    std::vector<std::int32_t> c(10007);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    std::vector<std::size_t> expected(10);
+    for (std::int32_t v : c)
+    {
+        if (v >= 0 && v < 100)
+            ++expected[v / 10];
+    }
+
+    std::vector<std::size_t> counts(10);
+    hpx::experimental::histogram(policy, std::begin(c), std::end(c),
+        std::begin(counts), 10, 0, 100);
+    HPX_TEST(counts == expected);
+
+    std::vector<std::int32_t> const edges = {
+        0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100};
+    std::fill(std::begin(counts), std::end(counts), std::size_t(0));
+    hpx::experimental::histogram(policy, std::begin(c), std::end(c),
+        std::begin(edges), std::end(edges), std::begin(counts));
+    HPX_TEST(counts == expected);
+}
+
+template <typename IteratorTag>
+void test_histogram()
+{
+    using namespace hpx::execution;
+
+    test_histogram<float>(simd, IteratorTag());
+    test_histogram<float>(par_simd, IteratorTag());
+    test_histogram<double>(simd, IteratorTag());
+    test_histogram<double>(par_simd, IteratorTag());
+}
+
+void histogram_test()
+{
+    using namespace hpx::execution;
+
+    test_histogram<std::random_access_iterator_tag>();
+    test_histogram<std::forward_iterator_tag>();
+
+    test_histogram_fallback(simd);
+    test_histogram_fallback(par_simd);
+
+    std::vector<double> c(100007, 2.5);
+    std::vector<std::size_t> counts(4);
+    auto f = hpx::experimental::histogram(par_simd(task), std::begin(c),
+        std::end(c), std::begin(counts), 4, 0.0, 10.0);
+    f.wait();
+    HPX_TEST((counts == std::vector<std::size_t>{0, 100007, 0, 0}));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    histogram_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
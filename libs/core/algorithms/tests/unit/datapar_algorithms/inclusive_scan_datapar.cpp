@@ -0,0 +1,126 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/inclusive_scan_tests.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the partitions of sums of arithmetic values are reduced using SIMD
+template <typename T, typename ExPolicy, typename Op>
+void test_inclusive_scan_plus(ExPolicy policy, Op op)
+{
+    std::uniform_int_distribution<int> dis(-100, 100);
+    for (std::size_t size : {0, 1, 17, 10007, 1000007})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+        {
+            v = T(dis(gen));
+        }
+
+        // an unaligned start of the input sequence
+        for (std::size_t offset : {0, 1})
+        {
+            if (offset > size)
+                continue;
+
+            std::vector<T> d(size - offset);
+            hpx::inclusive_scan(
+                policy, std::begin(c) + offset, std::end(c), std::begin(d), op);
+
+            std::vector<T> e(size - offset);
+            hpx::parallel::v1::detail::sequential_inclusive_scan_noinit(
+                std::begin(c) + offset, std::end(c), std::begin(e), op);
+
+            HPX_TEST(d == e);
+        }
+    }
+}
+
+template <typename IteratorTag>
+void test_inclusive_scan()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan1(simd, IteratorTag());
+    test_inclusive_scan1(par_simd, IteratorTag());
+    test_inclusive_scan1_async(simd(task), IteratorTag());
+    test_inclusive_scan1_async(par_simd(task), IteratorTag());
+
+    test_inclusive_scan2(simd, IteratorTag());
+    test_inclusive_scan2(par_simd, IteratorTag());
+    test_inclusive_scan2_async(simd(task), IteratorTag());
+    test_inclusive_scan2_async(par_simd(task), IteratorTag());
+
+    test_inclusive_scan3(simd, IteratorTag());
+    test_inclusive_scan3(par_simd, IteratorTag());
+    test_inclusive_scan3_async(simd(task), IteratorTag());
+    test_inclusive_scan3_async(par_simd(task), IteratorTag());
+}
+
+void inclusive_scan_test()
+{
+    using namespace hpx::execution;
+
+    test_inclusive_scan<std::random_access_iterator_tag>();
+    test_inclusive_scan<std::forward_iterator_tag>();
+
+    // the integral sums have to be exact
+    test_inclusive_scan_plus<std::int32_t>(simd, std::plus<>());
+    test_inclusive_scan_plus<std::int32_t>(par_simd, std::plus<>());
+    test_inclusive_scan_plus<std::int64_t>(par_simd, std::plus<std::int64_t>());
+    test_inclusive_scan_plus<std::uint8_t>(par_simd, std::plus<>());
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    inclusive_scan_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_minmax_element(ExPolicy policy, IteratorTag, int range)
+{
+    using base_iterator = typename std::vector<T>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<int> dis(-range, range);
+    for (std::size_t size : {1, 2, 17, 10007, 100007})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+        {
+            v = T(dis(gen));
+        }
+
+        // an unaligned start of the sequence
+        for (std::size_t offset : {0, 1})
+        {
+            if (offset >= size)
+                continue;
+
+            auto r = hpx::minmax_element(policy,
+                iterator(std::begin(c) + offset), iterator(std::end(c)));
+            auto expected =
+                std::minmax_element(std::begin(c) + offset, std::end(c));
+
+            // the first minimum and the last maximum are reported
+            HPX_TEST(r.min.base() == expected.first);
+            HPX_TEST(r.max.base() == expected.second);
+
+            auto rc = hpx::minmax_element(policy,
+                iterator(std::begin(c) + offset), iterator(std::end(c)),
+                std::greater<T>());
+            auto expected_c = std::minmax_element(
+                std::begin(c) + offset, std::end(c), std::greater<T>());
+
+            HPX_TEST(rc.min.base() == expected_c.first);
+            HPX_TEST(rc.max.base() == expected_c.second);
+        }
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_minmax_element_all(ExPolicy policy, IteratorTag)
+{
+    // many duplicates of the extreme values
+    test_minmax_element<std::int32_t>(policy, IteratorTag(), 3);
+    test_minmax_element<std::int32_t>(policy, IteratorTag(), 1000000);
+    test_minmax_element<std::uint8_t>(policy, IteratorTag(), 100);
+    test_minmax_element<double>(policy, IteratorTag(), 3);
+    test_minmax_element<float>(policy, IteratorTag(), 1000000);
+}
+
+template <typename ExPolicy>
+void test_minmax_element_sorted(ExPolicy policy)
+{
+    // every pack changes the result
+    std::vector<std::int64_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::int64_t(0));
+
+    auto r = hpx::minmax_element(policy, std::begin(c), std::end(c));
+    HPX_TEST(r.min == std::begin(c));
+    HPX_TEST(r.max == std::end(c) - 1);
+
+    std::reverse(std::begin(c), std::end(c));
+    r = hpx::minmax_element(policy, std::begin(c), std::end(c));
+    HPX_TEST(r.min == std::end(c) - 1);
+    HPX_TEST(r.max == std::begin(c));
+}
+
+template <typename IteratorTag>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element_all(simd, IteratorTag());
+    test_minmax_element_all(par_simd, IteratorTag());
+}
+
+void minmax_element_test()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element<std::random_access_iterator_tag>();
+    test_minmax_element<std::forward_iterator_tag>();
+
+    test_minmax_element_sorted(simd);
+    test_minmax_element_sorted(par_simd);
+
+    std::vector<std::int32_t> c(10007);
+    std::iota(std::begin(c), std::end(c), 0);
+    auto f = hpx::minmax_element(par_simd(task), std::begin(c), std::end(c));
+    auto r = f.get();
+    HPX_TEST(r.min == std::begin(c));
+    HPX_TEST(r.max == std::end(c) - 1);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
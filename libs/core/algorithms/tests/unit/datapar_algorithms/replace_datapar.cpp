@@ -0,0 +1,137 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/replace.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T, typename ExPolicy, typename IteratorTag, typename T1,
+    typename T2>
+void test_replace(ExPolicy policy, IteratorTag, T1 old_value, T2 new_value)
+{
+    using base_iterator = typename std::vector<T>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<int> dis(0, 7);
+    for (std::size_t size : {0, 1, 17, 10007, 100007})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+        {
+            v = T(dis(gen));
+        }
+
+        // an unaligned start of the sequence
+        for (std::size_t offset : {0, 1})
+        {
+            if (offset > size)
+                continue;
+
+            std::vector<T> d = c;
+            std::vector<T> e = c;
+
+            hpx::replace(policy, iterator(std::begin(d) + offset),
+                iterator(std::end(d)), old_value, new_value);
+            std::replace(std::begin(e) + offset, std::end(e), T(old_value),
+                T(new_value));
+
+            HPX_TEST(d == e);
+        }
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_replace_all(ExPolicy policy, IteratorTag)
+{
+    test_replace<std::int32_t>(policy, IteratorTag(), 3, 42);
+    test_replace<std::uint16_t>(policy, IteratorTag(), std::uint16_t(5), 7);
+    test_replace<double>(policy, IteratorTag(), 1.0, -1.5);
+    test_replace<float>(policy, IteratorTag(), 2.0f, 0.0f);
+
+    // the old value is converted to the value type
+    test_replace<double>(policy, IteratorTag(), 4, 8);
+
+    // 259 is never equal to an unsigned char holding 3
+    std::vector<std::uint8_t> c(1007, 3);
+    hpx::replace(policy, std::begin(c), std::end(c), 259, 1);
+    HPX_TEST(std::all_of(
+        std::begin(c), std::end(c), [](std::uint8_t v) { return v == 3; }));
+}
+
+template <typename IteratorTag>
+void test_replace()
+{
+    using namespace hpx::execution;
+
+    test_replace_all(simd, IteratorTag());
+    test_replace_all(par_simd, IteratorTag());
+}
+
+void replace_test()
+{
+    using namespace hpx::execution;
+
+    test_replace<std::random_access_iterator_tag>();
+    test_replace<std::forward_iterator_tag>();
+
+    std::vector<std::int32_t> c(10007, 1);
+    auto f = hpx::replace(par_simd(task), std::begin(c), std::end(c), 1, 2);
+    f.wait();
+    HPX_TEST(std::all_of(
+        std::begin(c), std::end(c), [](std::int32_t v) { return v == 2; }));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    replace_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,147 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/include/datapar.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/search.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T, typename ExPolicy, typename IteratorTag>
+void test_search(ExPolicy policy, IteratorTag, int range)
+{
+    using base_iterator = typename std::vector<T>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::uniform_int_distribution<int> dis(0, range);
+    for (std::size_t size : {1, 17, 10007, 100007})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+        {
+            v = T(dis(gen));
+        }
+
+        std::uniform_int_distribution<std::size_t> pos(0, size - 1);
+        for (std::size_t needle_size : {1, 2, 5})
+        {
+            // a needle taken from the sequence and a random one
+            std::vector<T> h(needle_size);
+            std::size_t start = pos(gen);
+            for (std::size_t i = 0; i != needle_size; ++i)
+            {
+                h[i] = start + i < size ? c[start + i] : T(dis(gen));
+            }
+
+            for (std::size_t offset : {0, 1})
+            {
+                if (offset >= size)
+                    continue;
+
+                auto r = hpx::search(policy, iterator(std::begin(c) + offset),
+                    iterator(std::end(c)), std::begin(h), std::end(h));
+                auto expected = std::search(std::begin(c) + offset,
+                    std::end(c), std::begin(h), std::end(h));
+
+                if (expected != std::end(c))
+                {
+                    HPX_TEST(r.base() == expected);
+                }
+                else
+                {
+                    // no match
+                    HPX_TEST(std::search(r.base(), std::end(c), std::begin(h),
+                                 std::end(h)) == std::end(c));
+                }
+            }
+        }
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_search_all(ExPolicy policy, IteratorTag)
+{
+    // frequent candidates that are not matches
+    test_search<std::int32_t>(policy, IteratorTag(), 1);
+    test_search<std::int32_t>(policy, IteratorTag(), 1000);
+    test_search<std::uint8_t>(policy, IteratorTag(), 3);
+    test_search<double>(policy, IteratorTag(), 10);
+}
+
+template <typename IteratorTag>
+void test_search()
+{
+    using namespace hpx::execution;
+
+    test_search_all(simd, IteratorTag());
+    test_search_all(par_simd, IteratorTag());
+}
+
+void search_test()
+{
+    using namespace hpx::execution;
+
+    test_search<std::random_access_iterator_tag>();
+    test_search<std::forward_iterator_tag>();
+
+    std::vector<std::int32_t> c(10007);
+    std::iota(std::begin(c), std::end(c), 0);
+    std::vector<std::int32_t> h = {5000, 5001, 5002};
+    auto f = hpx::search(par_simd(task), std::begin(c), std::end(c),
+        std::begin(h), std::end(h));
+    HPX_TEST(f.get() == std::begin(c) + 5000);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    search_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -855,6 +855,18 @@ namespace hpx {
         /// Predefined launch policy representing asynchronous execution
         HPX_CORE_EXPORT static const detail::async_policy async;
 
+        /// Predefined launch policy representing asynchronous execution of
+        /// short tasks that are known not to suspend. The new thread runs
+        /// without a stack of its own (on the stack of the worker thread that
+        /// executes it), which avoids the cost of allocating and switching
+        /// stacks. A running stackless thread can't be moved onto a stack,
+        /// thus there is no fallback to a stackful thread: should the task
+        /// attempt to suspend nevertheless (e.g. by waiting for a future
+        /// which is not ready yet), an exception of type hpx::exception
+        /// (invalid_status) is thrown instead of blocking the worker thread
+        /// executing it. Work that may block should use launch::async.
+        HPX_CORE_EXPORT static const detail::async_policy non_suspending;
+
         /// Predefined launch policy representing asynchronous execution.The
         /// new thread is executed in a preferred way
         HPX_CORE_EXPORT static const detail::fork_policy fork;
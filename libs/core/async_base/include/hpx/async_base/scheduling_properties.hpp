@@ -78,4 +78,14 @@ namespace hpx { namespace execution { namespace experimental {
       : detail::property_base<get_annotation_t>
     {
     } get_annotation{};
+
+    inline constexpr struct with_deadline_t final
+      : detail::property_base<with_deadline_t>
+    {
+    } with_deadline{};
+
+    inline constexpr struct get_deadline_t final
+      : detail::property_base<get_deadline_t>
+    {
+    } get_deadline{};
 }}}    // namespace hpx::execution::experimental
@@ -15,6 +15,9 @@ namespace hpx {
     ///////////////////////////////////////////////////////////////////////////
     const detail::async_policy launch::async =
         detail::async_policy{threads::thread_priority::default_};
+    const detail::async_policy launch::non_suspending =
+        detail::async_policy{threads::thread_priority::default_,
+            threads::thread_stacksize::nostack};
     const detail::fork_policy launch::fork =
         detail::fork_policy{threads::thread_priority::default_};
     const detail::sync_policy launch::sync = detail::sync_policy{};
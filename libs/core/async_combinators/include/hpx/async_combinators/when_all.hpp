@@ -128,6 +128,36 @@ namespace hpx {
         typename Container = vector<
             future<typename std::iterator_traits<InputIter>::value_type>>>
     hpx::future<Container> when_all_n(InputIter begin, std::size_t count);
+
+    namespace experimental {
+        /// The function \a when_all_into is an operator allowing to join on
+        /// the results of all given futures. Instead of returning the futures
+        /// themselves, the result of each of the futures is stored into the
+        /// caller-provided storage as soon as it becomes available.
+        ///
+        /// \param first    [in] The iterator pointing to the first element of
+        ///                 a sequence of \a future or \a shared_future objects
+        ///                 for which \a when_all_into should wait.
+        /// \param last     [in] The iterator pointing to the last element of a
+        ///                 sequence of \a future or \a shared_future objects
+        ///                 for which \a when_all_into should wait.
+        /// \param dest     [in] The random access iterator pointing to the
+        ///                 first element of the storage receiving the results.
+        ///                 The result of the n-th input future is assigned to
+        ///                 dest[n].
+        ///
+        /// \return   Returns a future which becomes ready once all results
+        ///           have been stored. If any of the input futures holds an
+        ///           exception, the returned future holds one of those
+        ///           exceptions.
+        ///
+        /// \note     The futures in the input sequence are invalidated, shared
+        ///           futures are not. The storage referred to by \a dest has
+        ///           to be kept alive until the returned future becomes ready.
+        template <typename InputIter, typename RandIter>
+        hpx::future<void> when_all_into(
+            InputIter first, InputIter last, RandIter dest);
+    }    // namespace experimental
 }    // namespace hpx
 
 #else    // DOXYGEN
@@ -135,6 +165,7 @@ namespace hpx {
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/detail/future_transforms.hpp>
 #include <hpx/futures/future.hpp>
@@ -144,9 +175,15 @@ namespace hpx {
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
+#include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <exception>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -241,6 +278,177 @@ namespace hpx {
             return hpx::traits::future_access<
                 typename frame_type::type>::create(HPX_MOVE(frame));
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Joining a homogeneous range of futures does not need to traverse
+        // the futures one by one. The frame is the only shared state created.
+        // It counts down the futures which are not ready yet, each of them
+        // holding a continuation referring back to the frame.
+        template <typename Container>
+        class when_all_range_frame : public future_data<Container>
+        {
+        public:
+            using base_type = hpx::lcos::detail::future_data<Container>;
+            using init_no_addref = typename base_type::init_no_addref;
+
+            when_all_range_frame(init_no_addref no_addref, Container&& values)
+              : base_type(no_addref)
+              , values_(HPX_MOVE(values))
+              , remaining_(0)
+            {
+            }
+
+            void start()
+            {
+                // keep the frame alive until the last continuation has run
+                keep_alive_.reset(this);
+
+                // the additional count prevents the frame from being
+                // completed before all continuations have been attached
+                remaining_.store(
+                    values_.size() + 1, std::memory_order_relaxed);
+
+                std::size_t ready = 1;
+                for (auto const& f : values_)
+                {
+                    if (!attach_when_not_ready(
+                            traits::detail::get_shared_state(f),
+                            [this]() { count_down(1); }))
+                    {
+                        ++ready;
+                    }
+                }
+                count_down(ready);
+            }
+
+        private:
+            void count_down(std::size_t n)
+            {
+                if (remaining_.fetch_sub(n, std::memory_order_acq_rel) == n)
+                {
+                    hpx::intrusive_ptr<when_all_range_frame> self =
+                        HPX_MOVE(keep_alive_);
+                    this->set_value(HPX_MOVE(values_));
+                }
+            }
+
+            Container values_;
+            std::atomic<std::size_t> remaining_;
+            hpx::intrusive_ptr<when_all_range_frame> keep_alive_;
+        };
+
+        template <typename Container>
+        hpx::future<Container> when_all_range_impl(Container&& values)
+        {
+            using frame_type = when_all_range_frame<Container>;
+            using no_addref = typename frame_type::init_no_addref;
+
+            hpx::intrusive_ptr<frame_type> frame(
+                new frame_type(no_addref{}, HPX_MOVE(values)), false);
+            frame->start();
+
+            return hpx::traits::future_access<hpx::future<Container>>::create(
+                HPX_MOVE(frame));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Stores the results of the joined futures into caller-provided
+        // storage while the futures become ready.
+        template <typename RandIter>
+        class when_all_into_frame : public future_data<void>
+        {
+        public:
+            using base_type = hpx::lcos::detail::future_data<void>;
+            using init_no_addref = typename base_type::init_no_addref;
+
+            when_all_into_frame(init_no_addref no_addref, RandIter dest)
+              : base_type(no_addref)
+              , dest_(HPX_MOVE(dest))
+              , remaining_(1)
+              , has_exception_(false)
+            {
+                // keep the frame alive until the last continuation has run
+                keep_alive_.reset(this);
+            }
+
+            template <typename Future>
+            void add(Future&& f, std::size_t index)
+            {
+                auto state =
+                    traits::detail::get_shared_state(HPX_FORWARD(Future, f));
+
+                remaining_.fetch_add(1, std::memory_order_relaxed);
+                if (!attach_when_not_ready(state, [this, state, index]() {
+                        store<Future>(state, index);
+                    }))
+                {
+                    store<Future>(state, index);
+                }
+            }
+
+            void finish()
+            {
+                count_down();
+            }
+
+        private:
+            template <typename Future, typename SharedState>
+            void store(SharedState const& state, std::size_t index) noexcept
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        if (state.get() == nullptr)
+                        {
+                            HPX_THROW_EXCEPTION(hpx::no_state,
+                                "hpx::experimental::when_all_into",
+                                "the future has no valid shared state");
+                        }
+
+                        auto* result = state->get_result();
+                        if constexpr (hpx::traits::is_shared_future_v<
+                                          std::decay_t<Future>>)
+                        {
+                            dest_[index] = *result;
+                        }
+                        else
+                        {
+                            dest_[index] = HPX_MOVE(*result);
+                        }
+                    },
+                    [&](std::exception_ptr e) {
+                        bool expected = false;
+                        if (has_exception_.compare_exchange_strong(
+                                expected, true, std::memory_order_relaxed))
+                        {
+                            exception_ = HPX_MOVE(e);
+                        }
+                    });
+                count_down();
+            }
+
+            void count_down()
+            {
+                if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    hpx::intrusive_ptr<when_all_into_frame> self =
+                        HPX_MOVE(keep_alive_);
+                    if (exception_)
+                    {
+                        this->set_exception(HPX_MOVE(exception_));
+                    }
+                    else
+                    {
+                        this->set_value(util::unused);
+                    }
+                }
+            }
+
+            RandIter dest_;
+            std::atomic<std::size_t> remaining_;
+            std::atomic<bool> has_exception_;
+            std::exception_ptr exception_;
+            hpx::intrusive_ptr<when_all_into_frame> keep_alive_;
+        };
     }}    // namespace lcos::detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -251,14 +459,23 @@ namespace hpx {
         return hpx::lcos::detail::when_all_impl(HPX_FORWARD(Args, args)...);
     }
 
+    template <typename Range,
+        typename Enable = std::enable_if_t<
+            hpx::traits::is_future_range_v<std::decay_t<Range>>>>
+    hpx::future<hpx::traits::acquire_future_t<Range>> when_all(Range&& values)
+    {
+        return hpx::lcos::detail::when_all_range_impl(
+            hpx::traits::acquire_future_disp()(HPX_FORWARD(Range, values)));
+    }
+
     template <typename Iterator,
         typename Container =
             std::vector<hpx::lcos::detail::future_iterator_traits_t<Iterator>>,
         typename Enable =
             std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
-    decltype(auto) when_all(Iterator begin, Iterator end)
+    hpx::future<Container> when_all(Iterator begin, Iterator end)
     {
-        return hpx::lcos::detail::when_all_impl(
+        return hpx::lcos::detail::when_all_range_impl(
             hpx::lcos::detail::acquire_future_iterators<Iterator, Container>(
                 begin, end));
     }
@@ -268,13 +485,42 @@ namespace hpx {
             std::vector<hpx::lcos::detail::future_iterator_traits_t<Iterator>>,
         typename Enable =
             std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
-    decltype(auto) when_all_n(Iterator begin, std::size_t count)
+    hpx::future<Container> when_all_n(Iterator begin, std::size_t count)
     {
-        return hpx::lcos::detail::when_all_impl(
+        return hpx::lcos::detail::when_all_range_impl(
             hpx::lcos::detail::acquire_future_n<Iterator, Container>(
                 begin, count));
     }
 
+    namespace experimental {
+
+        template <typename Iterator, typename RandIter,
+            typename Enable =
+                std::enable_if_t<hpx::traits::is_iterator_v<Iterator>>>
+        hpx::future<void> when_all_into(
+            Iterator begin, Iterator end, RandIter dest)
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "when_all_into requires a random access output iterator");
+
+            using frame_type = hpx::lcos::detail::when_all_into_frame<RandIter>;
+            using no_addref = typename frame_type::init_no_addref;
+
+            hpx::intrusive_ptr<frame_type> frame(
+                new frame_type(no_addref{}, HPX_MOVE(dest)), false);
+
+            std::size_t index = 0;
+            for (/**/; begin != end; ++begin)
+            {
+                frame->add(hpx::traits::acquire_future_disp()(*begin), index++);
+            }
+            frame->finish();
+
+            return hpx::traits::future_access<hpx::future<void>>::create(
+                HPX_MOVE(frame));
+        }
+    }    // namespace experimental
+
     inline hpx::future<hpx::tuple<>>    //-V524
     when_all()
     {
@@ -126,13 +126,17 @@ namespace hpx {
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/deferred_call.hpp>
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/future_transforms.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/futures_factory.hpp>
 #include <hpx/futures/traits/acquire_future.hpp>
+#include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/detail/future_traits.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/util/detail/reserve.hpp>
 
@@ -373,6 +377,86 @@ namespace hpx {
             std::atomic<std::size_t> index_;
             bool goal_reached_on_calling_thread_;
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // For homogeneous ranges the frame is the only shared state created,
+        // no thread is spawned. The frame is completed once the first of the
+        // futures became ready and all continuations have been attached.
+        template <typename Sequence>
+        class when_any_range_frame
+          : public future_data<when_any_result<Sequence>>
+        {
+        public:
+            using result_type = when_any_result<Sequence>;
+            using base_type = hpx::lcos::detail::future_data<result_type>;
+            using init_no_addref = typename base_type::init_no_addref;
+
+            when_any_range_frame(init_no_addref no_addref, Sequence&& values)
+              : base_type(no_addref)
+              , result_(HPX_MOVE(values))
+              , index_(result_type::index_error())
+              , pending_(2)
+            {
+            }
+
+            void start()
+            {
+                std::size_t idx = 0;
+                for (auto const& f : result_.futures)
+                {
+                    // don't touch any futures once one of them is ready
+                    if (index_.load(std::memory_order_acquire) !=
+                        result_type::index_error())
+                    {
+                        break;
+                    }
+
+                    if (!attach_when_not_ready(
+                            traits::detail::get_shared_state(f),
+                            [frame = hpx::intrusive_ptr<when_any_range_frame>(
+                                 this),
+                                idx]() { frame->on_future_ready(idx); }))
+                    {
+                        on_future_ready(idx);
+                        break;
+                    }
+                    ++idx;
+                }
+
+                // an empty sequence completes right away
+                if (idx == 0 && result_.futures.empty())
+                {
+                    count_down();
+                }
+                count_down();
+            }
+
+        private:
+            void on_future_ready(std::size_t idx)
+            {
+                std::size_t expected = result_type::index_error();
+                if (index_.compare_exchange_strong(
+                        expected, idx, std::memory_order_acq_rel))
+                {
+                    count_down();
+                }
+            }
+
+            // the result is set after both, the first future has become
+            // ready and all continuations have been attached
+            void count_down()
+            {
+                if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    result_.index = index_.load(std::memory_order_relaxed);
+                    this->set_value(HPX_MOVE(result_));
+                }
+            }
+
+            result_type result_;
+            std::atomic<std::size_t> index_;
+            std::atomic<int> pending_;
+        };
     }}    // namespace lcos::detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -382,19 +466,18 @@ namespace hpx {
     when_any(Range&& values)
     {
         using result_type = std::decay_t<Range>;
-
-        auto f = std::make_shared<lcos::detail::when_any<result_type>>(
-            hpx::traits::acquire_future<result_type>()(values));
-
-        lcos::local::futures_factory<hpx::when_any_result<result_type>()> p(
-            [f = HPX_MOVE(f)]() -> hpx::when_any_result<result_type> {
-                return (*f)();
-            });
-
-        auto result = p.get_future();
-        p.apply();
-
-        return result;
+        using frame_type = lcos::detail::when_any_range_frame<result_type>;
+        using no_addref = typename frame_type::init_no_addref;
+
+        hpx::intrusive_ptr<frame_type> frame(
+            new frame_type(no_addref{},
+                hpx::traits::acquire_future<result_type>()(values)),
+            false);
+        frame->start();
+
+        return hpx::traits::future_access<
+            hpx::future<hpx::when_any_result<result_type>>>::
+            create(HPX_MOVE(frame));
     }
 
     template <typename Iterator,
@@ -12,9 +12,11 @@
 #include <hpx/modules/testing.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -249,6 +251,81 @@ void test_when_all_deferred_futures()
     HPX_TEST(hpx::get<1>(result).is_ready());
 }
 
+void test_when_all_many_futures()
+{
+    // mix of ready, deferred, and not yet ready futures
+    std::vector<hpx::future<int>> futures;
+    for (int i = 0; i != 1000; ++i)
+    {
+        switch (i % 3)
+        {
+        case 0:
+            futures.push_back(hpx::make_ready_future(i));
+            break;
+        case 1:
+            futures.push_back(hpx::async(hpx::launch::deferred, [i]() {
+                return i;
+            }));
+            break;
+        default:
+            futures.push_back(hpx::async([i]() { return i; }));
+            break;
+        }
+    }
+
+    std::vector<hpx::future<int>> result = hpx::when_all(futures).get();
+
+    HPX_TEST_EQ(result.size(), std::size_t(1000));
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(result[i].get(), i);
+    }
+
+    // an empty range is ready right away
+    std::vector<hpx::future<int>> empty;
+    HPX_TEST(hpx::when_all(empty).is_ready());
+}
+
+void test_when_all_into()
+{
+    std::vector<hpx::future<int>> futures;
+    for (int i = 0; i != 100; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            futures.push_back(hpx::make_ready_future(i));
+        }
+        else
+        {
+            futures.push_back(hpx::async([i]() { return i; }));
+        }
+    }
+
+    std::vector<int> results(futures.size());
+    hpx::experimental::when_all_into(
+        futures.begin(), futures.end(), results.begin())
+        .get();
+
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(!futures[i].valid());
+        HPX_TEST_EQ(results[i], i);
+    }
+
+    // exceptions are propagated to the returned future
+    std::vector<hpx::shared_future<int>> shared_futures;
+    shared_futures.push_back(hpx::make_ready_future(1));
+    shared_futures.push_back(hpx::make_exceptional_future<int>(
+        std::runtime_error("when_all_into")));
+
+    std::vector<int> shared_results(shared_futures.size());
+    hpx::future<void> f = hpx::experimental::when_all_into(
+        shared_futures.begin(), shared_futures.end(), shared_results.data());
+    HPX_TEST_THROW(f.get(), std::runtime_error);
+    HPX_TEST_EQ(shared_results[0], 1);
+    HPX_TEST(shared_futures[0].valid());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -271,6 +348,8 @@ int hpx_main(variables_map&)
         test_when_all_five_futures();
         test_when_all_late_futures();
         test_when_all_deferred_futures();
+        test_when_all_many_futures();
+        test_when_all_into();
     }
 
     hpx::local::finalize();
@@ -363,8 +363,11 @@ namespace hpx { namespace local { namespace detail {
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
-                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
-                  "'static-priority' (default: 'local-priority'; "
+                  "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
+                  "'static-priority', 'local-workrequesting-fifo', "
+                  "'local-workrequesting-lifo', 'deadline', and "
+                  "'local-priority-chase-lev' (default: "
+                  "'local-priority'; "
                   "all option values can be abbreviated)")
                 ("hpx:high-priority-threads", value<std::size_t>(),
                   "the number of operating system threads maintaining a high "
@@ -0,0 +1,216 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    /// \brief A single-owner work-stealing deque (Chase and Lev, 2005).
+    ///
+    /// The owning thread pushes and takes items at the bottom of the deque,
+    /// while any number of other threads may concurrently steal items from
+    /// the top. Neither push() nor take() executes an atomic read-modify-write
+    /// operation unless the deque holds exactly one element, in which case
+    /// the owner has to race the thieves for it. The memory orderings follow
+    /// N.M. Le et.al., "Correct and Efficient Work-Stealing for Weak Memory
+    /// Models", PPoPP 2013.
+    ///
+    /// The deque grows on demand. Arrays which have been replaced by a larger
+    /// one are kept alive until the deque is destroyed as concurrent thieves
+    /// may still read from them.
+    ///
+    /// \note push() and take() must only be called from the owning thread.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable elements");
+
+        struct array
+        {
+            explicit array(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , buffer_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & mask_) == 0);
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const noexcept
+            {
+                return buffer_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T const& val) noexcept
+            {
+                buffer_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            array* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                array* a = new array(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    a->put(i, get(i));
+                }
+                return a;
+            }
+
+            std::int64_t const mask_;
+            std::unique_ptr<std::atomic<T>[]> buffer_;
+        };
+
+        static std::int64_t round_up_capacity(std::size_t initial_size) noexcept
+        {
+            std::int64_t capacity = 16;
+            while (capacity < std::int64_t(initial_size))
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(size_type initial_size = 0)
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+            array_.data_.store(new array(round_up_capacity(initial_size)),
+                std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque()
+        {
+            delete array_.data_.load(std::memory_order_relaxed);
+        }
+
+        /// Add an item to the bottom of the deque, may only be called by the
+        /// owning thread.
+        void push(T const& val)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.data_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                // the deque is full, replace the array with a larger one
+                array* new_array = a->grow(b, t);
+                retired_.emplace_back(a);
+                array_.data_.store(new_array, std::memory_order_release);
+                a = new_array;
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// Remove the item most recently pushed to the bottom of the deque,
+        /// may only be called by the owning thread.
+        bool take(T& val)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.data_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, race against the thieves for it
+                bool const result = top_.data_.compare_exchange_strong(
+                    t, t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        /// Remove the least recently pushed item from the top of the deque,
+        /// may be called concurrently by any thread. Returns false if the
+        /// deque was empty or if the item was taken by another thread.
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            array* a = array_.data_.load(std::memory_order_acquire);
+            T const result = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            val = result;
+            return true;
+        }
+
+        /// Return the (approximate) number of items in the deque.
+        size_type size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? size_type(b - t) : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        util::cache_line_data<std::atomic<array*>> array_;
+
+        // arrays replaced by push(), accessed by the owning thread only
+        std::vector<std::unique_ptr<array>> retired_;
+    };
+}}    // namespace hpx::concurrency
@@ -0,0 +1,283 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/hashing/fibhash.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A critical section published by a thread which could not acquire
+        // the lock. Requests live on the stack of the publishing thread,
+        // which waits until the request was executed by the lock holder.
+        struct combining_request
+        {
+            void (*invoke_)(combining_request*);
+            combining_request* next_ = nullptr;
+            std::exception_ptr exception_;
+            std::atomic<bool> done_{false};
+        };
+
+        template <typename F>
+        struct combining_request_impl : combining_request
+        {
+            explicit combining_request_impl(F& f) noexcept
+              : f_(f)
+            {
+                invoke_ = &combining_request_impl::call;
+            }
+
+            static void call(combining_request* r)
+            {
+                static_cast<combining_request_impl*>(r)->f_();
+            }
+
+            F& f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A spinlock with an attached publication list implementing flat
+        // combining: the current lock holder executes the critical sections
+        // queued by waiting threads before releasing the lock. This keeps
+        // the data protected by the lock in the cache of a single core while
+        // the lock is contended.
+        class HPX_CORE_EXPORT combining_spinlock
+        {
+        public:
+            HPX_NON_COPYABLE(combining_spinlock);
+
+            combining_spinlock() noexcept
+              : pending_(nullptr)
+              , acquisitions_(0)
+              , contentions_(0)
+              , combined_(0)
+            {
+            }
+
+            bool try_lock() noexcept
+            {
+                if (mtx_.try_lock())
+                {
+                    acquisitions_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+                return false;
+            }
+
+            void lock() noexcept
+            {
+                if (!try_lock())
+                {
+                    contentions_.fetch_add(1, std::memory_order_relaxed);
+                    for (std::size_t k = 0; !try_lock(); ++k)
+                    {
+                        hpx::execution_base::this_thread::yield_k(
+                            k, "hpx::util::detail::combining_spinlock::lock");
+                    }
+                }
+            }
+
+            // Execute the critical sections published by other threads
+            // before releasing the lock.
+            void unlock() noexcept
+            {
+                combine();
+                mtx_.unlock();
+            }
+
+            // Execute f while holding the lock. If the lock is busy, f is
+            // handed to the current lock holder which will execute it on
+            // behalf of the calling thread. Exceptions thrown by f are
+            // propagated to the caller.
+            template <typename F>
+            void execute(F&& f)
+            {
+                if (try_lock())
+                {
+                    std::exception_ptr exception;
+                    try
+                    {
+                        f();
+                    }
+                    catch (...)
+                    {
+                        exception = std::current_exception();
+                    }
+                    unlock();
+
+                    if (exception)
+                    {
+                        std::rethrow_exception(HPX_MOVE(exception));
+                    }
+                    return;
+                }
+
+                contentions_.fetch_add(1, std::memory_order_relaxed);
+
+                combining_request_impl<std::remove_reference_t<F>> request(f);
+                publish(request);
+                wait_for(request);
+
+                if (request.exception_)
+                {
+                    std::rethrow_exception(HPX_MOVE(request.exception_));
+                }
+            }
+
+            std::uint64_t get_acquisition_count(bool reset) noexcept
+            {
+                return reset ? acquisitions_.exchange(0) :
+                               acquisitions_.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t get_contention_count(bool reset) noexcept
+            {
+                return reset ? contentions_.exchange(0) :
+                               contentions_.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t get_combined_count(bool reset) noexcept
+            {
+                return reset ? combined_.exchange(0) :
+                               combined_.load(std::memory_order_relaxed);
+            }
+
+        private:
+            void publish(combining_request& request) noexcept
+            {
+                combining_request* head =
+                    pending_.load(std::memory_order_relaxed);
+                do
+                {
+                    request.next_ = head;
+                } while (!pending_.compare_exchange_weak(
+                    head, &request, std::memory_order_release));
+            }
+
+            // wait for the request to be executed, possibly by becoming the
+            // combining thread ourselves
+            void wait_for(combining_request& request) noexcept;
+
+            // execute all published requests, the lock must be held
+            void combine() noexcept;
+
+            hpx::util::detail::spinlock mtx_;
+            std::atomic<combining_request*> pending_;
+
+            std::atomic<std::uint64_t> acquisitions_;
+            std::atomic<std::uint64_t> contentions_;
+            std::atomic<std::uint64_t> combined_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // combining_spinlock_pool maps addresses onto a pool of combining
+    // spinlocks. In contrast to spinlock_pool, the number of locks is chosen
+    // at runtime (rounded up to a power of two), each lock occupies its own
+    // cache line, and per-lock contention statistics are collected. The
+    // latter can be used to detect unrelated objects which are hashed onto
+    // the same lock.
+    class HPX_CORE_EXPORT combining_spinlock_pool
+    {
+    public:
+        HPX_NON_COPYABLE(combining_spinlock_pool);
+
+        using lock_type = detail::combining_spinlock;
+
+        explicit combining_spinlock_pool(
+            std::size_t num_locks = HPX_HAVE_SPINLOCK_POOL_NUM);
+        ~combining_spinlock_pool();
+
+        // Returns the number of locks in this pool.
+        std::size_t size() const noexcept
+        {
+            return std::size_t(1) << log2_size_;
+        }
+
+        std::size_t index_for(void const* pv) const noexcept
+        {
+            std::uint64_t const i = reinterpret_cast<std::size_t>(pv);
+            return log2_size_ == 0 ?
+                0 :
+                static_cast<std::size_t>((detail::golden_ratio *
+                                             (i ^ (i >> shift_amount_))) >>
+                    shift_amount_);
+        }
+
+        lock_type& spinlock_for(void const* pv) const noexcept
+        {
+            return locks_[index_for(pv)].data_;
+        }
+
+        // Execute f while holding the lock associated with the given
+        // address, returns the result of invoking f (by value, unless f
+        // itself returns a reference).
+        template <typename F>
+        std::invoke_result_t<F&> execute(void const* pv, F&& f)
+        {
+            using result_type = std::invoke_result_t<F&>;
+
+            lock_type& l = spinlock_for(pv);
+            if constexpr (std::is_void_v<result_type>)
+            {
+                l.execute(f);
+            }
+            else if constexpr (std::is_reference_v<result_type>)
+            {
+                std::remove_reference_t<result_type>* result = nullptr;
+                l.execute([&]() {
+                    auto&& r = f();
+                    result = &r;
+                });
+                return static_cast<result_type>(*result);
+            }
+            else
+            {
+                std::optional<result_type> result;
+                l.execute([&]() { result.emplace(f()); });
+                return HPX_MOVE(*result);
+            }
+        }
+
+        // Returns, for each lock in the pool, the number of acquisitions
+        // which found the lock busy.
+        std::vector<std::uint64_t> get_contention_histogram(
+            bool reset = false) const;
+
+        // Returns, for each lock in the pool, the number of acquisitions.
+        std::vector<std::uint64_t> get_acquisition_histogram(
+            bool reset = false) const;
+
+        // Returns the overall number of critical sections executed by a
+        // thread other than the one which published them.
+        std::uint64_t get_combined_count(bool reset = false) const;
+
+    private:
+        std::size_t log2_size_;
+        std::size_t shift_amount_;
+        cache_aligned_data<lock_type>* locks_;
+    };
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
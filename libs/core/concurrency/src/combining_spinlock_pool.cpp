@@ -0,0 +1,183 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/combining_spinlock_pool.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // limit the number of times the combining thread drains the
+        // publication list to bound the time it spends executing critical
+        // sections of other threads
+        constexpr std::size_t max_combining_passes = 4;
+
+        void combining_spinlock::wait_for(combining_request& request) noexcept
+        {
+            for (std::size_t k = 0;
+                 !request.done_.load(std::memory_order_acquire); ++k)
+            {
+                if (try_lock())
+                {
+                    // this executes our own request as well, unless it was
+                    // executed by the previous lock holder in the meantime
+                    unlock();
+                    HPX_ASSERT(request.done_.load(std::memory_order_acquire));
+                    return;
+                }
+
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::util::detail::combining_spinlock::execute");
+            }
+        }
+
+        void combining_spinlock::combine() noexcept
+        {
+            std::uint64_t combined = 0;
+            for (std::size_t pass = 0; pass != max_combining_passes; ++pass)
+            {
+                combining_request* head =
+                    pending_.exchange(nullptr, std::memory_order_acquire);
+                if (head == nullptr)
+                {
+                    break;
+                }
+
+                // the publication list is a stack, reverse it to execute the
+                // requests in the order they were published
+                combining_request* fifo = nullptr;
+                while (head != nullptr)
+                {
+                    combining_request* next = head->next_;
+                    head->next_ = fifo;
+                    fifo = head;
+                    head = next;
+                }
+
+                while (fifo != nullptr)
+                {
+                    // the request may go out of scope as soon as it is marked
+                    // done
+                    combining_request* next = fifo->next_;
+                    try
+                    {
+                        fifo->invoke_(fifo);
+                    }
+                    catch (...)
+                    {
+                        fifo->exception_ = std::current_exception();
+                    }
+                    fifo->done_.store(true, std::memory_order_release);
+
+                    fifo = next;
+                    ++combined;
+                }
+            }
+
+            if (combined != 0)
+            {
+                combined_.fetch_add(combined, std::memory_order_relaxed);
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::size_t ceil_log2(std::size_t n) noexcept
+        {
+            std::size_t log2 = 0;
+            while ((std::size_t(1) << log2) < n)
+            {
+                ++log2;
+            }
+            return log2;
+        }
+    }    // namespace
+
+    combining_spinlock_pool::combining_spinlock_pool(std::size_t num_locks)
+      : log2_size_(ceil_log2(num_locks == 0 ? 1 : num_locks))
+      , shift_amount_(64 - log2_size_)
+      , locks_(nullptr)
+    {
+        using entry_type = cache_aligned_data<lock_type>;
+
+        // align the first entry to a cache line boundary, the padding makes
+        // sure that all other entries are aligned as well
+        std::size_t const count = size();
+        locks_ = static_cast<entry_type*>(::operator new(
+            count * sizeof(entry_type),
+            std::align_val_t(threads::get_cache_line_size())));
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            new (&locks_[i]) entry_type();
+        }
+    }
+
+    combining_spinlock_pool::~combining_spinlock_pool()
+    {
+        using entry_type = cache_aligned_data<lock_type>;
+
+        std::size_t const count = size();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            locks_[i].~entry_type();
+        }
+
+        ::operator delete(
+            locks_, std::align_val_t(threads::get_cache_line_size()));
+    }
+
+    std::vector<std::uint64_t> combining_spinlock_pool::get_contention_histogram(
+        bool reset) const
+    {
+        std::size_t const count = size();
+
+        std::vector<std::uint64_t> result(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            result[i] = locks_[i].data_.get_contention_count(reset);
+        }
+        return result;
+    }
+
+    std::vector<std::uint64_t>
+    combining_spinlock_pool::get_acquisition_histogram(bool reset) const
+    {
+        std::size_t const count = size();
+
+        std::vector<std::uint64_t> result(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            result[i] = locks_[i].data_.get_acquisition_count(reset);
+        }
+        return result;
+    }
+
+    std::uint64_t combining_spinlock_pool::get_combined_count(bool reset) const
+    {
+        std::uint64_t result = 0;
+
+        std::size_t const count = size();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            result += locks_[i].data_.get_combined_count(reset);
+        }
+        return result;
+    }
+}}    // namespace hpx::util
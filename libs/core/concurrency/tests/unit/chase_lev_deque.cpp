@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using deque = hpx::concurrency::chase_lev_deque<std::uint64_t>;
+
+std::uint64_t threads = 4;
+std::uint64_t items = 500000;
+
+void test_single_threaded()
+{
+    // small initial size to force the deque to grow
+    deque q(2);
+
+    HPX_TEST(q.empty());
+
+    std::uint64_t val = 0;
+    HPX_TEST(!q.take(val));
+    HPX_TEST(!q.steal(val));
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        q.push(i);
+    }
+    HPX_TEST_EQ(q.size(), std::size_t(100));
+
+    // the owner takes the most recently pushed item...
+    HPX_TEST(q.take(val));
+    HPX_TEST_EQ(val, std::uint64_t(99));
+
+    // ...while thieves take the oldest one
+    HPX_TEST(q.steal(val));
+    HPX_TEST_EQ(val, std::uint64_t(0));
+
+    for (std::uint64_t i = 98; i != 0; --i)
+    {
+        HPX_TEST(q.take(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.take(val));
+    HPX_TEST(!q.steal(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The owner pushes all items, taking some of them back in between, while the
+// thieves try to steal whatever is available. Every item has to be retrieved
+// exactly once.
+std::atomic<bool> done(false);
+std::atomic<std::uint64_t> retrieved(0);
+
+void owner_thread(deque& q, std::vector<std::atomic<std::uint64_t>>& seen)
+{
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        q.push(i);
+        if (i % 3 == 0 && q.take(val))
+        {
+            ++seen[val];
+            ++retrieved;
+        }
+    }
+
+    while (q.take(val))
+    {
+        ++seen[val];
+        ++retrieved;
+    }
+
+    done = true;
+}
+
+void thief_thread(deque& q, std::vector<std::atomic<std::uint64_t>>& seen)
+{
+    std::uint64_t val = 0;
+    while (!done || !q.empty())
+    {
+        if (q.steal(val))
+        {
+            ++seen[val];
+            ++retrieved;
+        }
+    }
+}
+
+void test_concurrent()
+{
+    deque q;
+    std::vector<std::atomic<std::uint64_t>> seen(items);
+    for (auto& s : seen)
+    {
+        s.store(0);
+    }
+
+    {
+        std::vector<std::thread> tg;
+
+        tg.push_back(
+            std::thread([&q, &seen]() { owner_thread(q, seen); }));
+        for (std::uint64_t i = 1; i < threads; ++i)
+        {
+            tg.push_back(
+                std::thread([&q, &seen]() { thief_thread(q, seen); }));
+        }
+
+        for (std::thread& t : tg)
+        {
+            if (t.joinable())
+                t.join();
+        }
+    }
+
+    HPX_TEST(q.empty());
+    HPX_TEST_EQ(retrieved.load(), items);
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        HPX_TEST_EQ(seen[i].load(), std::uint64_t(1));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using hpx::program_options::command_line_parser;
+    using hpx::program_options::notify;
+    using hpx::program_options::options_description;
+    using hpx::program_options::store;
+    using hpx::program_options::value;
+    using hpx::program_options::variables_map;
+
+    variables_map vm;
+
+    options_description desc_cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of threads accessing the deque (one owner, all others "
+         "are thieves)")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push to the deque")
+    ;
+    // clang-format on
+
+    store(command_line_parser(argc, argv)
+              .options(desc_cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return hpx::util::report_errors();
+    }
+
+    test_single_threaded();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,182 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/combining_spinlock_pool.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_tasks = 16;
+constexpr std::size_t num_iterations = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_pool_size()
+{
+    HPX_TEST_EQ(hpx::util::combining_spinlock_pool(1).size(), std::size_t(1));
+    HPX_TEST_EQ(hpx::util::combining_spinlock_pool(5).size(), std::size_t(8));
+    HPX_TEST_EQ(
+        hpx::util::combining_spinlock_pool(64).size(), std::size_t(64));
+
+    hpx::util::combining_spinlock_pool pool(16);
+    int objects[32];
+    for (int& obj : objects)
+    {
+        HPX_TEST_LT(pool.index_for(&obj), pool.size());
+        HPX_TEST_EQ(&pool.spinlock_for(&obj),
+            &pool.spinlock_for(static_cast<void const*>(&obj)));
+    }
+}
+
+void test_execute()
+{
+    hpx::util::combining_spinlock_pool pool(4);
+
+    // all tasks update the same (unprotected) counter through the pool
+    std::uint64_t counter = 0;
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        results.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                pool.execute(&counter, [&]() { ++counter; });
+            }
+        }));
+    }
+    hpx::wait_all(results);
+
+    HPX_TEST_EQ(counter, std::uint64_t(num_tasks * num_iterations));
+
+    // all acquisitions are attributed to the lock the counter maps to
+    std::vector<std::uint64_t> acquisitions = pool.get_acquisition_histogram();
+    HPX_TEST_EQ(acquisitions.size(), pool.size());
+    std::size_t const index = pool.index_for(&counter);
+    for (std::size_t i = 0; i != acquisitions.size(); ++i)
+    {
+        if (i != index)
+        {
+            HPX_TEST_EQ(acquisitions[i], std::uint64_t(0));
+        }
+    }
+
+    // critical sections are either executed directly by the thread which
+    // acquired the lock or are combined by the lock holder
+    HPX_TEST_LTE(std::uint64_t(num_tasks * num_iterations),
+        acquisitions[index] + pool.get_combined_count());
+
+    std::vector<std::uint64_t> contentions =
+        pool.get_contention_histogram(true);
+    HPX_TEST_EQ(std::accumulate(contentions.begin(), contentions.end(),
+                    std::uint64_t(0)),
+        contentions[index]);
+    HPX_TEST_LTE(pool.get_combined_count(), contentions[index]);
+
+    contentions = pool.get_contention_histogram();
+    HPX_TEST_EQ(contentions[index], std::uint64_t(0));
+}
+
+void test_execute_result()
+{
+    hpx::util::combining_spinlock_pool pool;
+
+    int value = 41;
+    HPX_TEST_EQ(pool.execute(&value, [&]() { return ++value; }), 42);
+
+    HPX_TEST_THROW(pool.execute(&value,
+                       []() -> int { throw std::runtime_error("error"); }),
+        std::runtime_error);
+
+    // the lock was released after the exception was thrown
+    std::unique_lock<hpx::util::combining_spinlock_pool::lock_type> l(
+        pool.spinlock_for(&value));
+    HPX_TEST(l.owns_lock());
+}
+
+void test_execute_nontrivial_result()
+{
+    hpx::util::combining_spinlock_pool pool;
+
+    // results owning heap memory are returned by value
+    std::string str("a string which is too long for small string storage");
+    std::string const str_result =
+        pool.execute(&str, [&]() { return str + str; });
+    HPX_TEST_EQ(str_result, str + str);
+
+    std::vector<std::uint64_t> v(1000, 42);
+    std::vector<std::uint64_t> const v_result = pool.execute(&v, [&]() {
+        v.push_back(43);
+        return v;
+    });
+    HPX_TEST_EQ(v_result.size(), std::size_t(1001));
+    HPX_TEST_EQ(v_result.front(), std::uint64_t(42));
+    HPX_TEST_EQ(v_result.back(), std::uint64_t(43));
+
+    // references returned by f are passed through
+    std::string& str_ref =
+        pool.execute(&str, [&]() -> std::string& { return str; });
+    HPX_TEST_EQ(&str_ref, &str);
+}
+
+void test_lock()
+{
+    hpx::util::combining_spinlock_pool pool(2);
+
+    std::uint64_t counter = 0;
+
+    // mix plain locking with combined execution on the same lock
+    std::vector<hpx::future<void>> results;
+    results.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        results.push_back(hpx::async([&, i]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                if (i % 2 == 0)
+                {
+                    std::lock_guard<hpx::util::combining_spinlock_pool::
+                            lock_type>
+                        l(pool.spinlock_for(&counter));
+                    ++counter;
+                }
+                else
+                {
+                    pool.execute(&counter, [&]() { ++counter; });
+                }
+            }
+        }));
+    }
+    hpx::wait_all(results);
+
+    HPX_TEST_EQ(counter, std::uint64_t(num_tasks * num_iterations));
+}
+
+int hpx_main()
+{
+    test_pool_size();
+    test_execute();
+    test_execute_result();
+    test_execute_nontrivial_result();
+    test_lock();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
@@ -415,6 +415,22 @@
 #  define HPX_IDLE_BACKOFF_TIME_MAX 1000
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Number of idle loop iterations a scheduler thread spins before it starts
+// issuing pause instructions (used only if HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF
+// is defined).
+#if !defined(HPX_IDLE_BACKOFF_SPIN_COUNT)
+#  define HPX_IDLE_BACKOFF_SPIN_COUNT 1000
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of idle loop iterations a scheduler thread issues pause instructions
+// before it starts yielding its core to the operating system (used only if
+// HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
+#if !defined(HPX_IDLE_BACKOFF_PAUSE_COUNT)
+#  define HPX_IDLE_BACKOFF_PAUSE_COUNT 10000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_WRAPPER_HEAP_STEP)
 #  define HPX_WRAPPER_HEAP_STEP 0xFFFFU
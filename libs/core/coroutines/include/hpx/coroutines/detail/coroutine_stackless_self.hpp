@@ -12,10 +12,12 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/modules/errors.hpp>
 
 #include <cstddef>
 #include <exception>
 #include <limits>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads { namespace coroutines {
@@ -34,11 +36,25 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         {
         }
 
-        arg_type yield_impl(result_type) override
+        arg_type yield_impl(result_type arg) override
         {
-            // stackless coroutines don't support suspension
-            HPX_ASSERT(false);
-            return threads::thread_restart_state::abort;
+            // Stackless coroutines run to completion on the stack of the
+            // worker thread executing them, thus they can't be suspended.
+            // Requests to merely yield are served by yielding the underlying
+            // OS thread instead. Waiting for synchronization primitives is
+            // handled by the execution agent of the worker thread (which
+            // blocks the OS thread), only explicit suspension is an error.
+            HPX_ASSERT(!arg.second);
+            if (arg.first == thread_schedule_state::suspended)
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "coroutine_stackless_self::yield_impl",
+                    "stackless threads can't be suspended, use a stackful "
+                    "thread for tasks that need to be suspended");
+            }
+
+            std::this_thread::yield();
+            return threads::thread_restart_state::signaled;
         }
 
         thread_id_type get_thread_id() const override
@@ -46,8 +46,10 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
+#include <vector>
 
 #if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
 #include <errno.h>
@@ -78,10 +80,81 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_CORE_EXPORT extern bool use_guard_pages;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Policy used for giving the memory of unused stacks (or unused parts
+        // of stacks) back to the operating system.
+        enum class stack_reclaim_policy
+        {
+            none = 0,     // keep all memory
+            lazy = 1,     // MADV_FREE, memory is reclaimed under pressure only
+            eager = 2,    // MADV_DONTNEED, memory is released immediately
+        };
+
+        // these global variables are set during runtime startup from the
+        // hpx.stacks configuration section
+        HPX_CORE_EXPORT extern bool use_huge_pages;
+        HPX_CORE_EXPORT extern stack_reclaim_policy reclaim_policy;
+
+        // Control whether stacks are allocated from the stack pools. Stacks
+        // have to be freed the same way they were allocated, thus the setting
+        // can't be changed anymore once the first stack was allocated.
+        HPX_CORE_EXPORT void set_use_stack_pool(bool use_pool);
+        HPX_CORE_EXPORT bool use_stack_pool() noexcept;
+
+        // Counters describing the state of one stack pool (there is one pool
+        // for each stack size in use).
+        struct stack_pool_counters
+        {
+            std::size_t stack_size;         // size of the stacks in this pool
+            std::uint64_t mapped_bytes;     // overall size of all mappings
+            std::uint64_t mappings;         // number of mmap() calls
+            std::uint64_t stacks_in_use;    // currently allocated stacks
+            std::uint64_t stacks_cached;    // stacks ready for reuse
+            std::uint64_t allocations;      // overall number of allocations
+            std::uint64_t reused;           // allocations served from cache
+            std::uint64_t reclaimed;        // stacks given back to the OS
+        };
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-        inline void* alloc_stack(std::size_t size)
+        // Allocate/free a stack from the slab-style stack pool for stacks of
+        // the given size. The pool carves many stacks out of large mappings,
+        // optionally backed by transparent huge pages, and caches freed stacks
+        // for reuse.
+        HPX_CORE_EXPORT void* pool_alloc_stack(std::size_t size);
+        HPX_CORE_EXPORT void pool_free_stack(void* stack, std::size_t size);
+
+        // Return the counters of all existing stack pools
+        HPX_CORE_EXPORT std::vector<stack_pool_counters>
+        get_stack_pool_counters();
+
+        // Give unused stack memory back to the operating system, depending on
+        // the configured reclaim policy. Returns whether anything was done.
+        inline bool reclaim_stack_memory(void* addr, std::size_t size)
+        {
+            switch (reclaim_policy)
+            {
+            case stack_reclaim_policy::lazy:
+#if defined(MADV_FREE)
+                ::madvise(addr, size, MADV_FREE);
+#else
+                // fall back to MADV_DONTNEED if MADV_FREE is not supported
+                ::madvise(addr, size, MADV_DONTNEED);
+#endif
+                return true;
+
+            case stack_reclaim_policy::eager:
+                ::madvise(addr, size, MADV_DONTNEED);
+                return true;
+
+            case stack_reclaim_policy::none:
+                break;
+            }
+            return false;
+        }
+
+        inline void* mmap_stack(std::size_t size)
         {
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
@@ -125,6 +198,15 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        inline void* alloc_stack(std::size_t size)
+        {
+            if (use_stack_pool())
+            {
+                return pool_alloc_stack(size);
+            }
+            return mmap_stack(size);
+        }
+
         inline void watermark_stack(void* stack, std::size_t size)
         {
             HPX_ASSERT(size > EXEC_PAGESIZE);
@@ -146,14 +228,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             {
                 // We never free up the first page, as it's initialized only when the
                 // stack is created.
-                ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
-                return true;
+                return reclaim_stack_memory(stack, size - EXEC_PAGESIZE);
             }
 
             return false;
         }
 
-        inline void free_stack(void* stack, std::size_t size)
+        inline void munmap_stack(void* stack, std::size_t size)
         {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
@@ -171,6 +252,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        inline void free_stack(void* stack, std::size_t size)
+        {
+            if (use_stack_pool())
+            {
+                pool_free_stack(stack, size);
+                return;
+            }
+            munmap_stack(stack, size);
+        }
+
 #else    // non-mmap()
 
         //this should be a fine default.
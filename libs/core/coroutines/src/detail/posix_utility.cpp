@@ -8,13 +8,266 @@
 #include <hpx/config.hpp>
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/assert.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         ///////////////////////////////////////////////////////////////////////
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_CORE_EXPORT bool use_guard_pages = true;
+
+        // these control the behavior of the stack pools
+        HPX_CORE_EXPORT bool use_huge_pages = false;
+        HPX_CORE_EXPORT stack_reclaim_policy reclaim_policy =
+            stack_reclaim_policy::eager;
+
+        namespace {
+
+            bool use_stack_pool_ = true;
+
+            // set as soon as the setting was used for allocating a stack
+            std::atomic<bool> use_stack_pool_fixed(false);
+        }    // namespace
+
+        void set_use_stack_pool(bool use_pool)
+        {
+            if (use_stack_pool_fixed.load(std::memory_order_acquire))
+            {
+                // stacks may have been allocated already, those must be
+                // freed the same way
+                HPX_ASSERT_MSG(use_pool == use_stack_pool_,
+                    "the stack pool can't be enabled or disabled after the "
+                    "first stack was allocated");
+                return;
+            }
+            use_stack_pool_ = use_pool;
+        }
+
+        bool use_stack_pool() noexcept
+        {
+            if (!use_stack_pool_fixed.load(std::memory_order_relaxed))
+            {
+                use_stack_pool_fixed.store(true, std::memory_order_release);
+            }
+            return use_stack_pool_;
+        }
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+        namespace {
+
+            // minimal size of the mappings the stacks are carved from
+            constexpr std::size_t stack_pool_chunk_size = 0x400000;    // 4MB
+
+            ///////////////////////////////////////////////////////////////////
+            // A slab-style pool of stacks of one size. Stacks are carved
+            // from large mappings and are never unmapped, freed stacks are
+            // cached for reuse after their memory has been reclaimed according
+            // to the configured reclaim policy.
+            class stack_pool
+            {
+            public:
+                explicit stack_pool(std::size_t stack_size)
+                  : stack_size_(stack_size)
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                  , guard_size_(use_guard_pages ? EXEC_PAGESIZE : 0)
+#else
+                  , guard_size_(0)
+#endif
+                  , span_(stack_size_ + guard_size_)
+                  , stacks_per_chunk_((std::max)(
+                        std::size_t(1), stack_pool_chunk_size / span_))
+                  , chunk_(nullptr)
+                  , carved_(0)
+                  , mapped_bytes_(0)
+                  , mappings_(0)
+                  , stacks_in_use_(0)
+                  , allocations_(0)
+                  , reused_(0)
+                  , reclaimed_(0)
+                {
+                }
+
+                void* allocate()
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+
+                    void* stack = nullptr;
+                    if (!free_list_.empty())
+                    {
+                        stack = free_list_.back();
+                        free_list_.pop_back();
+                        ++reused_;
+                    }
+                    else
+                    {
+                        if (chunk_ == nullptr || carved_ == stacks_per_chunk_)
+                        {
+                            map_chunk();
+                        }
+
+                        char* slot = chunk_ + carved_++ * span_;
+                        if (guard_size_ != 0)
+                        {
+                            // Add a guard page.
+                            ::mprotect(slot, guard_size_, PROT_NONE);
+                        }
+                        stack = slot + guard_size_;
+                    }
+
+                    ++allocations_;
+                    ++stacks_in_use_;
+                    return stack;
+                }
+
+                void deallocate(void* stack)
+                {
+                    // The stack is not used anymore, give its memory back to
+                    // the system before caching it.
+                    bool const reclaimed =
+                        reclaim_stack_memory(stack, stack_size_);
+
+                    std::lock_guard<std::mutex> l(mtx_);
+                    free_list_.push_back(stack);
+                    --stacks_in_use_;
+                    if (reclaimed)
+                    {
+                        ++reclaimed_;
+                    }
+                }
+
+                stack_pool_counters get_counters()
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    return stack_pool_counters{stack_size_, mapped_bytes_,
+                        mappings_, stacks_in_use_, free_list_.size(),
+                        allocations_, reused_, reclaimed_};
+                }
+
+            private:
+                void map_chunk()
+                {
+                    std::size_t const size = stacks_per_chunk_ * span_;
+                    void* chunk = ::mmap(nullptr, size,
+                        PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                        MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                        MAP_PRIVATE | MAP_ANON,
+#else
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                        -1, 0);
+
+                    if (chunk == MAP_FAILED)
+                    {
+                        throw std::runtime_error(
+                            "mmap() failed to allocate memory for the thread "
+                            "stack pool");
+                    }
+
+#if defined(MADV_HUGEPAGE)
+                    // Guard pages split the mapping into many small regions,
+                    // which prevents using huge pages anyways.
+                    if (use_huge_pages && guard_size_ == 0)
+                    {
+                        ::madvise(chunk, size, MADV_HUGEPAGE);
+                    }
+#endif
+
+                    chunk_ = static_cast<char*>(chunk);
+                    carved_ = 0;
+                    mapped_bytes_ += size;
+                    ++mappings_;
+                }
+
+                std::size_t const stack_size_;
+                std::size_t const guard_size_;
+                std::size_t const span_;
+                std::size_t const stacks_per_chunk_;
+
+                std::mutex mtx_;
+                std::vector<void*> free_list_;
+
+                // the mapping new stacks are currently carved from
+                char* chunk_;
+                std::size_t carved_;
+
+                std::uint64_t mapped_bytes_;
+                std::uint64_t mappings_;
+                std::uint64_t stacks_in_use_;
+                std::uint64_t allocations_;
+                std::uint64_t reused_;
+                std::uint64_t reclaimed_;
+            };
+
+            struct stack_pools
+            {
+                stack_pool& get(std::size_t stack_size)
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+
+                    std::unique_ptr<stack_pool>& pool = pools_[stack_size];
+                    if (!pool)
+                    {
+                        pool.reset(new stack_pool(stack_size));
+                    }
+                    return *pool;
+                }
+
+                std::vector<stack_pool_counters> get_counters()
+                {
+                    std::vector<stack_pool_counters> result;
+
+                    std::lock_guard<std::mutex> l(mtx_);
+                    result.reserve(pools_.size());
+                    for (auto& pool : pools_)
+                    {
+                        result.push_back(pool.second->get_counters());
+                    }
+                    return result;
+                }
+
+                std::mutex mtx_;
+                std::map<std::size_t, std::unique_ptr<stack_pool>> pools_;
+            };
+
+            stack_pools& get_stack_pools()
+            {
+                // The pools are intentionally never destroyed as stacks may be
+                // freed during static destruction.
+                static stack_pools* pools = new stack_pools;
+                return *pools;
+            }
+        }    // namespace
+
+        void* pool_alloc_stack(std::size_t size)
+        {
+            return get_stack_pools().get(size).allocate();
+        }
+
+        void pool_free_stack(void* stack, std::size_t size)
+        {
+            get_stack_pools().get(size).deallocate(stack);
+        }
+
+        std::vector<stack_pool_counters> get_stack_pool_counters()
+        {
+            return get_stack_pools().get_counters();
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
@@ -147,14 +147,29 @@ namespace hpx { namespace lcos { namespace detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // Asynchronous continuations are run using launch::async, except for
+    // continuations attached using launch::non_suspending, which are run
+    // without a stack of their own.
     struct post_policy_spawner
     {
+        template <typename Policy>
+        explicit post_policy_spawner(Policy const& policy) noexcept
+          : policy_(hpx::launch::async)
+        {
+            if (policy.stacksize() == threads::thread_stacksize::nostack)
+            {
+                policy_.set_stacksize(threads::thread_stacksize::nostack);
+            }
+        }
+
         template <typename F>
         void operator()(F&& f, hpx::util::thread_description desc)
         {
             hpx::detail::post_policy_dispatch<hpx::launch::async_policy>::call(
-                hpx::launch::async, desc, HPX_FORWARD(F, f));
+                policy_, desc, HPX_FORWARD(F, f));
         }
+
+        hpx::launch::async_policy policy_;
     };
 
     template <typename Executor>
@@ -184,7 +199,7 @@ namespace hpx { namespace lcos { namespace detail {
             new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
 
         static_cast<shared_state*>(p.get())->template attach<spawner_type>(
-            future, spawner_type{}, HPX_FORWARD(Policy, policy));
+            future, spawner_type{policy}, HPX_FORWARD(Policy, policy));
 
         return p;
     }
@@ -224,7 +239,7 @@ namespace hpx { namespace lcos { namespace detail {
             p.release(), false);
 
         static_cast<shared_state*>(r.get())->template attach<spawner_type>(
-            future, spawner_type{}, HPX_FORWARD(Policy, policy));
+            future, spawner_type{policy}, HPX_FORWARD(Policy, policy));
 
         return r;
     }
@@ -266,7 +281,7 @@ namespace hpx { namespace lcos { namespace detail {
 
         static_cast<shared_state*>(r.get())
             ->template attach_nounwrap<spawner_type>(
-                future, spawner_type{}, HPX_FORWARD(Policy, policy));
+                future, spawner_type{policy}, HPX_FORWARD(Policy, policy));
 
         return r;
     }
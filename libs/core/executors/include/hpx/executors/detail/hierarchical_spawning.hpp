@@ -19,12 +19,14 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -41,6 +43,28 @@
 namespace hpx { namespace parallel { namespace execution { namespace detail {
 
     ////////////////////////////////////////////////////////////////////////////
+    // Return whether post_policy_dispatch would schedule a new thread for the
+    // given policy, in which case the tasks can be registered in bulk.
+    template <typename Launch>
+    bool is_async_launch_policy(Launch const& policy) noexcept
+    {
+        if constexpr (std::is_same_v<Launch, hpx::launch::async_policy>)
+        {
+            return true;
+        }
+        else if constexpr (std::is_same_v<Launch, hpx::launch>)
+        {
+            return !(policy == hpx::launch::sync ||
+                policy == hpx::launch::deferred ||
+                policy == hpx::launch::fork);
+        }
+        else
+        {
+            (void) policy;
+            return false;
+        }
+    }
+
     template <typename Launch, typename F, typename S, typename... Ts>
     std::vector<hpx::future<detail::bulk_function_result_t<F, S, Ts...>>>
     hierarchical_bulk_async_execute_helper(
@@ -175,12 +199,34 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                                           bool direct) mutable {
                         // launch N-1 tasks
                         auto iter = it;
-                        for (std::size_t i = begin + direct; i != end;
-                             (void) ++iter, ++i)
+                        if (is_async_launch_policy(inner_post_policy))
+                        {
+                            // register all tasks with the pool at once
+                            std::vector<threads::thread_init_data> tasks;
+                            tasks.reserve(end - begin - direct);
+                            for (std::size_t i = begin + direct; i != end;
+                                 (void) ++iter, ++i)
+                            {
+                                tasks.emplace_back(
+                                    threads::make_thread_function_nullary(
+                                        hpx::util::deferred_call(
+                                            wrapped, *iter, ts...)),
+                                    desc, inner_post_policy.priority(),
+                                    inner_post_policy.hint(),
+                                    inner_post_policy.stacksize(),
+                                    threads::thread_schedule_state::pending);
+                            }
+                            threads::register_work_bulk(tasks, pool);
+                        }
+                        else
                         {
-                            hpx::detail::post_policy_dispatch<Launch>::call(
-                                inner_post_policy, desc, pool, wrapped, *iter,
-                                ts...);
+                            for (std::size_t i = begin + direct; i != end;
+                                 (void) ++iter, ++i)
+                            {
+                                hpx::detail::post_policy_dispatch<
+                                    Launch>::call(inner_post_policy, desc,
+                                    pool, wrapped, *iter, ts...);
+                            }
                         }
 
                         // execute last task directly, if needed
@@ -9,7 +9,6 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
@@ -25,6 +24,7 @@
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/one_shot.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
@@ -317,7 +317,7 @@ namespace hpx { namespace execution {
 
             typename hpx::traits::detail::shared_state_ptr<result_type>::type
                 p = lcos::detail::make_continuation_alloc_nounwrap<result_type>(
-                    hpx::util::internal_allocator<>{},
+                    lcos::detail::shared_state_pool_allocator<>{},
                     HPX_FORWARD(Future, predecessor), policy_, HPX_MOVE(func));
 
             return hpx::traits::future_access<hpx::future<result_type>>::create(
@@ -19,6 +19,7 @@
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <string>
@@ -40,7 +41,8 @@ namespace hpx::execution::experimental {
         {
             return pool_ == rhs.pool_ && priority_ == rhs.priority_ &&
                 stacksize_ == rhs.stacksize_ &&
-                schedulehint_ == rhs.schedulehint_;
+                schedulehint_ == rhs.schedulehint_ &&
+                deadline_ == rhs.deadline_;
         }
 
         bool operator!=(thread_pool_scheduler const& rhs) const noexcept
@@ -108,6 +110,25 @@ namespace hpx::execution::experimental {
             return scheduler.schedulehint_;
         }
 
+        // support with_deadline property, the deadline is used by deadline
+        // aware schedulers only
+        friend thread_pool_scheduler tag_invoke(
+            hpx::execution::experimental::with_deadline_t,
+            thread_pool_scheduler const& scheduler,
+            std::chrono::steady_clock::time_point deadline)
+        {
+            auto sched_with_deadline = scheduler;
+            sched_with_deadline.deadline_ = deadline;
+            return sched_with_deadline;
+        }
+
+        friend std::chrono::steady_clock::time_point tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            thread_pool_scheduler const& scheduler)
+        {
+            return scheduler.deadline_;
+        }
+
         // support with_annotation property
         friend constexpr thread_pool_scheduler tag_invoke(
             hpx::execution::experimental::with_annotation_t,
@@ -146,6 +167,7 @@ namespace hpx::execution::experimental {
             threads::thread_init_data data(
                 threads::make_thread_function_nullary(HPX_FORWARD(F, f)),
                 annotation, priority_, schedulehint_, stacksize_);
+            data.deadline = deadline_;
             threads::register_work(data, pool_);
         }
 
@@ -253,6 +275,8 @@ namespace hpx::execution::experimental {
         hpx::threads::thread_stacksize stacksize_ =
             hpx::threads::thread_stacksize::small_;
         hpx::threads::thread_schedule_hint schedulehint_{};
+        std::chrono::steady_clock::time_point deadline_ =
+            hpx::threads::no_deadline();
         char const* annotation_ = nullptr;
         /// \endcond
     };
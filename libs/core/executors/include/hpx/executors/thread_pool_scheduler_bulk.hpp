@@ -359,11 +359,13 @@ namespace hpx::execution::experimental {
                         queue.reset(part_begin, part_end);
                     }
 
-                    // Spawn a task which will process a number of chunks. If
-                    // the queue contains no chunks no task will be spawned.
+                    // Prepare a task which will process a number of chunks.
+                    // If the queue contains no chunks no task will be
+                    // prepared. The tasks are spawned all at once afterwards.
                     void do_work_task(size_type const n,
                         std::uint32_t const chunk_size,
-                        std::uint32_t const worker_thread) const
+                        std::uint32_t const worker_thread,
+                        std::vector<threads::thread_init_data>& tasks) const
                     {
                         task_function task_f{
                             this->op_state, n, chunk_size, worker_thread};
@@ -386,7 +388,7 @@ namespace hpx::execution::experimental {
                                 worker_thread);
                         }
 
-                        // Spawn the task.
+                        // Prepare the task.
                         char const* scheduler_annotation =
                             get_annotation(op_state->scheduler);
                         char const* annotation =
@@ -395,13 +397,12 @@ namespace hpx::execution::experimental {
                                 std::decay_t<F>>::call(op_state->f) :
                             scheduler_annotation;
 
-                        threads::thread_init_data data(
-                            threads::make_thread_function_nullary(
-                                HPX_MOVE(task_f)),
+                        tasks.emplace_back(threads::make_thread_function_nullary(
+                                               HPX_MOVE(task_f)),
                             annotation, get_priority(op_state->scheduler), hint,
                             get_stacksize(op_state->scheduler));
-                        threads::register_work(
-                            data, op_state->scheduler.get_thread_pool());
+                        tasks.back().deadline =
+                            get_deadline(op_state->scheduler);
                     }
 
                     // Do the work on the worker thread that called set_value
@@ -474,9 +475,12 @@ namespace hpx::execution::experimental {
                                 }
 
                                 // Spawn the worker threads for all except the
-                                // local queue.
+                                // local queue. All tasks are registered with
+                                // the thread pool in one go.
                                 auto const local_worker_thread =
                                     hpx::get_local_worker_thread_num();
+                                std::vector<threads::thread_init_data> tasks;
+                                tasks.reserve(r.op_state->num_worker_threads);
                                 for (std::size_t worker_thread = 0;
                                      worker_thread <
                                      r.op_state->num_worker_threads;
@@ -490,7 +494,14 @@ namespace hpx::execution::experimental {
                                     }
 
                                     r.do_work_task(
-                                        n, chunk_size, worker_thread);
+                                        n, chunk_size, worker_thread, tasks);
+                                }
+
+                                if (!tasks.empty())
+                                {
+                                    threads::register_work_bulk(tasks,
+                                        r.op_state->scheduler
+                                            .get_thread_pool());
                                 }
 
                                 // Handle the queue for the local thread.
@@ -13,6 +13,7 @@
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -32,6 +33,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -110,6 +112,33 @@ namespace hpx { namespace lcos { namespace detail {
             delete this;
         }
 
+        // Shared states created using new are allocated from the per-thread
+        // shared state pools as well.
+        static void* operator new(std::size_t size)
+        {
+            return shared_state_pool_allocate(size);
+        }
+        static void operator delete(void* p, std::size_t size) noexcept
+        {
+            shared_state_pool_deallocate(p, size);
+        }
+
+        static void* operator new(std::size_t size, std::align_val_t align)
+        {
+            return ::operator new(size, align);
+        }
+        static void operator delete(
+            void* p, std::size_t size, std::align_val_t align) noexcept
+        {
+            ::operator delete(p, size, align);
+        }
+
+        static void* operator new(std::size_t, void* p) noexcept
+        {
+            return p;
+        }
+        static void operator delete(void*, void*) noexcept {}
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref
@@ -227,12 +256,14 @@ namespace hpx { namespace lcos { namespace detail {
 
         future_data_base() noexcept
           : state_(empty)
+          , completion_state_(0)
         {
         }
 
         explicit future_data_base(init_no_addref no_addref) noexcept
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , completion_state_(0)
         {
         }
 
@@ -251,6 +282,19 @@ namespace hpx { namespace lcos { namespace detail {
             exception = 4 | ready
         };
 
+        // Bits of completion_state_, the word driving the lock-free
+        // continuation protocol. The first continuation is stored in
+        // on_completed_single_ without taking mtx_, any further ones are
+        // appended to on_completed_ while holding mtx_.
+        enum completion_state : std::size_t
+        {
+            completion_ready = 1,        // shared state was made ready
+            completion_attaching = 2,    // on_completed_single_ is claimed
+            completion_attached = 4,     // on_completed_single_ is stored
+            completion_has_list = 8,     // on_completed_ may be non-empty
+            completion_has_waiters = 16    // threads may wait on cond_
+        };
+
         /// Return whether or not the data is available for this
         /// \a future.
         bool is_ready(
@@ -334,8 +378,20 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        // Publish that state_ has been changed away from 'empty': wake up all
+        // waiting threads and invoke all registered continuations. This must
+        // be called exactly once for each time the shared state is made
+        // ready.
+        void mark_ready();
+
+        // Forget about all registered continuations and waiters, used when
+        // resetting the shared state.
+        void reset_completion() noexcept;
+
         mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
+        std::atomic<std::size_t> completion_state_;
+        completed_callback_type on_completed_single_;
         completed_callback_vector_type on_completed_;
         local::detail::condition_variable cond_;    // threads waiting in read
     };
@@ -388,6 +444,8 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
             state_.store(value, std::memory_order_relaxed);
+            completion_state_.store(
+                completion_ready, std::memory_order_relaxed);
         }
 
         future_data_base(init_no_addref no_addref, std::exception_ptr const& e)
@@ -397,6 +455,8 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(e);
             state_.store(exception, std::memory_order_relaxed);
+            completion_state_.store(
+                completion_ready, std::memory_order_relaxed);
         }
         future_data_base(init_no_addref no_addref, std::exception_ptr&& e)
           : base_type(no_addref)
@@ -405,6 +465,8 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(HPX_MOVE(e));
             state_.store(exception, std::memory_order_relaxed);
+            completion_state_.store(
+                completion_ready, std::memory_order_relaxed);
         }
 
         ~future_data_base() noexcept override
@@ -456,14 +518,6 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
@@ -472,35 +526,14 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
+            // wake up waiting threads and invoke the registered continuations
+            mark_ready();
         }
 
         void set_exception(std::exception_ptr data) override
@@ -516,14 +549,6 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(HPX_MOVE(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
@@ -532,35 +557,14 @@ namespace hpx { namespace lcos { namespace detail {
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
+            // wake up waiting threads and invoke the registered continuations
+            mark_ready();
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -628,7 +632,7 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
 
-            on_completed_.clear();
+            reset_completion();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -638,6 +642,7 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        using base_type::completion_state_;
         using base_type::mtx_;
         using base_type::on_completed_;
         using base_type::state_;
@@ -63,6 +63,28 @@ namespace hpx { namespace lcos { namespace detail {
         state->set_on_completed(util::deferred_call(HPX_FORWARD(N, next)));
     }
 
+    // Attach the given callback to the shared state unless it is ready
+    // already, the future is deferred executed if possible first. Returns
+    // whether the callback was attached.
+    template <typename SharedState, typename F>
+    bool attach_when_not_ready(SharedState const& state, F&& f_ready)
+    {
+        if (state.get() == nullptr || state->is_ready())
+        {
+            return false;
+        }
+
+        // execute_deferred might make the future ready
+        state->execute_deferred();
+        if (state->is_ready())
+        {
+            return false;
+        }
+
+        state->set_on_completed(HPX_FORWARD(F, f_ready));
+        return true;
+    }
+
     // Acquire a future range from the given begin and end iterator
     template <typename Iterator,
         typename Container = std::vector<future_iterator_traits_t<Iterator>>>
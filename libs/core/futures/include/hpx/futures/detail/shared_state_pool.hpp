@@ -0,0 +1,113 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Future shared states are allocated from per-thread free lists bucketed
+    // into a small number of size classes. A shared state released on a
+    // thread other than the one it was allocated on is handed back to its
+    // owning thread through a lock-free remote-free list. Requests which do
+    // not fit into any of the size classes are forwarded to the internal
+    // allocator.
+    HPX_CORE_EXPORT void* shared_state_pool_allocate(std::size_t size);
+    HPX_CORE_EXPORT void shared_state_pool_deallocate(
+        void* p, std::size_t size) noexcept;
+
+    // allocation statistics (exposed as performance counters)
+    HPX_CORE_EXPORT std::int64_t get_shared_state_pool_allocation_count(
+        bool reset);
+    HPX_CORE_EXPORT std::int64_t get_shared_state_pool_hit_count(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_shared_state_pool_remote_free_count(
+        bool reset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocator used for the shared states of futures created without an
+    // explicit user-supplied allocator.
+    template <typename T = char>
+    struct shared_state_pool_allocator
+    {
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = shared_state_pool_allocator<U>;
+        };
+
+        shared_state_pool_allocator() = default;
+
+        template <typename U>
+        constexpr shared_state_pool_allocator(
+            shared_state_pool_allocator<U> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(size_type n)
+        {
+            if constexpr (alignof(T) > alignof(std::max_align_t))
+            {
+                return util::internal_allocator<T>{}.allocate(n);
+            }
+            else
+            {
+                if (max_size() < n)
+                {
+                    throw std::bad_array_new_length();
+                }
+                return static_cast<T*>(
+                    shared_state_pool_allocate(n * sizeof(T)));
+            }
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            if constexpr (alignof(T) > alignof(std::max_align_t))
+            {
+                util::internal_allocator<T>{}.deallocate(p, n);
+            }
+            else
+            {
+                shared_state_pool_deallocate(p, n * sizeof(T));
+            }
+        }
+
+        constexpr size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+    };
+
+    template <typename T, typename U>
+    constexpr bool operator==(shared_state_pool_allocator<T> const&,
+        shared_state_pool_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    constexpr bool operator!=(shared_state_pool_allocator<T> const&,
+        shared_state_pool_allocator<U> const&) noexcept
+    {
+        return false;
+    }
+}}}    // namespace hpx::lcos::detail
@@ -9,7 +9,6 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/concepts/concepts.hpp>
@@ -21,6 +20,7 @@
 #include <hpx/functional/detail/invoke.hpp>
 #include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/futures/traits/detail/future_await_traits.hpp>
@@ -1494,7 +1494,8 @@ namespace hpx {
     make_ready_future(Ts&&... ts)
     {
         return make_ready_future_alloc<T>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(Ts, ts)...);
+            lcos::detail::shared_state_pool_allocator<>{},
+            HPX_FORWARD(Ts, ts)...);
     }
     ///////////////////////////////////////////////////////////////////////////
     // extension: create a pre-initialized future object, with allocator
@@ -1512,7 +1513,8 @@ namespace hpx {
         T&& init)
     {
         return hpx::make_ready_future_alloc<hpx::util::decay_unwrap_t<T>>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T, init));
+            lcos::detail::shared_state_pool_allocator<>{},
+            HPX_FORWARD(T, init));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1582,7 +1584,7 @@ namespace hpx {
     HPX_FORCEINLINE future<void> make_ready_future()
     {
         return make_ready_future_alloc<void>(
-            hpx::util::internal_allocator<>{}, util::unused);
+            lcos::detail::shared_state_pool_allocator<>{}, util::unused);
     }
 
     // Extension (see wg21.link/P0319)
@@ -1697,7 +1699,8 @@ namespace hpx { namespace lcos {
         hpx::future<T>> make_ready_future(Ts&&... ts)
     {
         return hpx::make_ready_future_alloc<T>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(Ts, ts)...);
+            lcos::detail::shared_state_pool_allocator<>{},
+            HPX_FORWARD(Ts, ts)...);
     }
 
     template <int DeductionGuard = 0, typename Allocator, typename T>
@@ -1718,7 +1721,8 @@ namespace hpx { namespace lcos {
     hpx::future<hpx::util::decay_unwrap_t<T>> make_ready_future(T&& init)
     {
         return hpx::make_ready_future_alloc<hpx::util::decay_unwrap_t<T>>(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T, init));
+            lcos::detail::shared_state_pool_allocator<>{},
+            HPX_FORWARD(T, init));
     }
 
     template <typename T>
@@ -1775,7 +1779,7 @@ namespace hpx { namespace lcos {
     inline hpx::future<void> make_ready_future()
     {
         return hpx::make_ready_future_alloc<void>(
-            hpx::util::internal_allocator<>{}, util::unused);
+            lcos::detail::shared_state_pool_allocator<>{}, util::unused);
     }
 
     template <typename T>
@@ -8,13 +8,13 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution_base/execution.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/modules/errors.hpp>
@@ -673,13 +673,14 @@ namespace hpx { namespace lcos { namespace local {
                 !std::is_same_v<std::decay_t<F>, futures_factory>>>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, HPX_FORWARD(F, f)))
+                lcos::detail::shared_state_pool_allocator<>{},
+                HPX_FORWARD(F, f)))
         {
         }
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, f))
+                lcos::detail::shared_state_pool_allocator<>{}, f))
         {
         }
 
@@ -253,26 +253,118 @@ namespace hpx { namespace lcos { namespace detail {
         if (!data_sink)
             return;
 
-        if (is_ready())
+        // The first continuation is stored in on_completed_single_ without
+        // locking: claim the slot, store the continuation, and publish it. If
+        // the shared state was made ready in between, mark_ready has left
+        // invoking the continuation to us.
+        std::size_t s = completion_state_.load(std::memory_order_acquire);
+        while (!(s &
+            (completion_ready | completion_attaching | completion_attached)))
+        {
+            if (completion_state_.compare_exchange_weak(s,
+                    s | completion_attaching, std::memory_order_acquire))
+            {
+                on_completed_single_ = HPX_MOVE(data_sink);
+
+                s = completion_state_.fetch_or(
+                    completion_attached, std::memory_order_acq_rel);
+                if (s & completion_ready)
+                {
+                    completed_callback_type on_completed =
+                        HPX_MOVE(on_completed_single_);
+                    on_completed_single_.reset();
+
+                    // invoke the callback (continuation) function
+                    handle_on_completed(HPX_MOVE(on_completed));
+                }
+                return;
+            }
+        }
+
+        if (s & completion_ready)
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(HPX_MOVE(data_sink));
+            return;
+        }
+
+        // more than one continuation is attached, fall back to the list
+        std::unique_lock l(mtx_);
+        s = completion_state_.fetch_or(
+            completion_has_list, std::memory_order_acq_rel);
+        if (s & completion_ready)
+        {
+            l.unlock();
+
+            // invoke the callback (continuation) function
+            handle_on_completed(HPX_MOVE(data_sink));
         }
         else
         {
-            std::unique_lock l(mtx_);
-            if (is_ready())
-            {
-                l.unlock();
+            on_completed_.push_back(HPX_MOVE(data_sink));
+        }
+    }
 
-                // invoke the callback (continuation) function
-                handle_on_completed(HPX_MOVE(data_sink));
-            }
-            else
+    void future_data_base<traits::detail::future_data_void>::mark_ready()
+    {
+        std::size_t const s = completion_state_.fetch_or(
+            completion_ready, std::memory_order_acq_rel);
+        HPX_ASSERT(!(s & completion_ready));
+
+        // Neither the lock nor the condition variable are touched unless
+        // some thread announced itself as waiting or more than one
+        // continuation has been attached.
+        completed_callback_vector_type on_completed;
+        if (s & (completion_has_list | completion_has_waiters))
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+
+            // handle all threads waiting for the future to become ready
+            on_completed = HPX_MOVE(on_completed_);
+            on_completed_.clear();
+
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            while (
+                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
             {
-                on_completed_.push_back(HPX_MOVE(data_sink));
+                l = std::unique_lock<mutex_type>(mtx_);
             }
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+            HPX_ASSERT_DOESNT_OWN_LOCK(l);
         }
+
+        // invoke the callback (continuation) functions, the one stored in
+        // on_completed_single_ was attached first
+        if (s & completion_attached)
+        {
+            completed_callback_type single = HPX_MOVE(on_completed_single_);
+            on_completed_single_.reset();
+
+            handle_on_completed(HPX_MOVE(single));
+        }
+
+        if (!on_completed.empty())
+        {
+            handle_on_completed(HPX_MOVE(on_completed));
+        }
+    }
+
+    void future_data_base<
+        traits::detail::future_data_void>::reset_completion() noexcept
+    {
+        // no locking is required as semantics guarantee a single writer and
+        // no reader
+        completion_state_.store(0, std::memory_order_relaxed);
+        on_completed_single_.reset();
+        on_completed_.clear();
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -283,18 +375,22 @@ namespace hpx { namespace lcos { namespace detail {
         if (s == empty)
         {
             std::unique_lock l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
-            if (s == empty)
+
+            // announce this thread as waiting, this makes mark_ready acquire
+            // the lock and notify the condition variable
+            if (!(completion_state_.fetch_or(completion_has_waiters,
+                      std::memory_order_acq_rel) &
+                    completion_ready))
             {
                 cond_.wait(l, "future_data_base::wait", ec);
                 if (ec)
                 {
                     return s;
                 }
-
-                // reload the state, it's not empty anymore
-                s = state_.load(std::memory_order_relaxed);
             }
+
+            // reload the state, it's not empty anymore
+            s = state_.load(std::memory_order_acquire);
         }
 
         if (&ec != &throws)
@@ -312,7 +408,9 @@ namespace hpx { namespace lcos { namespace detail {
         if (state_.load(std::memory_order_acquire) == empty)
         {
             std::unique_lock l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            if (!(completion_state_.fetch_or(completion_has_waiters,
+                      std::memory_order_acq_rel) &
+                    completion_ready))
             {
                 threads::thread_restart_state const reason = cond_.wait_until(
                     l, abs_time, "future_data_base::wait_until", ec);
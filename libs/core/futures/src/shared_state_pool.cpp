@@ -0,0 +1,304 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    namespace {
+
+        // Blocks are handed out in multiples of size_class_granularity bytes,
+        // including the block header.
+        constexpr std::size_t size_class_granularity = 64;
+        constexpr std::size_t num_size_classes = 8;
+
+        // maximum number of free blocks a thread keeps per size class
+        constexpr std::size_t max_cached_blocks = 256;
+
+        struct thread_cache;
+
+        // Every block is preceded by a header recording the cache it was
+        // allocated from. The header keeps the payload aligned for any
+        // fundamental type.
+        struct alignas(std::max_align_t) block_header
+        {
+            thread_cache* owner;
+            block_header* next;
+        };
+
+        constexpr std::size_t max_pooled_size =
+            num_size_classes * size_class_granularity - sizeof(block_header);
+
+        constexpr std::size_t size_class(std::size_t size) noexcept
+        {
+            return (size + sizeof(block_header) - 1) / size_class_granularity;
+        }
+
+        constexpr std::size_t block_size(std::size_t cls) noexcept
+        {
+            return (cls + 1) * size_class_granularity;
+        }
+
+        block_header* allocate_block(std::size_t cls)
+        {
+            return reinterpret_cast<block_header*>(
+                util::internal_allocator<char>{}.allocate(block_size(cls)));
+        }
+
+        void deallocate_block(block_header* b, std::size_t cls) noexcept
+        {
+            util::internal_allocator<char>{}.deallocate(
+                reinterpret_cast<char*>(b), block_size(cls));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A thread_cache is owned by exactly one OS thread at a time. Caches
+        // are never destroyed: when its thread exits, the cache is abandoned
+        // and later adopted by a new thread, as blocks allocated from it may
+        // still be released by other threads.
+        struct thread_cache
+        {
+            // accessed by the owning thread only
+            block_header* free_[num_size_classes] = {};
+            std::size_t free_count_[num_size_classes] = {};
+
+            // blocks released by other threads
+            std::atomic<block_header*> remote_free_[num_size_classes] = {};
+
+            std::atomic<std::int64_t> allocations_{0};
+            std::atomic<std::int64_t> hits_{0};
+            std::atomic<std::int64_t> remote_frees_{0};
+
+            void push_remote(block_header* b, std::size_t cls) noexcept
+            {
+                block_header* head =
+                    remote_free_[cls].load(std::memory_order_relaxed);
+                do
+                {
+                    b->next = head;
+                } while (!remote_free_[cls].compare_exchange_weak(
+                    head, b, std::memory_order_release));
+
+                remote_frees_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // move all blocks released by other threads to the local list
+            bool collect_remote(std::size_t cls) noexcept
+            {
+                block_header* b = remote_free_[cls].exchange(
+                    nullptr, std::memory_order_acquire);
+                if (b == nullptr)
+                {
+                    return false;
+                }
+
+                HPX_ASSERT(free_[cls] == nullptr);
+                free_[cls] = b;
+                for (/**/; b != nullptr; b = b->next)
+                {
+                    ++free_count_[cls];
+                }
+                return true;
+            }
+        };
+
+        struct thread_cache_registry
+        {
+            thread_cache* adopt()
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                if (!abandoned_.empty())
+                {
+                    thread_cache* c = abandoned_.back();
+                    abandoned_.pop_back();
+                    return c;
+                }
+
+                all_.push_back(new thread_cache);
+                return all_.back();
+            }
+
+            void abandon(thread_cache* c)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                abandoned_.push_back(c);
+            }
+
+            template <typename F>
+            std::int64_t accumulate(F&& f)
+            {
+                std::int64_t result = 0;
+
+                std::lock_guard<std::mutex> l(mtx_);
+                for (thread_cache* c : all_)
+                {
+                    result += f(*c);
+                }
+                return result;
+            }
+
+            std::mutex mtx_;
+            std::vector<thread_cache*> all_;
+            std::vector<thread_cache*> abandoned_;
+
+            // allocations which bypassed the per-thread caches
+            std::atomic<std::int64_t> uncached_allocations_{0};
+        };
+
+        // intentionally leaked, caches must outlive all shared states
+        thread_cache_registry& get_registry()
+        {
+            static thread_cache_registry* registry = new thread_cache_registry;
+            return *registry;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        thread_local thread_cache* current_cache = nullptr;
+        thread_local bool current_cache_released = false;
+
+        struct thread_cache_holder
+        {
+            ~thread_cache_holder()
+            {
+                current_cache_released = true;
+                if (current_cache != nullptr)
+                {
+                    get_registry().abandon(current_cache);
+                    current_cache = nullptr;
+                }
+            }
+        };
+
+        // returns nullptr once the thread-local cache has been released
+        // during thread shutdown
+        thread_cache* get_thread_cache()
+        {
+            if (current_cache == nullptr && !current_cache_released)
+            {
+                static thread_local thread_cache_holder holder;
+                (void) holder;
+
+                current_cache = get_registry().adopt();
+            }
+            return current_cache;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* shared_state_pool_allocate(std::size_t size)
+    {
+        if (size > max_pooled_size)
+        {
+            get_registry().uncached_allocations_.fetch_add(
+                1, std::memory_order_relaxed);
+            return util::internal_allocator<char>{}.allocate(size);
+        }
+
+        std::size_t const cls = size_class(size);
+
+        thread_cache* c = get_thread_cache();
+        if (c == nullptr)
+        {
+            get_registry().uncached_allocations_.fetch_add(
+                1, std::memory_order_relaxed);
+
+            block_header* b = allocate_block(cls);
+            b->owner = nullptr;
+            return b + 1;
+        }
+
+        c->allocations_.fetch_add(1, std::memory_order_relaxed);
+
+        block_header* b = c->free_[cls];
+        if (b != nullptr || c->collect_remote(cls))
+        {
+            b = c->free_[cls];
+            c->free_[cls] = b->next;
+            --c->free_count_[cls];
+
+            c->hits_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            b = allocate_block(cls);
+        }
+
+        b->owner = c;
+        return b + 1;
+    }
+
+    void shared_state_pool_deallocate(void* p, std::size_t size) noexcept
+    {
+        if (size > max_pooled_size)
+        {
+            util::internal_allocator<char>{}.deallocate(
+                static_cast<char*>(p), size);
+            return;
+        }
+
+        std::size_t const cls = size_class(size);
+        block_header* b = static_cast<block_header*>(p) - 1;
+
+        thread_cache* owner = b->owner;
+        if (owner == nullptr)
+        {
+            deallocate_block(b, cls);
+        }
+        else if (owner != current_cache)
+        {
+            owner->push_remote(b, cls);
+        }
+        else if (owner->free_count_[cls] < max_cached_blocks)
+        {
+            b->next = owner->free_[cls];
+            owner->free_[cls] = b;
+            ++owner->free_count_[cls];
+        }
+        else
+        {
+            deallocate_block(b, cls);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_shared_state_pool_allocation_count(bool reset)
+    {
+        thread_cache_registry& registry = get_registry();
+        std::int64_t const uncached = reset ?
+            registry.uncached_allocations_.exchange(0) :
+            registry.uncached_allocations_.load(std::memory_order_relaxed);
+
+        return uncached + registry.accumulate([reset](thread_cache& c) {
+            return reset ? c.allocations_.exchange(0) :
+                           c.allocations_.load(std::memory_order_relaxed);
+        });
+    }
+
+    std::int64_t get_shared_state_pool_hit_count(bool reset)
+    {
+        return get_registry().accumulate([reset](thread_cache& c) {
+            return reset ? c.hits_.exchange(0) :
+                           c.hits_.load(std::memory_order_relaxed);
+        });
+    }
+
+    std::int64_t get_shared_state_pool_remote_free_count(bool reset)
+    {
+        return get_registry().accumulate([reset](thread_cache& c) {
+            return reset ? c.remote_frees_.exchange(0) :
+                           c.remote_frees_.load(std::memory_order_relaxed);
+        });
+    }
+}}}    // namespace hpx::lcos::detail
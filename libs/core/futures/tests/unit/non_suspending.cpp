@@ -0,0 +1,124 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that tasks and continuations launched using launch::non_suspending
+// are run as stackless threads, that they may yield, and that attempts to
+// suspend them are reported as invalid_status errors (there is no fallback to
+// a stackful thread).
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+bool is_stackless()
+{
+    hpx::threads::thread_data* self = hpx::threads::get_self_id_data();
+    return self != nullptr && self->is_stackless();
+}
+
+int slow_value()
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    return 42;
+}
+
+template <typename Future>
+void test_invalid_status(Future& f)
+{
+    bool caught_exception = false;
+    try
+    {
+        f.get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_async()
+{
+    hpx::future<bool> f =
+        hpx::async(hpx::launch::non_suspending, &is_stackless);
+    HPX_TEST(f.get());
+
+    // the default launch policy still creates stackful threads
+    HPX_TEST(!hpx::async(hpx::launch::async, &is_stackless).get());
+}
+
+void test_then()
+{
+    hpx::future<int> f1 = hpx::make_ready_future(41);
+    hpx::future<int> f2 =
+        f1.then(hpx::launch::non_suspending, [](hpx::future<int>&& f) {
+            HPX_TEST(is_stackless());
+            return f.get() + 1;
+        });
+    HPX_TEST_EQ(f2.get(), 42);
+
+    hpx::shared_future<int> f3 = hpx::async(&slow_value);
+    hpx::future<int> f4 =
+        f3.then(hpx::launch::non_suspending, [](hpx::shared_future<int>&& f) {
+            HPX_TEST(is_stackless());
+            return f.get() + 1;
+        });
+    HPX_TEST_EQ(f4.get(), 43);
+
+    // other asynchronous continuations still run on stackful threads
+    hpx::future<bool> f5 = hpx::make_ready_future().then(hpx::launch::async,
+        [](hpx::future<void>&&) { return is_stackless(); });
+    HPX_TEST(!f5.get());
+}
+
+void test_suspension()
+{
+    // waiting for a future which is not ready yet would have to suspend
+    hpx::shared_future<int> f1 = hpx::async(&slow_value);
+    hpx::future<int> f2 = hpx::async(hpx::launch::non_suspending, [f1]() {
+        HPX_TEST(is_stackless());
+        return f1.get();
+    });
+    test_invalid_status(f2);
+    HPX_TEST_EQ(f1.get(), 42);
+
+    // yielding falls back to yielding the worker thread
+    hpx::future<void> f3 = hpx::async(hpx::launch::non_suspending, []() {
+        HPX_TEST(is_stackless());
+        hpx::this_thread::yield();
+    });
+    f3.get();
+
+    // explicit suspension is not supported for stackless threads
+    hpx::future<void> f4 = hpx::async(hpx::launch::non_suspending, []() {
+        hpx::this_thread::suspend(
+            hpx::threads::thread_schedule_state::suspended);
+    });
+    test_invalid_status(f4);
+}
+
+int hpx_main()
+{
+    test_async();
+    test_then();
+    test_suspension();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,80 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that a task launched using launch::non_suspending which waits for a
+// future that is not ready yet does not deadlock if it runs on the only worker
+// thread, which is also the thread that has to make the future ready.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_wait_for_promise()
+{
+    hpx::promise<int> p;
+    hpx::shared_future<int> f1 = p.get_future();
+
+    hpx::future<int> f2 =
+        hpx::async(hpx::launch::non_suspending, [f1]() { return f1.get(); });
+
+    bool caught_exception = false;
+    try
+    {
+        f2.get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    p.set_value(42);
+    HPX_TEST_EQ(f1.get(), 42);
+}
+
+void test_wait_for_timer()
+{
+    // the future is made ready by a timer which is handled by the (only)
+    // worker thread
+    hpx::shared_future<int> f1 =
+        hpx::make_ready_future_after(std::chrono::milliseconds(10), 42);
+
+    hpx::future<int> f2 =
+        hpx::async(hpx::launch::non_suspending, [f1]() { return f1.get(); });
+
+    bool caught_exception = false;
+    try
+    {
+        f2.get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    HPX_TEST_EQ(f1.get(), 42);
+}
+
+int hpx_main()
+{
+    test_wait_for_promise();
+    test_wait_for_timer();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <hpx/local/thread.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -393,6 +394,42 @@ void test_copies_of_shared_future_become_ready_together()
     HPX_TEST_EQ(i, 42);
 }
 
+void test_continuations_attached_concurrently()
+{
+    constexpr int num_continuations = 100;
+
+    for (int round = 0; round != 10; ++round)
+    {
+        hpx::promise<int> p;
+        hpx::shared_future<int> sf = p.get_future().share();
+
+        std::atomic<int> count(0);
+        std::vector<hpx::future<hpx::future<int>>> attached;
+        attached.reserve(num_continuations);
+        for (int i = 0; i != num_continuations; ++i)
+        {
+            attached.push_back(hpx::async([&count, sf]() {
+                return sf.then([&count](hpx::shared_future<int>&& f) {
+                    ++count;
+                    return f.get();
+                });
+            }));
+        }
+
+        // make the future ready while the continuations are being attached,
+        // a waiting thread has to be woken up as well
+        hpx::future<int> waiter = hpx::async([sf]() { return sf.get(); });
+        p.set_value(42);
+
+        for (auto&& f : attached)
+        {
+            HPX_TEST_EQ(f.get().get(), 42);
+        }
+        HPX_TEST_EQ(waiter.get(), 42);
+        HPX_TEST_EQ(count.load(), num_continuations);
+    }
+}
+
 void test_shared_future_can_be_move_assigned_from_shared_future()
 {
     hpx::packaged_task<int()> pt(make_int);
@@ -1515,6 +1552,7 @@ int hpx_main(variables_map&)
         test_shared_future_void();
         test_shared_future_ref();
         test_shared_future_for_string();
+        test_continuations_attached_concurrently();
         test_wait_callback();
         test_wait_callback_with_timed_wait();
         test_packaged_task_can_be_moved();
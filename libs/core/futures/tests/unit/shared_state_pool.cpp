@@ -0,0 +1,110 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that future shared states are recycled through the per-thread pools
+// and that shared states released on other threads are handed back to their
+// owning thread.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpx::lcos::detail::get_shared_state_pool_allocation_count;
+using hpx::lcos::detail::get_shared_state_pool_hit_count;
+using hpx::lcos::detail::get_shared_state_pool_remote_free_count;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_local_reuse()
+{
+    get_shared_state_pool_allocation_count(true);
+    get_shared_state_pool_hit_count(true);
+
+    // the shared state of the first future is released before the second
+    // one is created, which therefore has to be served from the pool
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(hpx::make_ready_future(i).get(), i);
+    }
+
+    HPX_TEST_LTE(
+        std::int64_t(100), get_shared_state_pool_allocation_count(false));
+    HPX_TEST_LTE(std::int64_t(99), get_shared_state_pool_hit_count(false));
+}
+
+void test_remote_free()
+{
+    get_shared_state_pool_remote_free_count(true);
+
+    constexpr std::size_t num_futures = 100;
+
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(num_futures);
+    for (std::size_t i = 0; i != num_futures; ++i)
+    {
+        futures.push_back(hpx::make_ready_future(int(i)));
+    }
+
+    // release all shared states on a different OS thread
+    std::thread t([&futures]() {
+        for (std::size_t i = 0; i != futures.size(); ++i)
+        {
+            HPX_TEST_EQ(futures[i].get(), int(i));
+        }
+        futures.clear();
+    });
+    t.join();
+
+    HPX_TEST_LTE(std::int64_t(num_futures),
+        get_shared_state_pool_remote_free_count(false));
+
+    // the blocks released remotely can be reused by this thread
+    get_shared_state_pool_hit_count(true);
+    for (std::size_t i = 0; i != num_futures; ++i)
+    {
+        futures.push_back(hpx::make_ready_future(int(i)));
+    }
+    HPX_TEST_LTE(
+        std::int64_t(num_futures), get_shared_state_pool_hit_count(false));
+}
+
+void test_promise()
+{
+    // promises create their shared state using new, which draws from the
+    // pool as well
+    get_shared_state_pool_allocation_count(true);
+
+    hpx::promise<int> p;
+    hpx::future<int> f = p.get_future();
+    HPX_TEST(!f.is_ready());
+    HPX_TEST_LTE(
+        std::int64_t(1), get_shared_state_pool_allocation_count(false));
+
+    p.set_value(42);
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+int hpx_main()
+{
+    test_local_reuse();
+    test_remote_free();
+    test_promise();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
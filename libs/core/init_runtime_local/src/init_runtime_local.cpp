@@ -236,6 +236,36 @@ namespace hpx {
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+                threads::coroutines::detail::posix::set_use_stack_pool(
+                    cmdline.rtcfg_.use_stack_pool());
+                threads::coroutines::detail::posix::use_huge_pages =
+                    cmdline.rtcfg_.use_stack_huge_pages();
+
+                using threads::coroutines::detail::posix::stack_reclaim_policy;
+                std::string const reclaim_policy =
+                    cmdline.rtcfg_.get_stack_reclaim_policy();
+                if (reclaim_policy == "none")
+                {
+                    threads::coroutines::detail::posix::reclaim_policy =
+                        stack_reclaim_policy::none;
+                }
+                else if (reclaim_policy == "lazy")
+                {
+                    threads::coroutines::detail::posix::reclaim_policy =
+                        stack_reclaim_policy::lazy;
+                }
+                else if (reclaim_policy == "eager")
+                {
+                    threads::coroutines::detail::posix::reclaim_policy =
+                        stack_reclaim_policy::eager;
+                }
+                else
+                {
+                    throw hpx::detail::command_line_error(
+                        "Invalid value for hpx.stacks.reclaim_policy: '" +
+                        reclaim_policy +
+                        "', expected one of 'none', 'lazy', or 'eager'");
+                }
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
@@ -9,20 +9,22 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/packaged_task.hpp>
 #include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/lcos_local/detail/segmented_receive_buffer.hpp>
 #include <hpx/lcos_local/receive_buffer.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
-#include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <exception>
@@ -97,29 +99,30 @@ namespace hpx { namespace lcos { namespace local {
         template <typename T>
         class unlimited_channel : public channel_impl_base<T>
         {
-            using mutex_type = hpx::spinlock;
-
         public:
             HPX_NON_COPYABLE(unlimited_channel);
 
         public:
             unlimited_channel()
-              : get_generation_(0)
-              , set_generation_(0)
-              , closed_(false)
+              : closed_(false)
             {
             }
 
         protected:
-            hpx::future<T> get(std::size_t generation, bool blocking)
+            // the buffer is empty if all values stored have been requested
+            // and no receiver is waiting for a value
+            bool empty() const noexcept
             {
-                std::unique_lock<mutex_type> l(mtx_);
+                return get_generation_.data_.load(std::memory_order_acquire) ==
+                    set_generation_.data_.load(std::memory_order_acquire);
+            }
 
-                if (buffer_.empty())
+            hpx::future<T> get(std::size_t generation, bool blocking)
+            {
+                if (empty())
                 {
-                    if (closed_)
+                    if (closed_.load(std::memory_order_acquire))
                     {
-                        l.unlock();
                         return hpx::make_exceptional_future<T>(
                             HPX_GET_EXCEPTION(hpx::invalid_status,
                                 "hpx::lcos::local::channel::get",
@@ -128,7 +131,6 @@ namespace hpx { namespace lcos { namespace local {
 
                     if (blocking && this->use_count() == 1)
                     {
-                        l.unlock();
                         return hpx::make_exceptional_future<T>(
                             HPX_GET_EXCEPTION(hpx::invalid_status,
                                 "hpx::lcos::local::channel::get",
@@ -137,18 +139,17 @@ namespace hpx { namespace lcos { namespace local {
                     }
                 }
 
-                ++get_generation_;
+                std::size_t const current = ++get_generation_.data_;
                 if (generation == std::size_t(-1))
-                    generation = get_generation_;
+                    generation = current;
 
-                if (closed_)
+                if (closed_.load(std::memory_order_acquire))
                 {
                     // the requested item must be available, otherwise this
                     // would create a deadlock
                     hpx::future<T> f;
                     if (!buffer_.try_receive(generation, &f))
                     {
-                        l.unlock();
                         return hpx::make_exceptional_future<T>(
                             HPX_GET_EXCEPTION(hpx::invalid_status,
                                 "hpx::lcos::local::channel::get",
@@ -158,19 +159,29 @@ namespace hpx { namespace lcos { namespace local {
                     return f;
                 }
 
-                return buffer_.receive(generation);
+                hpx::future<T> f = buffer_.receive(generation);
+
+                // the channel might have been closed concurrently without
+                // having seen the newly waiting receiver
+                if (!f.is_ready() && closed_.load(std::memory_order_acquire))
+                {
+                    buffer_.cancel_waiting(generation,
+                        HPX_GET_EXCEPTION(hpx::future_cancelled,
+                            hpx::throwmode::lightweight,
+                            "hpx::lcos::local::close",
+                            "canceled waiting on this entry"));
+                }
+                return f;
             }
 
             bool try_get(std::size_t generation, hpx::future<T>* f = nullptr)
             {
-                std::lock_guard<mutex_type> l(mtx_);
-
-                if (buffer_.empty() && closed_)
+                if (empty() && closed_.load(std::memory_order_acquire))
                     return false;
 
-                ++get_generation_;
+                std::size_t const current = ++get_generation_.data_;
                 if (generation == std::size_t(-1))
-                    generation = get_generation_;
+                    generation = current;
 
                 if (f != nullptr)
                     *f = buffer_.receive(generation);
@@ -180,48 +191,38 @@ namespace hpx { namespace lcos { namespace local {
 
             hpx::future<void> set(std::size_t generation, T&& t)
             {
-                std::unique_lock<mutex_type> l(mtx_);
-                if (closed_)
+                if (closed_.load(std::memory_order_acquire))
                 {
-                    l.unlock();
                     return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
                         hpx::invalid_status, "hpx::lcos::local::channel::set",
                         "attempting to write to a closed channel"));
                 }
 
-                ++set_generation_;
+                std::size_t const current = ++set_generation_.data_;
                 if (generation == std::size_t(-1))
-                    generation = set_generation_;
+                    generation = current;
 
-                buffer_.store_received(generation, HPX_MOVE(t), &l);
+                buffer_.store_received(generation, HPX_MOVE(t));
                 return hpx::make_ready_future();
             }
 
             std::size_t close(bool force_delete_entries = false)
             {
-                std::unique_lock<mutex_type> l(mtx_);
-                if (closed_)
+                bool expected = false;
+                if (!closed_.compare_exchange_strong(expected, true))
                 {
-                    l.unlock();
                     HPX_THROW_EXCEPTION(hpx::invalid_status,
                         "hpx::lcos::local::channel::close",
                         "attempting to close an already closed channel");
                     return 0;
                 }
 
-                closed_ = true;
-
-                if (buffer_.empty())
+                if (empty())
                     return 0;
 
-                std::exception_ptr e;
-
-                {
-                    util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
-                    e = HPX_GET_EXCEPTION(hpx::future_cancelled,
-                        hpx::throwmode::lightweight, "hpx::lcos::local::close",
-                        "canceled waiting on this entry");
-                }
+                std::exception_ptr e = HPX_GET_EXCEPTION(hpx::future_cancelled,
+                    hpx::throwmode::lightweight, "hpx::lcos::local::close",
+                    "canceled waiting on this entry");
 
                 // all pending requests which can't be satisfied have to be
                 // canceled at this point, force deleting possibly waiting
@@ -230,11 +231,15 @@ namespace hpx { namespace lcos { namespace local {
             }
 
         private:
-            mutable mutex_type mtx_;
-            receive_buffer<T, hpx::no_mutex> buffer_;
-            std::size_t get_generation_;
-            std::size_t set_generation_;
-            bool closed_;
+            segmented_receive_buffer<T> buffer_;
+
+            // producers and consumers count their generations on separate
+            // cache lines
+            hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+                get_generation_;
+            hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+                set_generation_;
+            std::atomic<bool> closed_;
         };
 
         ///////////////////////////////////////////////////////////////////////
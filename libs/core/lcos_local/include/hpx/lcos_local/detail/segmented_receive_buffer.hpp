@@ -0,0 +1,588 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A lock-free, generation indexed buffer used by unlimited_channel. Values
+    // are stored in fixed size segments which are linked into a list ordered by
+    // generation. Every slot is a small state machine:
+    //
+    //      empty --store--> value --receive--> done
+    //      empty --receive--> waiter --store--> done
+    //
+    // A receiver arriving before the value parks an intrusive shared state in
+    // the slot which is made ready directly by the producer. Producers and
+    // consumers locate their slots through separate hint pointers, thus they
+    // only touch the shared list when moving on to a new segment.
+    //
+    // Segments whose slots have all been consumed are unlinked and reclaimed
+    // once no operation which could still refer to them is in flight
+    // (epoch-based reclamation, tracked separately for both ends).
+    //
+    // Generations are counted starting at one. Generations lying more than
+    // max_segments_ahead segments past the last segment are rejected, as
+    // otherwise a single operation could allocate an unbounded number of
+    // segments.
+    template <typename T>
+    class segmented_receive_buffer
+    {
+    public:
+        static constexpr std::size_t segment_size = 64;
+        static constexpr std::size_t max_segments_ahead = 1024;
+
+    private:
+        using shared_state_type = lcos::detail::future_data<T>;
+        using init_no_addref = typename shared_state_type::init_no_addref;
+
+        static constexpr std::uintptr_t slot_empty = 0;
+        static constexpr std::uintptr_t slot_value = 1;
+        static constexpr std::uintptr_t slot_done = 2;
+        static constexpr std::uintptr_t slot_busy = 3;
+
+        struct slot
+        {
+            // either one of the tags above or the address of a waiting
+            // shared state
+            std::atomic<std::uintptr_t> state_{slot_empty};
+            alignas(T) unsigned char data_[sizeof(T)];
+
+            T* value() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(&data_));
+            }
+
+            static bool is_waiter(std::uintptr_t state) noexcept
+            {
+                return state > slot_busy;
+            }
+        };
+
+        struct segment
+        {
+            explicit segment(std::size_t base) noexcept
+              : base_(base)
+            {
+            }
+
+            slot& operator[](std::size_t generation) noexcept
+            {
+                HPX_ASSERT(generation - base_ < segment_size);
+                return slots_[generation - base_];
+            }
+
+            std::size_t const base_;
+            std::atomic<segment*> next_{nullptr};
+            std::atomic<std::size_t> consumed_{0};
+            segment* retired_next_ = nullptr;
+            slot slots_[segment_size];
+        };
+
+        enum side
+        {
+            producer = 0,
+            consumer = 1
+        };
+
+        // marks an operation being in flight, segments retired during the
+        // epoch it entered will not be freed before it has left
+        class epoch_guard
+        {
+        public:
+            epoch_guard(segmented_receive_buffer& buffer, side s) noexcept
+              : buffer_(buffer)
+              , s_(s)
+            {
+                for (;;)
+                {
+                    epoch_ = buffer_.epoch_.load();
+                    buffer_.active_[s_][epoch_ & 1].data_.fetch_add(1);
+                    if (epoch_ == buffer_.epoch_.load())
+                        break;
+                    buffer_.active_[s_][epoch_ & 1].data_.fetch_sub(1);
+                }
+            }
+
+            ~epoch_guard()
+            {
+                buffer_.active_[s_][epoch_ & 1].data_.fetch_sub(1);
+            }
+
+        private:
+            segmented_receive_buffer& buffer_;
+            side s_;
+            std::size_t epoch_;
+        };
+
+    public:
+        HPX_NON_COPYABLE(segmented_receive_buffer);
+
+    public:
+        // the channels count their generations starting at one, the first
+        // segment must not hold a slot which is never going to be consumed
+        segmented_receive_buffer()
+          : head_(allocate_segment(1))
+          , epoch_(0)
+        {
+            segment* head = head_.load(std::memory_order_relaxed);
+            hint_[producer].data_.store(head, std::memory_order_relaxed);
+            hint_[consumer].data_.store(head, std::memory_order_relaxed);
+            for (auto& active : active_)
+            {
+                active[0].data_.store(0, std::memory_order_relaxed);
+                active[1].data_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        ~segmented_receive_buffer()
+        {
+            free_retired(retired_[0]);
+            free_retired(retired_[1]);
+
+            std::exception_ptr e;
+            segment* s = head_.load(std::memory_order_acquire);
+            while (s != nullptr)
+            {
+                for (slot& sl : s->slots_)
+                {
+                    std::uintptr_t state =
+                        sl.state_.load(std::memory_order_acquire);
+                    if (state == slot_value)
+                    {
+                        std::destroy_at(sl.value());
+                    }
+                    else if (slot::is_waiter(state))
+                    {
+                        // nobody will ever deliver the value
+                        if (!e)
+                        {
+                            e = HPX_GET_EXCEPTION(hpx::broken_promise,
+                                "segmented_receive_buffer::"
+                                "~segmented_receive_buffer",
+                                "the channel was destroyed while waiting on "
+                                "this entry");
+                        }
+                        hpx::intrusive_ptr<shared_state_type> w(
+                            reinterpret_cast<shared_state_type*>(state), false);
+                        w->set_exception(e);
+                    }
+                }
+
+                segment* next = s->next_.load(std::memory_order_relaxed);
+                deallocate_segment(s);
+                s = next;
+            }
+        }
+
+        // Return the number of segments currently allocated by all buffers
+        // holding values of type T (for diagnostic purposes).
+        static std::size_t allocated_segments() noexcept
+        {
+            return allocated_segments_.load(std::memory_order_relaxed);
+        }
+
+        // Return a future for the value stored for the given generation. The
+        // returned future becomes ready once the value has been stored.
+        hpx::future<T> receive(std::size_t generation)
+        {
+            epoch_guard g(*this, consumer);
+
+            bool too_far = false;
+            segment* s = find_segment(consumer, generation, too_far);
+            if (s == nullptr)
+            {
+                return hpx::make_exceptional_future<T>(
+                    HPX_GET_EXCEPTION(hpx::bad_parameter,
+                        "segmented_receive_buffer::receive",
+                        too_far ? "the generation is too far ahead of the "
+                                  "generations in use" :
+                                  "the value for this generation has been "
+                                  "consumed already"));
+            }
+
+            slot& sl = (*s)[generation];
+            std::uintptr_t state = sl.state_.load(std::memory_order_acquire);
+            if (state == slot_empty)
+            {
+                // park a shared state in the slot, the reference created here
+                // is owned by the slot and released by the producer
+                shared_state_type* w = new shared_state_type(init_no_addref{});
+                if (sl.state_.compare_exchange_strong(state,
+                        reinterpret_cast<std::uintptr_t>(w),
+                        std::memory_order_acq_rel))
+                {
+                    return hpx::traits::future_access<hpx::future<T>>::create(
+                        w, true);
+                }
+
+                // the value has been stored in the meantime
+                hpx::intrusive_ptr<shared_state_type> discard(w, false);
+            }
+
+            if (state == slot_value && claim(sl, state))
+            {
+                return hpx::make_ready_future(take(*s, sl));
+            }
+
+            return hpx::make_exceptional_future<T>(
+                HPX_GET_EXCEPTION(hpx::future_already_retrieved,
+                    "segmented_receive_buffer::receive",
+                    "the value for this generation was already requested"));
+        }
+
+        // Return a future for the value stored for the given generation only
+        // if the value is available already.
+        bool try_receive(std::size_t generation, hpx::future<T>* f = nullptr)
+        {
+            epoch_guard g(*this, consumer);
+
+            bool too_far = false;
+            segment* s = find_segment(consumer, generation, too_far);
+            if (s == nullptr)
+                return false;
+
+            slot& sl = (*s)[generation];
+            std::uintptr_t state = sl.state_.load(std::memory_order_acquire);
+            if (state != slot_value)
+                return false;
+
+            if (f == nullptr)
+                return true;
+
+            if (!claim(sl, state))
+                return false;
+
+            *f = hpx::make_ready_future(take(*s, sl));
+            return true;
+        }
+
+        // Store the value for the given generation, each generation may be
+        // stored at most once.
+        template <typename Val>
+        void store_received(std::size_t generation, Val&& val)
+        {
+            epoch_guard g(*this, producer);
+
+            bool too_far = false;
+            segment* s = find_segment(producer, generation, too_far);
+            if (s == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "segmented_receive_buffer::store_received",
+                    too_far ?
+                        "the generation is too far ahead of the generations "
+                        "in use" :
+                        "the value for this generation has been consumed "
+                        "already");
+                return;
+            }
+
+            slot& sl = (*s)[generation];
+            std::uintptr_t state = sl.state_.load(std::memory_order_acquire);
+            if (state == slot_empty)
+            {
+                ::new (static_cast<void*>(&sl.data_)) T(HPX_FORWARD(Val, val));
+                if (sl.state_.compare_exchange_strong(
+                        state, slot_value, std::memory_order_acq_rel))
+                {
+                    return;
+                }
+
+                // a receiver has arrived in the meantime, hand over the value
+                // directly
+                T value = HPX_MOVE(*sl.value());
+                std::destroy_at(sl.value());
+
+                if (slot::is_waiter(state))
+                {
+                    deliver(*s, sl, state, HPX_MOVE(value));
+                    return;
+                }
+            }
+            else if (slot::is_waiter(state))
+            {
+                deliver(*s, sl, state, HPX_FORWARD(Val, val));
+                return;
+            }
+
+            if (state == slot_done)
+            {
+                // the waiting receiver has been canceled already
+                return;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::promise_already_satisfied,
+                "segmented_receive_buffer::store_received",
+                "the value for this generation was already set");
+        }
+
+        // Cancel all waiting receivers, optionally dropping all stored values
+        // as well. Returns the number of canceled or dropped entries.
+        std::size_t cancel_waiting(
+            std::exception_ptr const& e, bool force_delete_entries = false)
+        {
+            epoch_guard g(*this, consumer);
+
+            std::size_t count = 0;
+            for (segment* s = head_.load(std::memory_order_acquire);
+                 s != nullptr; s = s->next_.load(std::memory_order_acquire))
+            {
+                for (slot& sl : s->slots_)
+                {
+                    std::uintptr_t state =
+                        sl.state_.load(std::memory_order_acquire);
+
+                    if (slot::is_waiter(state))
+                    {
+                        if (cancel(*s, sl, state, e))
+                            ++count;
+                    }
+                    else if (state == slot_value && force_delete_entries &&
+                        claim(sl, state))
+                    {
+                        std::destroy_at(sl.value());
+                        sl.state_.store(slot_done, std::memory_order_release);
+                        consumed(*s);
+                        ++count;
+                    }
+                }
+            }
+            return count;
+        }
+
+        // Cancel the receiver waiting on the given generation, if any.
+        bool cancel_waiting(std::size_t generation, std::exception_ptr const& e)
+        {
+            epoch_guard g(*this, consumer);
+
+            bool too_far = false;
+            segment* s = find_segment(consumer, generation, too_far);
+            if (s == nullptr)
+                return false;
+
+            slot& sl = (*s)[generation];
+            std::uintptr_t state = sl.state_.load(std::memory_order_acquire);
+            return slot::is_waiter(state) && cancel(*s, sl, state, e);
+        }
+
+    private:
+        // gain exclusive access to a stored value
+        static bool claim(slot& sl, std::uintptr_t state) noexcept
+        {
+            return sl.state_.compare_exchange_strong(
+                state, slot_busy, std::memory_order_acquire);
+        }
+
+        // must be called after the stored value has been claimed
+        T take(segment& s, slot& sl)
+        {
+            T value = HPX_MOVE(*sl.value());
+            std::destroy_at(sl.value());
+            sl.state_.store(slot_done, std::memory_order_release);
+            consumed(s);
+            return value;
+        }
+
+        template <typename Val>
+        void deliver(segment& s, slot& sl, std::uintptr_t state, Val&& val)
+        {
+            // the CAS guards against the receiver being canceled concurrently
+            if (sl.state_.compare_exchange_strong(
+                    state, slot_done, std::memory_order_acq_rel))
+            {
+                hpx::intrusive_ptr<shared_state_type> w(
+                    reinterpret_cast<shared_state_type*>(state), false);
+                w->set_value(HPX_FORWARD(Val, val));
+                consumed(s);
+            }
+        }
+
+        bool cancel(segment& s, slot& sl, std::uintptr_t state,
+            std::exception_ptr const& e)
+        {
+            if (!sl.state_.compare_exchange_strong(
+                    state, slot_done, std::memory_order_acq_rel))
+            {
+                return false;
+            }
+
+            hpx::intrusive_ptr<shared_state_type> w(
+                reinterpret_cast<shared_state_type*>(state), false);
+            w->set_exception(e);
+            consumed(s);
+            return true;
+        }
+
+        // Locate the segment holding the given generation, appending new
+        // segments as needed. Returns nullptr if the generation belongs to a
+        // segment which has been retired already or if it lies more than
+        // max_segments_ahead segments past the last segment (too_far is set
+        // in this case).
+        segment* find_segment(side sd, std::size_t generation, bool& too_far)
+        {
+            std::atomic<segment*>& hint = hint_[sd].data_;
+
+            segment* s = hint.load(std::memory_order_acquire);
+            if (generation < s->base_)
+            {
+                s = head_.load(std::memory_order_acquire);
+                if (generation < s->base_)
+                    return nullptr;
+            }
+
+            while (generation - s->base_ >= segment_size)
+            {
+                segment* next = s->next_.load(std::memory_order_acquire);
+                if (next == nullptr)
+                {
+                    if ((generation - s->base_) / segment_size >
+                        max_segments_ahead)
+                    {
+                        too_far = true;
+                        return nullptr;
+                    }
+
+                    segment* new_segment =
+                        allocate_segment(s->base_ + segment_size);
+                    if (s->next_.compare_exchange_strong(
+                            next, new_segment, std::memory_order_acq_rel))
+                    {
+                        next = new_segment;
+                    }
+                    else
+                    {
+                        deallocate_segment(new_segment);
+                    }
+                }
+                s = next;
+            }
+
+            // the hints only ever move forward
+            segment* h = hint.load(std::memory_order_relaxed);
+            while (h->base_ < s->base_ &&
+                !hint.compare_exchange_weak(h, s, std::memory_order_acq_rel))
+            {
+            }
+
+            return s;
+        }
+
+        // account for a slot having reached its final state
+        void consumed(segment& s)
+        {
+            if (s.consumed_.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+                segment_size)
+            {
+                reclaim();
+            }
+        }
+
+        // Unlink all fully consumed segments from the front of the list and
+        // free the ones which can't be referenced anymore.
+        void reclaim()
+        {
+            std::unique_lock<hpx::spinlock> l(reclaim_mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+                return;    // somebody else is reclaiming already
+
+            std::size_t const epoch = epoch_.load();
+
+            segment* s = head_.load(std::memory_order_acquire);
+            while (s->consumed_.load(std::memory_order_acquire) ==
+                segment_size)
+            {
+                segment* next = s->next_.load(std::memory_order_acquire);
+                if (next == nullptr)
+                    break;    // always keep at least one segment
+
+                // move both hints past the segment to be retired
+                for (auto& hint : hint_)
+                {
+                    segment* expected = s;
+                    hint.data_.compare_exchange_strong(
+                        expected, next, std::memory_order_acq_rel);
+                }
+
+                head_.store(next, std::memory_order_release);
+
+                s->retired_next_ = retired_[epoch & 1];
+                retired_[epoch & 1] = s;
+                s = next;
+            }
+
+            // segments retired during the previous epoch can be freed once
+            // no operation which has entered that epoch is still active
+            std::size_t const previous = (epoch + 1) & 1;
+            if (active_[producer][previous].data_.load() == 0 &&
+                active_[consumer][previous].data_.load() == 0)
+            {
+                free_retired(retired_[previous]);
+                epoch_.store(epoch + 1);
+            }
+        }
+
+        static void free_retired(segment*& retired) noexcept
+        {
+            while (retired != nullptr)
+            {
+                segment* next = retired->retired_next_;
+                deallocate_segment(retired);
+                retired = next;
+            }
+        }
+
+        static segment* allocate_segment(std::size_t base)
+        {
+            segment* s = new segment(base);
+            allocated_segments_.fetch_add(1, std::memory_order_relaxed);
+            return s;
+        }
+
+        static void deallocate_segment(segment* s) noexcept
+        {
+            allocated_segments_.fetch_sub(1, std::memory_order_relaxed);
+            delete s;
+        }
+
+    private:
+        std::atomic<segment*> head_;
+
+        // separate hints for both ends avoid producers and consumers
+        // contending on the same cache line
+        hpx::util::cache_aligned_data<std::atomic<segment*>> hint_[2];
+
+        std::atomic<std::size_t> epoch_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> active_[2][2];
+
+        hpx::spinlock reclaim_mtx_;
+        segment* retired_[2] = {nullptr, nullptr};
+
+        static std::atomic<std::size_t> allocated_segments_;
+    };
+
+    template <typename T>
+    std::atomic<std::size_t>
+        segmented_receive_buffer<T>::allocated_segments_(0);
+}}}}    // namespace hpx::lcos::local::detail
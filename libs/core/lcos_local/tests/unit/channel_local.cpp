@@ -9,6 +9,8 @@
 #include <hpx/modules/testing.hpp>
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -201,6 +203,147 @@ void channel_range_void()
     HPX_TEST_EQ(received_elements.load(), 3);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void concurrent_producers_consumers()
+{
+    // enough values to span many buffer segments
+    constexpr int num_tasks = 4;
+    constexpr int num_values = 10000;
+
+    hpx::lcos::local::channel<int> c;
+
+    std::vector<hpx::future<void>> producers;
+    std::vector<hpx::future<std::int64_t>> consumers;
+    for (int i = 0; i != num_tasks; ++i)
+    {
+        producers.push_back(hpx::async([c]() mutable {
+            for (int j = 0; j != num_values; ++j)
+            {
+                c.set(j);
+            }
+        }));
+        consumers.push_back(hpx::async([c]() mutable {
+            std::int64_t sum = 0;
+            for (int j = 0; j != num_values; ++j)
+            {
+                sum += c.get(hpx::launch::sync);
+            }
+            return sum;
+        }));
+    }
+
+    hpx::wait_all(producers);
+
+    std::int64_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    HPX_TEST_EQ(sum,
+        std::int64_t(num_tasks) * (std::int64_t(num_values) - 1) * num_values /
+            2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a separate value type gives the channels below their own segment counter
+struct segment_value
+{
+    int value = 0;
+};
+
+void channel_reclaims_segments()
+{
+    using buffer_type =
+        hpx::lcos::local::detail::segmented_receive_buffer<segment_value>;
+
+    constexpr std::size_t num_segments = 16;
+    constexpr int num_values = int(num_segments * buffer_type::segment_size);
+
+    {
+        hpx::lcos::local::channel<segment_value> c;
+
+        // values stored ahead of their receivers
+        for (int i = 0; i != num_values; ++i)
+        {
+            c.set(segment_value{i});
+        }
+        HPX_TEST(buffer_type::allocated_segments() >= num_segments);
+
+        for (int i = 0; i != num_values; ++i)
+        {
+            HPX_TEST_EQ(c.get(hpx::launch::sync).value, i);
+        }
+
+        // only the last segment and the segments retired during the most
+        // recent epochs are still allocated
+        HPX_TEST(buffer_type::allocated_segments() <= std::size_t(3));
+
+        // receivers waiting ahead of their values
+        std::vector<hpx::future<segment_value>> values;
+        for (int i = 0; i != num_values; ++i)
+        {
+            values.push_back(c.get());
+        }
+        for (int i = 0; i != num_values; ++i)
+        {
+            c.set(segment_value{i});
+        }
+        for (int i = 0; i != num_values; ++i)
+        {
+            HPX_TEST_EQ(values[i].get().value, i);
+        }
+
+        HPX_TEST(buffer_type::allocated_segments() <= std::size_t(3));
+    }
+
+    HPX_TEST_EQ(buffer_type::allocated_segments(), std::size_t(0));
+}
+
+void channel_rejects_distant_generations()
+{
+    hpx::lcos::local::channel<int> c;
+
+    // a generation far ahead of the ones in use would require allocating
+    // an excessive number of segments
+    std::size_t const distant = std::size_t(1) << 40;
+
+    bool caught_exception = false;
+    try
+    {
+        c.set(42, distant);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    hpx::future<int> f = c.get(hpx::launch::async, distant);
+    HPX_TEST(f.has_exception());
+
+    // generations close to the ones in use are still accepted
+    c.set(43, 1000);
+    HPX_TEST_EQ(c.get(hpx::launch::async, 1000).get(), 43);
+}
+
+void close_cancels_waiting()
+{
+    hpx::lcos::local::channel<int> c;
+
+    hpx::future<int> f1 = c.get();
+    hpx::future<int> f2 = c.get();
+    HPX_TEST(!f1.is_ready());
+    HPX_TEST(!f2.is_ready());
+
+    c.set(42);
+    HPX_TEST_EQ(f1.get(), 42);
+
+    HPX_TEST_EQ(c.close(), std::size_t(1));
+    HPX_TEST_THROW(f2.get(), hpx::exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void deadlock_test()
 {
@@ -345,6 +488,10 @@ int hpx_main()
     dispatch_work();
     channel_range();
     channel_range_void();
+    concurrent_producers_consumers();
+    close_cancels_waiting();
+    channel_reclaims_segments();
+    channel_rejects_distant_generations();
 
     deadlock_test();
     closed_channel_get();
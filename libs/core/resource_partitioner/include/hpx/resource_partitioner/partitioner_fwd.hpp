@@ -71,5 +71,9 @@ namespace hpx { namespace resource {
         abp_priority_fifo = 5,
         abp_priority_lifo = 6,
         shared_priority = 7,
+        local_workrequesting_fifo = 8,
+        local_workrequesting_lifo = 9,
+        deadline = 10,
+        local_priority_chase_lev = 11,
     };
 }}    // namespace hpx::resource
@@ -149,6 +149,18 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_workrequesting_fifo:
+            sched = "local_workrequesting_fifo";
+            break;
+        case resource::local_workrequesting_lifo:
+            sched = "local_workrequesting_lifo";
+            break;
+        case resource::deadline:
+            sched = "deadline";
+            break;
+        case resource::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -475,6 +487,28 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 ==
+            std::string("local-workrequesting-fifo")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workrequesting_fifo;
+        }
+        else if (0 ==
+            std::string("local-workrequesting-lifo")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workrequesting_lifo;
+        }
+        else if (0 == std::string("deadline").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::deadline;
+        }
+        else if (0 ==
+            std::string("local-priority-chase-lev")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -188,6 +188,10 @@ int main(int argc, char* argv[])
         hpx::resource::scheduling_policy::static_,
         hpx::resource::scheduling_policy::static_priority,
         hpx::resource::scheduling_policy::shared_priority,
+        hpx::resource::scheduling_policy::local_workrequesting_fifo,
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        hpx::resource::scheduling_policy::local_workrequesting_lifo,
+#endif
     };
 
     for (auto const scheduler : schedulers)
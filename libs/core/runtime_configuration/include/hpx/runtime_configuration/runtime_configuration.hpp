@@ -112,6 +112,13 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Return whether coroutine stacks should be allocated from stack
+        // pools, whether those should use huge pages, and the policy to use
+        // for reclaiming unused stack memory
+        bool use_stack_pool() const;
+        bool use_stack_huge_pages() const;
+        std::string get_stack_reclaim_policy() const;
 #endif
 
         // return trace_depth for stack-backtraces
@@ -171,6 +171,12 @@ namespace hpx { namespace util {
             "max_idle_backoff_time = "
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
+            "idle_backoff_spin_count = "
+            "${HPX_IDLE_BACKOFF_SPIN_COUNT:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_IDLE_BACKOFF_SPIN_COUNT)) "}",
+            "idle_backoff_pause_count = "
+            "${HPX_IDLE_BACKOFF_PAUSE_COUNT:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_IDLE_BACKOFF_PAUSE_COUNT)) "}",
 #endif
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
@@ -212,6 +218,9 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_USE_STACK_POOL:1}",
+            "use_huge_pages = ${HPX_USE_STACK_HUGE_PAGES:0}",
+            "reclaim_policy = ${HPX_STACK_RECLAIM_POLICY:eager}",
 #endif
 
             "[hpx.threadpools]",
@@ -255,6 +264,16 @@ namespace hpx { namespace util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "steal_budget_core = ${HPX_THREAD_QUEUE_STEAL_BUDGET_CORE:-1}",
+            "steal_budget_l2_cache = "
+            "${HPX_THREAD_QUEUE_STEAL_BUDGET_L2_CACHE:-1}",
+            "steal_budget_l3_cache = "
+            "${HPX_THREAD_QUEUE_STEAL_BUDGET_L3_CACHE:-1}",
+            "steal_budget_numa_domain = "
+            "${HPX_THREAD_QUEUE_STEAL_BUDGET_NUMA_DOMAIN:-1}",
+            "steal_budget_socket = ${HPX_THREAD_QUEUE_STEAL_BUDGET_SOCKET:-1}",
+            "steal_budget_machine = "
+            "${HPX_THREAD_QUEUE_STEAL_BUDGET_MACHINE:-1}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -1095,6 +1114,37 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_pool", 1) != 0;
+        }
+        return true;    // default is true
+    }
+
+    bool runtime_configuration::use_stack_huge_pages() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) !=
+                0;
+        }
+        return false;    // default is false
+    }
+
+    std::string runtime_configuration::get_stack_reclaim_policy() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return sec->get_entry("reclaim_policy", "eager");
+        }
+        return "eager";
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -0,0 +1,442 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+
+    namespace detail {
+
+        // extract the deadline of the thread referenced by an entry of the
+        // pending queue of a thread_queue
+        inline std::chrono::steady_clock::time_point get_queue_entry_deadline(
+            threads::detail::thread_data_reference_counting const* p) noexcept
+        {
+            return static_cast<thread_data const*>(p)->get_deadline();
+        }
+
+        template <typename T>
+        auto get_queue_entry_deadline(T const* p) noexcept
+            -> decltype(get_thread_id_data(p->data)->get_deadline())
+        {
+            return get_thread_id_data(p->data)->get_deadline();
+        }
+
+        // extract the deadline of the thread to be created from an entry of
+        // the staged queue of a thread_queue
+        template <typename T>
+        auto get_queue_entry_deadline(T const* p) noexcept
+            -> decltype(p->data.deadline)
+        {
+            return p->data.deadline;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pending queue ordered by the deadlines of the queued threads (earliest
+    // deadline first). Threads with equal deadlines (including threads
+    // without any deadline) are handed out in FIFO order. The entries are
+    // kept in an implicit 4-ary min-heap, all operations are O(log n) while
+    // holding a spinlock for a short, bounded amount of time. The storage of
+    // the heap is never (re-)allocated while the spinlock is held.
+    template <typename T>
+    struct deadline_heap_backend
+    {
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        explicit deadline_heap_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = size_type(-1))
+          : size_(0)
+          , front_deadline_(no_deadline_value())
+          , sequence_(0)
+        {
+            std::size_t const capacity = std::size_t(initial_size);
+            heap_.reserve(capacity < min_capacity ? min_capacity : capacity);
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)
+        {
+            entry e{detail::get_queue_entry_deadline(val)
+                        .time_since_epoch()
+                        .count(),
+                0, val};
+
+            // storage replaced by a larger one, released after unlocking
+            std::vector<entry> storage;
+
+            std::unique_lock<mutex_type> l(mtx_);
+            while (heap_.size() == heap_.capacity())
+            {
+                // allocate the larger storage outside of the lock
+                std::size_t const capacity = heap_.capacity();
+                l.unlock();
+
+                std::vector<entry>().swap(storage);
+                storage.reserve(
+                    capacity < min_capacity ? min_capacity : 2 * capacity);
+
+                l.lock();
+                if (heap_.capacity() == capacity)
+                {
+                    // this does not allocate as the capacity is sufficient
+                    storage.assign(std::make_move_iterator(heap_.begin()),
+                        std::make_move_iterator(heap_.end()));
+                    heap_.swap(storage);
+                }
+            }
+
+            e.sequence = sequence_++;
+            heap_.push_back(HPX_MOVE(e));
+            sift_up(heap_.size() - 1);
+            update_size();
+            return true;
+        }
+
+        bool pop(reference val, bool /* steal */ = true)
+        {
+            if (size_.load(std::memory_order_relaxed) == 0)
+                return false;
+
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+                return false;
+
+            val = HPX_MOVE(heap_.front().value);
+            if (heap_.size() != 1)
+            {
+                heap_.front() = HPX_MOVE(heap_.back());
+                heap_.pop_back();
+                sift_down(0);
+            }
+            else
+            {
+                heap_.pop_back();
+            }
+            update_size();
+            return true;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+        // the deadline of the entry which would be handed out next, this is
+        // a snapshot only (no_deadline() if the queue is empty)
+        std::chrono::steady_clock::time_point front_deadline() const noexcept
+        {
+            return std::chrono::steady_clock::time_point(
+                std::chrono::steady_clock::duration(
+                    front_deadline_.load(std::memory_order_relaxed)));
+        }
+
+    private:
+        using mutex_type = hpx::util::detail::spinlock;
+        using deadline_type = std::chrono::steady_clock::rep;
+
+        static constexpr std::size_t arity = 4;
+        static constexpr std::size_t min_capacity = 64;
+
+        static constexpr deadline_type no_deadline_value() noexcept
+        {
+            return no_deadline().time_since_epoch().count();
+        }
+
+        // must be called while holding the lock
+        void update_size() noexcept
+        {
+            size_.store(heap_.size(), std::memory_order_relaxed);
+            front_deadline_.store(
+                heap_.empty() ? no_deadline_value() : heap_.front().deadline,
+                std::memory_order_relaxed);
+        }
+
+        struct entry
+        {
+            deadline_type deadline;
+            std::uint64_t sequence;
+            T value;
+
+            bool operator<(entry const& rhs) const noexcept
+            {
+                return deadline < rhs.deadline ||
+                    (deadline == rhs.deadline && sequence < rhs.sequence);
+            }
+        };
+
+        void sift_up(std::size_t i) noexcept
+        {
+            entry e = HPX_MOVE(heap_[i]);
+            while (i != 0)
+            {
+                std::size_t const parent = (i - 1) / arity;
+                if (!(e < heap_[parent]))
+                    break;
+                heap_[i] = HPX_MOVE(heap_[parent]);
+                i = parent;
+            }
+            heap_[i] = HPX_MOVE(e);
+        }
+
+        void sift_down(std::size_t i) noexcept
+        {
+            std::size_t const size = heap_.size();
+            entry e = HPX_MOVE(heap_[i]);
+            while (true)
+            {
+                std::size_t const first = i * arity + 1;
+                if (first >= size)
+                    break;
+
+                std::size_t const last =
+                    first + arity < size ? first + arity : size;
+                std::size_t smallest = first;
+                for (std::size_t c = first + 1; c < last; ++c)
+                {
+                    if (heap_[c] < heap_[smallest])
+                        smallest = c;
+                }
+
+                if (!(heap_[smallest] < e))
+                    break;
+
+                heap_[i] = HPX_MOVE(heap_[smallest]);
+                i = smallest;
+            }
+            heap_[i] = HPX_MOVE(e);
+        }
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::atomic<std::size_t> size_;
+        std::atomic<deadline_type> front_deadline_;
+        std::uint64_t sequence_;
+    };
+
+    struct deadline_heap
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = deadline_heap_backend<T>;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_deadline_queue_scheduler_terminated_queue = lockfree_lifo;
+#else
+    using default_deadline_queue_scheduler_terminated_queue = lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler implements earliest-deadline-first (EDF)
+    /// scheduling. It maintains exactly one queue of work items (threads) per
+    /// OS thread, where this OS thread pulls its next work from. Each queue
+    /// hands out the thread with the earliest deadline first, idle OS threads
+    /// steal from the queue whose next thread has the earliest deadline. New
+    /// threads are staged in queues ordered by deadline as well.
+    /// Threads are given a deadline through thread_init_data::deadline or the
+    /// with_deadline property of the thread_pool_scheduler, threads without a
+    /// deadline are run after all threads which have one. Thread priorities
+    /// are ignored.
+    template <typename Mutex = std::mutex,
+        typename StagedQueuing = deadline_heap,
+        typename TerminatedQueuing =
+            default_deadline_queue_scheduler_terminated_queue>
+    class deadline_queue_scheduler
+      : public local_queue_scheduler<Mutex, deadline_heap, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, deadline_heap,
+            StagedQueuing, TerminatedQueuing>;
+
+        deadline_queue_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , deadline_misses_(init.num_queues_)
+        {
+            for (auto& misses : deadline_misses_)
+            {
+                misses.data_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        /// Return the next thread to be executed, return false if none is
+        /// available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd,
+            bool /* enable_stealing */) override
+        {
+            if (!get_next_local_or_stolen_thread(num_thread, running, thrd))
+            {
+                return false;
+            }
+
+            // count the threads which start running too late
+            auto const deadline = get_thread_id_data(thrd)->get_deadline();
+            if (deadline != no_deadline() &&
+                deadline < std::chrono::steady_clock::now())
+            {
+                HPX_ASSERT(num_thread < deadline_misses_.size());
+                deadline_misses_[num_thread].data_.fetch_add(
+                    1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        std::int64_t get_deadline_miss_count(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t count = 0;
+                for (auto& misses : deadline_misses_)
+                {
+                    count += reset ?
+                        misses.data_.exchange(0, std::memory_order_relaxed) :
+                        misses.data_.load(std::memory_order_relaxed);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < deadline_misses_.size());
+            auto& misses = deadline_misses_[num_thread].data_;
+            return reset ? misses.exchange(0, std::memory_order_relaxed) :
+                           misses.load(std::memory_order_relaxed);
+        }
+
+    private:
+        using thread_queue_type = typename base_type::thread_queue_type;
+
+        bool get_next_local_or_stolen_thread(std::size_t num_thread,
+            bool running, threads::thread_id_ref_type& thrd)
+        {
+            // the base class looks at the own queue only if not running
+            if (base_type::get_next_thread(num_thread, false, thrd, false))
+            {
+                return true;
+            }
+
+            HPX_ASSERT(num_thread < this->queues_.size());
+            if (!running ||
+                this->queues_[num_thread]->get_staged_queue_length(
+                    std::memory_order_relaxed) != 0)
+            {
+                // Give up, we should have work to convert.
+                return false;
+            }
+
+            if (this->has_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa))
+            {
+                return steal_earliest(num_thread, running, thrd, nullptr);
+            }
+
+            // first try to steal from other cores in the same NUMA node
+#if !defined(HPX_NATIVE_MIC)    // we know that the MIC has one NUMA domain only
+            std::size_t const pu_number =
+                this->affinity_data_.get_pu_num(num_thread);
+            if (test(this->steals_in_numa_domain_, pu_number) &&
+                steal_earliest(num_thread, running, thrd,
+                    &this->numa_domain_masks_[num_thread]))
+            {
+                return true;
+            }
+
+            // if nothing found, ask everybody else
+            return test(this->steals_outside_numa_domain_, pu_number) &&
+                steal_earliest(num_thread, running, thrd,
+                    &this->outside_numa_domain_masks_[num_thread]);
+#else
+            return steal_earliest(num_thread, running, thrd,
+                &this->numa_domain_masks_[num_thread]);
+#endif
+        }
+
+        // Steal from the queue (out of the ones whose PU is part of the given
+        // mask) whose next pending thread has the earliest deadline.
+        bool steal_earliest(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, mask_type const* domain)
+        {
+            std::size_t const queues_size = this->queues_.size();
+
+            thread_queue_type* victim = nullptr;
+            auto earliest = no_deadline();
+            for (std::size_t i = 1; i != queues_size; ++i)
+            {
+                std::size_t const idx = (i + num_thread) % queues_size;
+                HPX_ASSERT(idx != num_thread);
+
+                if (domain != nullptr &&
+                    !test(*domain, this->affinity_data_.get_pu_num(idx)))
+                {
+                    continue;
+                }
+
+                thread_queue_type* q = this->queues_[idx];
+                if (q->get_pending_queue_length(std::memory_order_relaxed) ==
+                    0)
+                {
+                    continue;
+                }
+
+                auto const deadline = q->get_pending_queue_front_deadline();
+                if (victim == nullptr || deadline < earliest)
+                {
+                    victim = q;
+                    earliest = deadline;
+                }
+            }
+
+            if (victim != nullptr && victim->get_next_thread(thrd, running))
+            {
+                victim->increment_num_stolen_from_pending();
+                this->queues_[num_thread]->increment_num_stolen_to_pending();
+                return true;
+            }
+            return false;
+        }
+
+        std::vector<util::cache_line_data<std::atomic<std::int64_t>>>
+            deadline_misses_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
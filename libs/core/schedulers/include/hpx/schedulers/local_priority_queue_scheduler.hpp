@@ -592,6 +592,65 @@ namespace hpx { namespace threads { namespace policies {
                 ;
         }
 
+        // Create a batch of threads, consecutive staged normal priority
+        // threads targeting the same worker thread are enqueued at once.
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            std::size_t i = 0;
+            while (i != count)
+            {
+                thread_init_data& first = data[i];
+                if (first.run_now ||
+                    first.priority != thread_priority::normal ||
+                    first.schedulehint.mode != thread_schedule_hint_mode::thread)
+                {
+                    create_thread(first, nullptr, ec);
+                    if (ec)
+                        return;
+                    ++i;
+                    continue;
+                }
+
+                std::int16_t const hint = first.schedulehint.hint;
+                std::size_t num_thread = static_cast<std::size_t>(hint);
+                if (num_thread >= num_queues_)
+                {
+                    num_thread %= num_queues_;
+                }
+
+                std::unique_lock<pu_mutex_type> l;
+                num_thread = select_active_pu(l, num_thread);
+
+                std::size_t last = i;
+                do
+                {
+                    data[last].schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+                    ++last;
+                } while (last != count && !data[last].run_now &&
+                    data[last].priority == thread_priority::normal &&
+                    data[last].schedulehint.mode ==
+                        thread_schedule_hint_mode::thread &&
+                    data[last].schedulehint.hint == hint);
+
+                HPX_ASSERT(num_thread < num_queues_);
+                queues_[num_thread].data_->create_thread_bulk(
+                    data + i, last - i, ec);
+
+                LTM_(debug).format(
+                    "local_priority_queue_scheduler::create_thread_bulk "
+                    "normal priority queue: pool({}), scheduler({}), "
+                    "worker_thread({}), count({})",
+                    *this->get_parent_pool(), *this, num_thread, last - i);
+
+                if (ec)
+                    return;
+
+                i = last;
+            }
+        }
+
         // Return the next thread to be executed, return false if none is
         // available
         bool get_next_thread(std::size_t num_thread, bool running,
@@ -756,6 +815,8 @@ namespace hpx { namespace threads { namespace policies {
 
                 queues_[num_thread].data_->schedule_thread(HPX_MOVE(thrd));
             }
+
+            this->wake_idle_worker(num_thread);
         }
 
         void schedule_thread_last(threads::thread_id_ref_type thrd,
@@ -803,6 +864,8 @@ namespace hpx { namespace threads { namespace policies {
                 queues_[num_thread].data_->schedule_thread(
                     HPX_MOVE(thrd), true);
             }
+
+            this->wake_idle_worker(num_thread);
         }
 
         /// Destroy the passed thread as it has been terminated
@@ -497,6 +497,8 @@ namespace hpx { namespace threads { namespace policies {
                 get_thread_id_data(thrd)->get_description());
 
             queues_[num_thread]->schedule_thread(thrd);
+
+            this->wake_idle_worker(num_thread);
         }
 
         void schedule_thread_last(threads::thread_id_ref_type thrd,
@@ -532,6 +534,8 @@ namespace hpx { namespace threads { namespace policies {
 
             HPX_ASSERT(num_thread < queues_.size());
             queues_[num_thread]->schedule_thread(thrd, true);
+
+            this->wake_idle_worker(num_thread);
         }
 
         /// Destroy the passed thread as it has been terminated
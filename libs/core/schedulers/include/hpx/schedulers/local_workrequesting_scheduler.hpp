@@ -0,0 +1,448 @@
+//  Copyright (c) 2007-2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_local_workrequesting_scheduler_terminated_queue =
+        lockfree_lifo;
+#else
+    using default_local_workrequesting_scheduler_terminated_queue =
+        lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workrequesting_scheduler maintains the same set of queues as
+    /// the local_priority_queue_scheduler (one queue of work items per OS
+    /// thread, several high priority queues and one low priority queue).
+    ///
+    /// Instead of having idle worker threads access the queues of other
+    /// (busy) worker threads to steal work, an idle worker posts a steal
+    /// request into the mailbox of a selected victim. The victim checks its
+    /// mailbox whenever it looks for its next HPX thread to run and hands
+    /// over part of its work by moving it into the queues of the requesting
+    /// worker. This way the queues of a worker thread are accessed by other
+    /// worker threads only to enqueue new work, which avoids most of the
+    /// cache-line contention caused by concurrent stealing attempts.
+    ///
+    /// Workers that are not actively scheduling (e.g. suspended worker
+    /// threads) can't answer steal requests; work is stolen from those
+    /// directly as done by the local_priority_queue_scheduler.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_workrequesting_scheduler_terminated_queue>
+    class HPX_CORE_EXPORT local_workrequesting_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+    public:
+        using base_type = local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using thread_queue_type = typename base_type::thread_queue_type;
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+    private:
+        static constexpr std::size_t invalid_thread_num = std::size_t(-1);
+
+        // Number of scheduling loop iterations a thief waits for its request
+        // to be answered before it withdraws it and asks somebody else.
+        static constexpr std::int64_t max_steal_request_wait = 256;
+
+        // Per-worker state of the work requesting protocol. The mailbox holds
+        // the number of the worker that currently asks this worker for work
+        // (only one request may be outstanding per victim). The remaining
+        // members describe the request this worker has sent to some victim
+        // and are modified by the owning worker only, except for 'victim_',
+        // which is reset by the victim once the request has been handled.
+        struct steal_request_data
+        {
+            steal_request_data()
+              : mailbox_(invalid_thread_num)
+              , victim_(invalid_thread_num)
+              , next_victim_(0)
+              , wait_count_(0)
+            {
+            }
+
+            std::atomic<std::size_t> mailbox_;
+            std::atomic<std::size_t> victim_;
+            std::size_t next_victim_;
+            std::int64_t wait_count_;
+        };
+
+    public:
+        local_workrequesting_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , steal_requests_(init.num_queues_)
+        {
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_workrequesting_scheduler";
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing) override
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+
+            // answer pending requests of other workers first, this is the
+            // only place where other workers get access to our work
+            handle_steal_request(num_thread);
+
+            thread_queue_type* this_high_priority_queue = nullptr;
+            thread_queue_type* this_queue = this->queues_[num_thread].data_;
+
+            if (num_thread < this->num_high_priority_queues_)
+            {
+                this_high_priority_queue =
+                    this->high_priority_queues_[num_thread].data_;
+                bool result = this_high_priority_queue->get_next_thread(thrd);
+
+                this_high_priority_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_high_priority_queue->increment_num_pending_misses();
+            }
+
+            {
+                bool result = this_queue->get_next_thread(thrd);
+
+                this_queue->increment_num_pending_accesses();
+                if (result)
+                    return true;
+                this_queue->increment_num_pending_misses();
+
+                bool have_staged = this_queue->get_staged_queue_length(
+                                       std::memory_order_relaxed) != 0;
+
+                // Give up, we should have work to convert.
+                if (have_staged)
+                {
+                    return false;
+                }
+            }
+
+            if (!running)
+            {
+                return false;
+            }
+
+            if (enable_stealing && request_work(num_thread, thrd))
+            {
+                return true;
+            }
+
+            return this->low_priority_queue_.get_next_thread(thrd);
+        }
+
+        /// This is a function which gets called periodically by the thread
+        /// manager to allow for maintenance tasks to be executed in the
+        /// scheduler. Returns true if the OS thread calling this function
+        /// has to be terminated (i.e. no more work has to be done).
+        bool wait_or_add_new(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, bool /* enable_stealing */,
+            std::size_t& added) override
+        {
+            // Staged tasks are handed over through steal requests as well, so
+            // we never touch the staged queues of other workers here.
+            bool result = base_type::wait_or_add_new(
+                num_thread, running, idle_loop_count, false, added);
+
+            // A worker must not exit as long as some victim may still move
+            // work into its queues.
+            if (!running && !withdraw_steal_request(num_thread))
+            {
+                return false;
+            }
+            return result;
+        }
+
+        void on_stop_thread(std::size_t num_thread) override
+        {
+            // make sure nobody waits for an answer from this worker
+            decline_steal_request(num_thread);
+            base_type::on_stop_thread(num_thread);
+        }
+
+    protected:
+        // Check whether some other worker has asked us for work and hand
+        // over part of our work if possible.
+        void handle_steal_request(std::size_t num_thread)
+        {
+            steal_request_data& this_request =
+                steal_requests_[num_thread].data_;
+
+            // fast path: nobody has asked for work, this does not touch any
+            // cache line shared with other workers unless a request is
+            // pending
+            if (this_request.mailbox_.load(std::memory_order_relaxed) ==
+                invalid_thread_num)
+            {
+                return;
+            }
+
+            std::size_t thief = this_request.mailbox_.exchange(
+                invalid_thread_num, std::memory_order_acquire);
+            if (thief == invalid_thread_num)
+            {
+                return;    // the request was withdrawn in the meantime
+            }
+
+            HPX_ASSERT(thief < this->num_queues_ && thief != num_thread);
+
+            std::int64_t const min_tasks_to_steal_pending =
+                this->thread_queue_init_.min_tasks_to_steal_pending_;
+            std::int64_t const min_tasks_to_steal_staged =
+                this->thread_queue_init_.min_tasks_to_steal_staged_;
+
+            std::int64_t moved = 0;
+
+            // give away high priority work only to workers that run high
+            // priority work themselves
+            if (num_thread < this->num_high_priority_queues_ &&
+                thief < this->num_high_priority_queues_)
+            {
+                moved =
+                    transfer_work(this->high_priority_queues_[num_thread].data_,
+                        this->high_priority_queues_[thief].data_,
+                        min_tasks_to_steal_pending, min_tasks_to_steal_staged);
+            }
+
+            if (moved == 0)
+            {
+                moved = transfer_work(this->queues_[num_thread].data_,
+                    this->queues_[thief].data_, min_tasks_to_steal_pending,
+                    min_tasks_to_steal_staged);
+            }
+
+            if (moved != 0)
+            {
+                LTM_(debug).format(
+                    "local_workrequesting_scheduler::handle_steal_request: "
+                    "pool({}), scheduler({}), worker_thread({}), handed over "
+                    "{} items to worker_thread({})",
+                    *this->get_parent_pool(), *this, num_thread, moved, thief);
+            }
+
+            // let the thief know that its request has been answered
+            steal_requests_[thief].data_.victim_.store(
+                invalid_thread_num, std::memory_order_release);
+        }
+
+        // Move up to half of the pending threads (or, if there are not
+        // enough of those, half of the staged tasks) from the victim's queue
+        // to the thief's queue.
+        static std::int64_t transfer_work(thread_queue_type* victim_queue,
+            thread_queue_type* thief_queue,
+            std::int64_t min_tasks_to_steal_pending,
+            std::int64_t min_tasks_to_steal_staged)
+        {
+            std::int64_t pending = victim_queue->get_pending_queue_length(
+                std::memory_order_relaxed);
+            if (pending != 0 && pending >= min_tasks_to_steal_pending)
+            {
+                std::int64_t moved = thief_queue->move_work_items_from(
+                    victim_queue, (pending + 1) / 2);
+                if (moved != 0)
+                {
+                    victim_queue->increment_num_stolen_from_pending(moved);
+                    thief_queue->increment_num_stolen_to_pending(moved);
+                    return moved;
+                }
+            }
+
+            std::int64_t staged = victim_queue->get_staged_queue_length(
+                std::memory_order_relaxed);
+            if (staged != 0 && staged >= min_tasks_to_steal_staged)
+            {
+                std::int64_t moved = thief_queue->move_task_items_from(
+                    victim_queue, (staged + 1) / 2);
+                if (moved != 0)
+                {
+                    victim_queue->increment_num_stolen_from_staged(moved);
+                    thief_queue->increment_num_stolen_to_staged(moved);
+                    return moved;
+                }
+            }
+            return 0;
+        }
+
+        // Answer a pending request without handing over any work.
+        void decline_steal_request(std::size_t num_thread)
+        {
+            std::size_t thief =
+                steal_requests_[num_thread].data_.mailbox_.exchange(
+                    invalid_thread_num, std::memory_order_acquire);
+            if (thief != invalid_thread_num)
+            {
+                steal_requests_[thief].data_.victim_.store(
+                    invalid_thread_num, std::memory_order_release);
+            }
+        }
+
+        // Withdraw the request this worker has sent, if any. Returns false if
+        // the victim is currently handling the request (i.e. some work may
+        // still arrive in our queues).
+        bool withdraw_steal_request(std::size_t num_thread)
+        {
+            steal_request_data& this_request =
+                steal_requests_[num_thread].data_;
+
+            std::size_t victim =
+                this_request.victim_.load(std::memory_order_acquire);
+            if (victim == invalid_thread_num)
+            {
+                return true;
+            }
+
+            std::size_t expected = num_thread;
+            if (steal_requests_[victim].data_.mailbox_.compare_exchange_strong(
+                    expected, invalid_thread_num, std::memory_order_acq_rel))
+            {
+                this_request.victim_.store(
+                    invalid_thread_num, std::memory_order_relaxed);
+                return true;
+            }
+
+            // the victim has picked up the request and will reset 'victim_'
+            // once it's done
+            return this_request.victim_.load(std::memory_order_acquire) ==
+                invalid_thread_num;
+        }
+
+        // Called by an idle worker, sends a steal request to the next
+        // candidate victim if there is no request outstanding.
+        bool request_work(
+            std::size_t num_thread, threads::thread_id_ref_type& thrd)
+        {
+            steal_request_data& this_request =
+                steal_requests_[num_thread].data_;
+
+            if (this_request.victim_.load(std::memory_order_acquire) !=
+                invalid_thread_num)
+            {
+                // don't wait forever for busy victims to respond
+                if (++this_request.wait_count_ < max_steal_request_wait)
+                {
+                    return false;
+                }
+                if (!withdraw_steal_request(num_thread))
+                {
+                    return false;
+                }
+            }
+            this_request.wait_count_ = 0;
+
+            std::vector<std::size_t> const& victims =
+                this->victim_threads_[num_thread].data_;
+            std::size_t const num_victims = victims.size();
+
+            for (std::size_t i = 0; i != num_victims; ++i)
+            {
+                std::size_t idx =
+                    victims[this_request.next_victim_++ % num_victims];
+                HPX_ASSERT(idx != num_thread);
+
+                // only bother victims that seem to have some work
+                if (this->is_core_idle(idx) &&
+                    this->queues_[idx].data_->get_staged_queue_length(
+                        std::memory_order_relaxed) == 0)
+                {
+                    continue;
+                }
+
+                // workers that are not actively scheduling can't respond to
+                // requests, take their work directly
+                if (this->get_state(idx).load(std::memory_order_relaxed) >=
+                    hpx::state::pre_sleep)
+                {
+                    if (steal_directly(num_thread, idx, thrd))
+                    {
+                        return true;
+                    }
+                    continue;
+                }
+
+                // The victim_ member must be set before the request becomes
+                // visible as the victim may answer it right away.
+                this_request.victim_.store(idx, std::memory_order_relaxed);
+
+                std::size_t expected = invalid_thread_num;
+                if (steal_requests_[idx].data_.mailbox_.compare_exchange_strong(
+                        expected, num_thread, std::memory_order_acq_rel))
+                {
+                    return false;
+                }
+
+                // somebody else has asked this victim already
+                this_request.victim_.store(
+                    invalid_thread_num, std::memory_order_relaxed);
+            }
+            return false;
+        }
+
+        bool steal_directly(std::size_t num_thread, std::size_t idx,
+            threads::thread_id_ref_type& thrd)
+        {
+            if (idx < this->num_high_priority_queues_ &&
+                num_thread < this->num_high_priority_queues_)
+            {
+                thread_queue_type* q = this->high_priority_queues_[idx].data_;
+                if (q->get_next_thread(thrd, true, true))
+                {
+                    q->increment_num_stolen_from_pending();
+                    this->high_priority_queues_[num_thread]
+                        .data_->increment_num_stolen_to_pending();
+                    return true;
+                }
+            }
+
+            thread_queue_type* q = this->queues_[idx].data_;
+            if (q->get_next_thread(thrd, true, true))
+            {
+                q->increment_num_stolen_from_pending();
+                this->queues_[num_thread]
+                    .data_->increment_num_stolen_to_pending();
+                return true;
+            }
+            return false;
+        }
+
+        std::vector<util::cache_line_data<steal_request_data>> steal_requests_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
 
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
 #include <hpx/concurrency/deque.hpp>
@@ -18,12 +19,15 @@
 #endif
 
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -153,6 +157,173 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Per-worker Chase-Lev work-stealing deque. The worker owning the queue
+    // pushes and pops at the bottom of the deque (LIFO), all other threads
+    // steal from its top (FIFO).
+    //
+    // Items pushed by any other thread are stored in a separate FIFO inbox
+    // as the deque supports only a single producer, items pushed to the other
+    // end are kept in a second FIFO which is looked at only once everything
+    // else has been exhausted. The owning worker thread is bound explicitly
+    // (see bind_owner) when the worker thread the queue was created for
+    // starts running, and released again when it stops.
+    struct lockfree_chase_lev;
+
+    template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+        using inbox_type = lockfree_fifo_backend<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        // The owner looks at the inbox first once for every so many items
+        // taken from the deque to prevent remotely scheduled threads from
+        // starving.
+        static constexpr std::uint32_t inbox_poll_interval = 16;
+
+        lockfree_chase_lev_backend(size_type initial_size = 0,
+            size_type num_thread = size_type(-1))
+          : queue_(std::size_t(initial_size))
+          , inbox_(initial_size)
+          , last_(0)
+          , num_thread_(num_thread)
+          , owner_()
+          , owner_pops_(0)
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (other_end)
+                return last_.push(val);
+
+            if (is_owner())
+            {
+                queue_.push(val);
+                return true;
+            }
+            return inbox_.push(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)
+        {
+            if (other_end)
+                return last_.push(HPX_MOVE(val));
+
+            if (is_owner())
+            {
+                queue_.push(HPX_MOVE(val));
+                return true;
+            }
+            return inbox_.push(HPX_MOVE(val));
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (!steal && is_owner())
+            {
+                if (++owner_pops_ % inbox_poll_interval == 0 &&
+                    inbox_.pop(val))
+                {
+                    return true;
+                }
+                return queue_.take(val) || inbox_.pop(val) || last_.pop(val);
+            }
+            return queue_.steal(val) || inbox_.pop(val) || last_.pop(val);
+        }
+
+        bool empty()
+        {
+            return queue_.empty() && inbox_.empty() && last_.empty();
+        }
+
+        // Make the calling thread the owner of this queue if it is the
+        // worker thread the queue was created for. Must be called by that
+        // worker thread before it starts pushing to or popping from the
+        // queue.
+        void bind_owner(std::size_t num_thread) noexcept
+        {
+            if (num_thread_ != size_type(-1) && num_thread_ == num_thread)
+            {
+                HPX_ASSERT(owner_.load(std::memory_order_relaxed) ==
+                    std::thread::id());
+                owner_.store(
+                    std::this_thread::get_id(), std::memory_order_release);
+            }
+        }
+
+        // Release the ownership of the queue, must be called by the owning
+        // worker thread once it has stopped using the queue. Items still
+        // held by the deque can be stolen afterwards.
+        void release_owner(std::size_t num_thread) noexcept
+        {
+            if (num_thread_ != size_type(-1) && num_thread_ == num_thread)
+            {
+                HPX_ASSERT(is_owner());
+                owner_.store(std::thread::id(), std::memory_order_release);
+            }
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        container_type queue_;
+        inbox_type inbox_;
+        inbox_type last_;
+        size_type const num_thread_;
+        std::atomic<std::thread::id> owner_;
+
+        // accessed by the owning thread only
+        std::uint32_t owner_pops_;
+    };
+
+    struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
+
+    namespace detail {
+
+        // bind/release the owning worker thread of queues which have one
+        template <typename Queue>
+        auto bind_queue_owner(Queue& queue, std::size_t num_thread, int)
+            -> decltype(queue.bind_owner(num_thread))
+        {
+            return queue.bind_owner(num_thread);
+        }
+
+        template <typename Queue>
+        void bind_queue_owner(Queue&, std::size_t, long)
+        {
+        }
+
+        template <typename Queue>
+        auto release_queue_owner(Queue& queue, std::size_t num_thread, int)
+            -> decltype(queue.release_owner(num_thread))
+        {
+            return queue.release_owner(num_thread);
+        }
+
+        template <typename Queue>
+        void release_queue_owner(Queue&, std::size_t, long)
+        {
+        }
+    }    // namespace detail
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/function.hpp>
@@ -19,6 +20,7 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/queue_holder_numa.hpp>
 #include <hpx/schedulers/queue_holder_thread.hpp>
+#include <hpx/schedulers/steal_hierarchy.hpp>
 #include <hpx/schedulers/thread_queue_mc.hpp>
 #include <hpx/threading_base/print.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
@@ -27,6 +29,7 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -104,6 +107,10 @@ namespace hpx { namespace threads { namespace policies {
     /// high priority queue, the next 4 will share another one and so on. In
     /// addition, the shared_priority_queue_scheduler is NUMA-aware and takes
     /// NUMA scheduling hints into account when creating and scheduling work.
+    /// Idle worker threads steal work following the machine hierarchy: SMT
+    /// siblings first, then cores sharing the L2 and L3 caches, cores on the
+    /// same NUMA domain, and finally other NUMA domains, while the number of
+    /// victims visited on each level is limited by its steal budget.
     ///
     /// Warning: PendingQueuing lifo causes lockup on termination
     template <typename Mutex = std::mutex,
@@ -125,12 +132,14 @@ namespace hpx { namespace threads { namespace policies {
                 const core_ratios& cores_per_queue,
                 detail::affinity_data const& affinity_data,
                 const thread_queue_init_parameters& thread_queue_init,
-                char const* description = "shared_priority_queue_scheduler")
+                char const* description = "shared_priority_queue_scheduler",
+                steal_budgets const& budgets = default_steal_budgets())
               : num_worker_threads_(num_worker_threads)
               , cores_per_queue_(cores_per_queue)
               , thread_queue_init_(thread_queue_init)
               , affinity_data_(affinity_data)
               , description_(description)
+              , steal_budgets_(budgets)
             {
             }
 
@@ -143,6 +152,7 @@ namespace hpx { namespace threads { namespace policies {
               , thread_queue_init_()
               , affinity_data_(affinity_data)
               , description_(description)
+              , steal_budgets_(default_steal_budgets())
             {
             }
 
@@ -151,6 +161,7 @@ namespace hpx { namespace threads { namespace policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+            steal_budgets steal_budgets_;
         };
         typedef init_parameter init_parameter_type;
 
@@ -169,6 +180,8 @@ namespace hpx { namespace threads { namespace policies {
           , num_domains_(1)
           , affinity_data_(init.affinity_data_)
           , queue_parameters_(init.thread_queue_init_)
+          , steal_budgets_(init.steal_budgets_)
+          , steal_cursors_(init.num_worker_threads_)
           , initialized_(false)
           , debug_init_(false)
           , thread_init_counter_(0)
@@ -450,10 +463,51 @@ namespace hpx { namespace threads { namespace policies {
                 ->create_thread(data, thrd, local_num, ec);
         }
 
+        // Try to steal from the victims of the given worker thread on one
+        // level of the machine hierarchy. At most as many victims as allowed
+        // by the budget of the level are visited, the next call continues
+        // with the victims following the ones visited last.
+        template <typename T, typename Operation>
+        bool steal_from_level(std::size_t thief, steal_level level,
+            thread_holder_type* origin, T& var, Operation& operation)
+        {
+            std::size_t const l = static_cast<std::size_t>(level);
+            std::size_t const count =
+                steal_hierarchy_.victim_count(thief, level);
+            std::size_t const budget = (std::min)(count, steal_budgets_[l]);
+            if (budget == 0)
+                return false;
+
+            std::size_t& cursor = steal_cursors_[thief].data_[l];
+            for (std::size_t i = 0; i != budget; ++i)
+            {
+                std::size_t const victim = steal_hierarchy_.victim(
+                    thief, level, fast_mod(cursor + i, count));
+                if (operation(d_lookup_[victim], q_lookup_[victim], origin,
+                        var, true, false))
+                {
+                    return true;
+                }
+            }
+
+            if (budget != count)
+                cursor = fast_mod(cursor + budget, count);
+            return false;
+        }
+
+        // Levels below steal_level::socket refer to worker threads on the
+        // same NUMA domain, stealing from those is controlled by core
+        // stealing, all others by NUMA stealing.
+        static bool is_stealing_enabled(
+            steal_level level, bool steal_numa, bool steal_core) noexcept
+        {
+            return level < steal_level::socket ? steal_core : steal_numa;
+        }
+
         template <typename T>
-        bool steal_by_function(std::size_t domain, std::size_t q_index,
-            bool steal_numa, bool steal_core, thread_holder_type* origin,
-            T& var, const char* prefix,
+        bool steal_by_function(std::size_t thief, std::size_t domain,
+            std::size_t q_index, bool steal_numa, bool steal_core,
+            thread_holder_type* origin, T& var, const char* prefix,
             hpx::function<bool(
                 std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
                 operation_HP,
@@ -482,41 +536,38 @@ namespace hpx { namespace threads { namespace policies {
             // High priority tasks first
             else if (steal_hp_first_)
             {
-                for (std::size_t d = 0; d < num_domains_; ++d)
+                result =
+                    operation_HP(domain, q_index, origin, var, false, false);
+                for (std::size_t l = 0; !result && l != steal_level_count; ++l)
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation_HP(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first BP/HP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
+                    steal_level const level = static_cast<steal_level>(l);
+                    result = is_stealing_enabled(
+                                 level, steal_numa, steal_core) &&
+                        steal_from_level(
+                            thief, level, origin, var, operation_HP);
                 }
-                for (std::size_t d = 0; d < num_domains_; ++d)
+                if (result)
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first NP/LP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
+                    spq_deb.debug(debug::str<>(prefix),
+                        "steal_high_priority_first BP/HP", "D",
+                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                    return result;
+                }
+
+                result = operation(domain, q_index, origin, var, false, false);
+                for (std::size_t l = 0; !result && l != steal_level_count; ++l)
+                {
+                    steal_level const level = static_cast<steal_level>(l);
+                    result = is_stealing_enabled(
+                                 level, steal_numa, steal_core) &&
+                        steal_from_level(thief, level, origin, var, operation);
+                }
+                if (result)
+                {
+                    spq_deb.debug(debug::str<>(prefix),
+                        "steal_high_priority_first NP/LP", "D",
+                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                    return result;
                 }
             }
             else /*steal_after_local*/
@@ -534,63 +585,26 @@ namespace hpx { namespace threads { namespace policies {
                     return result;
                 }
 
-                if (steal_core)
-                {
-                    if (q_counts_[domain] > 1)
-                    {
-                        // steal from other cores on this numa domain?
-                        // use q+1 to avoid testing the same local queue again
-                        q_index = fast_mod((q_index + 1), q_counts_[domain]);
-                        result = operation_HP(
-                            domain, q_index, origin, var, true, true);
-                        result = result ||
-                            operation(domain, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local this numa", "stolen", "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                }
-
-                if (steal_numa)
+                // visit the levels of the machine hierarchy from the closest
+                // to the most distant one, BP/HP before NP/LP on each level
+                for (std::size_t l = 0; l != steal_level_count; ++l)
                 {
-                    // try other numa domains BP/HP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation_HP(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa BP/HP",
-                                (d == 0 ? "taken" : "stolen"), "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                    // try other numa domains NP/LP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
+                    steal_level const level = static_cast<steal_level>(l);
+                    if (!is_stealing_enabled(level, steal_numa, steal_core))
+                        continue;
+
+                    result = steal_from_level(
+                        thief, level, origin, var, operation_HP);
+                    result = result ||
+                        steal_from_level(thief, level, origin, var, operation);
+                    if (result)
                     {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa NP/LP",
-                                (d == 0 ? "taken" : "stolen"), "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
+                        spq_deb.debug(debug::str<>(prefix),
+                            "steal_after_local", "stolen", "level",
+                            get_steal_level_name(level), "D",
+                            debug::dec<2>(domain), "Q",
+                            debug::dec<3>(q_index));
+                        return result;
                     }
                 }
             }
@@ -634,10 +648,10 @@ namespace hpx { namespace threads { namespace policies {
             // first try a high priority task, allow stealing
             // if stealing of HP tasks in on, this will be fine
             // but send a null function for normal tasks
-            bool result = steal_by_function<threads::thread_id_ref_type>(domain,
-                q_index, numa_stealing_, core_stealing_, nullptr, thrd,
-                "SBF-get_next_thread", get_next_thread_function_HP,
-                get_next_thread_function);
+            bool result = steal_by_function<threads::thread_id_ref_type>(
+                this_thread, domain, q_index, numa_stealing_, core_stealing_,
+                nullptr, thrd, "SBF-get_next_thread",
+                get_next_thread_function_HP, get_next_thread_function);
 
             if (result)
                 return result;
@@ -692,9 +706,10 @@ namespace hpx { namespace threads { namespace policies {
                 q_index, "numa_stealing ", numa_stealing_, "core_stealing ",
                 core_stealing_);
 
-            bool added_tasks = steal_by_function<std::size_t>(domain, q_index,
-                numa_stealing_, core_stealing_, receiver, added,
-                "wait_or_add_new", add_new_function_HP, add_new_function);
+            bool added_tasks = steal_by_function<std::size_t>(this_thread,
+                domain, q_index, numa_stealing_, core_stealing_, receiver,
+                added, "wait_or_add_new", add_new_function_HP,
+                add_new_function);
 
             if (added_tasks)
             {
@@ -817,6 +832,8 @@ namespace hpx { namespace threads { namespace policies {
 
             numa_holder_[domain_num].thread_queue(q_index)->schedule_thread(
                 thrd, priority, false);
+
+            this->wake_idle_worker(thread_num);
         }
 
         /// Put task on the back of the queue : not yet implemented
@@ -1009,6 +1026,19 @@ namespace hpx { namespace threads { namespace policies {
                 // compute queue offsets for each domain
                 std::partial_sum(
                     &q_counts_[0], &q_counts_[num_domains_ - 1], &q_offset_[1]);
+
+                // compute the order in which each worker thread visits the
+                // others when stealing
+                std::vector<std::size_t> pus(num_workers_);
+                std::vector<std::size_t> domains(num_workers_);
+                for (std::size_t local_id = 0; local_id != num_workers_;
+                     ++local_id)
+                {
+                    pus[local_id] = affinity_data_.get_pu_num(
+                        local_to_global_thread_index(local_id));
+                    domains[local_id] = d_lookup_[local_id];
+                }
+                steal_hierarchy_.init(topo, pus, domains);
             }
 
             // all threads should now complete their initialization by creating
@@ -1399,6 +1429,15 @@ namespace hpx { namespace threads { namespace policies {
 
         const thread_queue_init_parameters queue_parameters_;
 
+        // the order in which worker threads steal from each other, the
+        // maximal number of victims visited per level, and for each worker
+        // thread the position of the next victim to visit on each level
+        steal_hierarchy steal_hierarchy_;
+        steal_budgets const steal_budgets_;
+        std::vector<util::cache_line_data<std::array<std::size_t,
+            steal_level_count>>>
+            steal_cursors_;
+
         // used to make sure the scheduler is only initialized once on a thread
         std::mutex init_mutex;
         bool initialized_;
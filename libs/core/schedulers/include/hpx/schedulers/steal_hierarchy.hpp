@@ -0,0 +1,109 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The levels of the machine hierarchy a worker thread steals work from,
+    /// ordered from the closest to the most distant one. Every other worker
+    /// thread is assigned to the innermost level it shares with the thief.
+    enum class steal_level : std::uint8_t
+    {
+        core = 0,           ///< SMT siblings running on the same core
+        l2_cache = 1,       ///< cores sharing the same L2 cache
+        l3_cache = 2,       ///< cores sharing the same L3 cache (CCX)
+        numa_domain = 3,    ///< cores on the same NUMA domain
+        socket = 4,         ///< other NUMA domains on the same socket
+        machine = 5,        ///< NUMA domains on remote sockets
+    };
+
+    constexpr std::size_t steal_level_count = 6;
+
+    HPX_CORE_EXPORT char const* get_steal_level_name(steal_level level);
+
+    /// The maximal number of victims a worker thread tries to steal from on
+    /// each of the levels of the machine hierarchy during one stealing round.
+    /// A budget of zero disables stealing from that level.
+    using steal_budgets = std::array<std::size_t, steal_level_count>;
+
+    /// By default all victims on all levels are visited.
+    inline steal_budgets default_steal_budgets() noexcept
+    {
+        steal_budgets budgets;
+        budgets.fill(std::size_t(-1));
+        return budgets;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The order in which a worker thread visits the other worker threads of
+    /// a scheduler when trying to steal work, grouped by the levels of the
+    /// machine hierarchy.
+    class HPX_CORE_EXPORT steal_hierarchy
+    {
+    public:
+        steal_hierarchy() = default;
+
+        /// Compute the stealing order for all worker threads. \a pus holds
+        /// the processing unit each worker thread is bound to, \a domains
+        /// the (scheduler specific) NUMA domain each worker thread belongs
+        /// to. Worker threads on different domains are never assigned to any
+        /// level below steal_level::socket.
+        void init(topology const& topo, std::vector<std::size_t> const& pus,
+            std::vector<std::size_t> const& domains);
+
+        std::size_t size() const noexcept
+        {
+            return orders_.size();
+        }
+
+        /// Return the number of victims of the given worker thread on the
+        /// given level.
+        std::size_t victim_count(
+            std::size_t thief, steal_level level) const noexcept
+        {
+            HPX_ASSERT(thief < orders_.size());
+            std::size_t const l = static_cast<std::size_t>(level);
+            return orders_[thief].offsets_[l + 1] - orders_[thief].offsets_[l];
+        }
+
+        /// Return the n-th victim (worker thread index) of the given worker
+        /// thread on the given level.
+        std::size_t victim(
+            std::size_t thief, steal_level level, std::size_t n) const noexcept
+        {
+            HPX_ASSERT(n < victim_count(thief, level));
+            order const& o = orders_[thief];
+            return o.victims_[o.offsets_[static_cast<std::size_t>(level)] + n];
+        }
+
+    private:
+        struct order
+        {
+            // victims ordered by level, all victims of level l are stored in
+            // the range [offsets_[l], offsets_[l + 1])
+            std::vector<std::size_t> victims_;
+            std::array<std::size_t, steal_level_count + 1> offsets_;
+        };
+
+        std::vector<order> orders_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
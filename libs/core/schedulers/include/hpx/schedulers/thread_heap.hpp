@@ -0,0 +1,176 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+
+    namespace detail {
+
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        // prefer handing out the most recently used thread objects as their
+        // stacks are more likely to be still cached
+        using thread_heap_items_type = lockfree_lifo::apply<thread_data*>::type;
+#else
+        using thread_heap_items_type = lockfree_fifo::apply<thread_data*>::type;
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // Lock-free pool of recycled thread objects of one stack size which
+        // is shared between all thread queues running on the same NUMA
+        // domain. It receives the thread objects which do not fit into the
+        // queue-local thread heaps and is used to refill those.
+        class HPX_CORE_EXPORT thread_heap_overflow
+        {
+        public:
+            thread_heap_overflow();
+            ~thread_heap_overflow();
+
+            thread_heap_overflow(thread_heap_overflow const&) = delete;
+            thread_heap_overflow& operator=(
+                thread_heap_overflow const&) = delete;
+
+            void push(thread_data* p)
+            {
+                count_.fetch_add(1, std::memory_order_relaxed);
+                items_.push(p);
+            }
+
+            bool pop(thread_data*& p)
+            {
+                if (count_.load(std::memory_order_relaxed) <= 0 ||
+                    !items_.pop(p))
+                {
+                    return false;
+                }
+                count_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            std::int64_t size() const noexcept
+            {
+                return count_.load(std::memory_order_relaxed);
+            }
+
+        private:
+            thread_heap_items_type items_;
+            std::atomic<std::int64_t> count_;
+        };
+
+        // Return the overflow pool for the given stack size and NUMA domain.
+        // The pool is created on first use and is destroyed (together with
+        // all thread objects it holds) once the last thread heap referring
+        // to it has gone away.
+        HPX_CORE_EXPORT std::shared_ptr<thread_heap_overflow>
+        get_thread_heap_overflow(
+            std::ptrdiff_t stacksize, std::size_t numa_node);
+
+        // Return the NUMA domain of the processing unit the calling thread is
+        // bound to (zero if the calling thread is not bound).
+        HPX_CORE_EXPORT std::size_t get_thread_heap_numa_node();
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Lock-free cache of recycled thread objects of one stack size, owned by
+    /// a single thread queue.
+    ///
+    /// Once the number of cached objects exceeds the capacity of the heap,
+    /// recycled objects are handed to the (NUMA-local) overflow pool, which in
+    /// turn is used to refill the heap whenever it runs empty. Thread objects
+    /// taken from the overflow pool may have been created by a different
+    /// thread queue, callers have to re-associate those with their queue.
+    class thread_heap
+    {
+    public:
+        thread_heap()
+          : capacity_(0)
+          , count_(0)
+          , overflow_(nullptr)
+        {
+        }
+
+        thread_heap(thread_heap const&) = delete;
+        thread_heap& operator=(thread_heap const&) = delete;
+
+        ~thread_heap()
+        {
+            thread_data* p = nullptr;
+            while (items_.pop(p))
+            {
+                p->destroy();
+            }
+        }
+
+        /// Connect this heap to the overflow pool for the given stack size of
+        /// the NUMA domain the calling thread is running on. Before this
+        /// function is called the heap caches all recycled thread objects
+        /// locally. This must not be invoked more than once.
+        void connect(std::ptrdiff_t stacksize, std::int64_t capacity)
+        {
+            HPX_ASSERT(!overflow_holder_);
+
+            capacity_ = capacity;
+            overflow_holder_ = detail::get_thread_heap_overflow(
+                stacksize, detail::get_thread_heap_numa_node());
+            overflow_.store(overflow_holder_.get(), std::memory_order_release);
+        }
+
+        void push(thread_data* p)
+        {
+            detail::thread_heap_overflow* overflow =
+                overflow_.load(std::memory_order_acquire);
+            if (overflow != nullptr &&
+                count_.load(std::memory_order_relaxed) >= capacity_)
+            {
+                overflow->push(p);
+                return;
+            }
+
+            count_.fetch_add(1, std::memory_order_relaxed);
+            items_.push(p);
+        }
+
+        bool pop(thread_data*& p)
+        {
+            if (count_.load(std::memory_order_relaxed) > 0 && items_.pop(p))
+            {
+                count_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            detail::thread_heap_overflow* overflow =
+                overflow_.load(std::memory_order_acquire);
+            return overflow != nullptr && overflow->pop(p);
+        }
+
+        std::int64_t size() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::int64_t capacity_;
+        std::atomic<std::int64_t> count_;
+        detail::thread_heap_items_type items_;
+
+        std::atomic<detail::thread_heap_overflow*> overflow_;
+        std::shared_ptr<detail::thread_heap_overflow> overflow_holder_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
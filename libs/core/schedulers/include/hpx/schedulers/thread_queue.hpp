@@ -19,6 +19,7 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/thread_heap.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -33,6 +34,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -92,15 +94,15 @@ namespace hpx { namespace threads { namespace policies {
             std::hash<thread_id_type>, std::equal_to<thread_id_type>,
             util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type = std::vector<thread_id_type,
-            util::internal_allocator<thread_id_type>>;
-
         struct task_description
         {
             thread_init_data data;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             std::uint64_t waittime;
 #endif
+            // staged tasks registered as a batch are queued as a single
+            // chain of task descriptions
+            task_description* next = nullptr;
         };
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -125,39 +127,36 @@ namespace hpx { namespace threads { namespace policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_ref_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        thread_heap* get_thread_heap(std::ptrdiff_t stacksize) noexcept
         {
-            HPX_ASSERT(lk.owns_lock());
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
-            thread_heap_type* heap = nullptr;
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                return &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                return &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                return &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                return &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                return &thread_heap_nostack_;
             }
-            HPX_ASSERT(heap);
+            return nullptr;
+        }
 
+        // Take a recycled thread object from the (lock-free) thread heaps and
+        // rebind it to the given data, returns nullptr if none is available.
+        threads::thread_data* get_recycled_thread_object(
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
             if (data.initial_state ==
                     thread_schedule_state::pending_do_not_schedule ||
                 data.initial_state == thread_schedule_state::pending_boost)
@@ -167,39 +166,110 @@ namespace hpx { namespace threads { namespace policies {
 
             // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+            thread_heap* heap = get_thread_heap(stacksize);
+            HPX_ASSERT(heap);
 
-            // Check for an unused thread object.
-            if (!heap->empty())
+            threads::thread_data* p = nullptr;
+            if (heap->pop(p))
             {
+                // Thread objects refilled from the overflow pool may have been
+                // created by a different queue.
+                if (&p->get_queue<thread_queue>() != this)
+                {
+                    p->set_queue(this);
+                }
+
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
-                get_thread_id_data(thrd)->rebind(data);
+                p->rebind(data);
+                return p;
             }
-            else
 #endif
+            return nullptr;
+        }
+
+        threads::thread_data* allocate_thread_object(
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
+            if (stacksize == parameters_.nostack_stacksize_)
             {
-                hpx::util::unlock_guard<Lock> ull(lk);
+                return threads::thread_data_stackless::create(
+                    data, this, stacksize);
+            }
+            return threads::thread_data_stackful::create(data, this, stacksize);
+        }
 
-                // Allocate a new thread object.
-                threads::thread_data* p = nullptr;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_ref_type(p, thread_id_addref::no);
+        // Create a new thread object, this does not need to hold the queue
+        // mutex.
+        void create_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data)
+        {
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            threads::thread_data* p =
+                get_recycled_thread_object(data, stacksize);
+            if (p != nullptr)
+            {
+                thrd = thread_id_type(p);
+                return;
+            }
+
+            // Allocate a new thread object.
+            thrd = thread_id_ref_type(
+                allocate_thread_object(data, stacksize), thread_id_addref::no);
+        }
+
+        // Create a new thread object while holding the queue mutex, the mutex
+        // is released while allocating a new thread object.
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            HPX_ASSERT(lk.owns_lock());
+
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            threads::thread_data* p =
+                get_recycled_thread_object(data, stacksize);
+            if (p != nullptr)
+            {
+                thrd = thread_id_type(p);
+                return;
             }
+
+            hpx::util::unlock_guard<Lock> ull(lk);
+
+            // Allocate a new thread object.
+            thrd = thread_id_ref_type(
+                allocate_thread_object(data, stacksize), thread_id_addref::no);
         }
 
         static util::internal_allocator<task_description>
             task_description_alloc_;
 
+        // Cut the chain of task descriptions starting at 'task' after at most
+        // 'count' entries (no limit if count is negative), the remaining
+        // entries are queued again as a single chain. Returns the number of
+        // entries kept.
+        std::int64_t split_task_chain(
+            task_description* task, std::int64_t count)
+        {
+            std::int64_t kept = 1;
+            while (task->next != nullptr && kept != count)
+            {
+                task = task->next;
+                ++kept;
+            }
+
+            if (task->next != nullptr)
+            {
+                new_tasks_.push(task->next);
+                task->next = nullptr;
+            }
+            return kept;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // add new threads if there is some amount of work available
         std::size_t add_new(std::int64_t add_count, thread_queue* addfrom,
@@ -212,57 +282,77 @@ namespace hpx { namespace threads { namespace policies {
 
             std::size_t added = 0;
             task_description* task = nullptr;
-            while (add_count-- && addfrom->new_tasks_.pop(task, steal))
+            while (add_count != 0 && addfrom->new_tasks_.pop(task, steal))
             {
-#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
-                if (get_maintain_queue_wait_times_enabled())
+                // take as many tasks of a batch as allowed, the rest of the
+                // batch is queued again
+                if (add_count > 0)
                 {
-                    addfrom->new_tasks_wait_ +=
-                        hpx::chrono::high_resolution_clock::now() -
-                        task->waittime;
-                    ++addfrom->new_tasks_wait_count_;
+                    add_count -= addfrom->split_task_chain(task, add_count);
                 }
+
+                do
+                {
+                    task_description* next = task->next;
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                    if (get_maintain_queue_wait_times_enabled())
+                    {
+                        addfrom->new_tasks_wait_ +=
+                            hpx::chrono::high_resolution_clock::now() -
+                            task->waittime;
+                        ++addfrom->new_tasks_wait_count_;
+                    }
 #endif
-                // create the new thread
-                threads::thread_init_data& data = task->data;
+                    // create the new thread
+                    threads::thread_init_data& data = task->data;
 
-                bool schedule_now =
-                    data.initial_state == thread_schedule_state::pending;
-                (void) schedule_now;
+                    bool schedule_now =
+                        data.initial_state == thread_schedule_state::pending;
+                    (void) schedule_now;
 
-                threads::thread_id_ref_type thrd;
-                create_thread_object(thrd, data, lk);
+                    threads::thread_id_ref_type thrd;
+                    create_thread_object(thrd, data, lk);
 
-                task->~task_description();
-                task_description_alloc_.deallocate(task, 1);
+                    task->~task_description();
+                    task_description_alloc_.deallocate(task, 1);
 
-                // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd.noref());
+                    // add the new entry to the map of all threads
+                    std::pair<thread_map_type::iterator, bool> p =
+                        thread_map_.insert(thrd.noref());
 
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    --addfrom->new_tasks_count_.data_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::out_of_memory,
-                        "thread_queue::add_new",
-                        "Couldn't add new thread to the thread map");
-                    return 0;
-                }
+                    if (HPX_UNLIKELY(!p.second))
+                    {
+                        --addfrom->new_tasks_count_.data_;
+                        if (next != nullptr)
+                        {
+                            addfrom->new_tasks_.push(next);
+                        }
+                        lk.unlock();
+                        HPX_THROW_EXCEPTION(hpx::out_of_memory,
+                            "thread_queue::add_new",
+                            "Couldn't add new thread to the thread map");
+                        return 0;
+                    }
+
+                    ++thread_map_count_;
 
-                ++thread_map_count_;
+                    // Decrement only after thread_map_count_ has been
+                    // incremented
+                    --addfrom->new_tasks_count_.data_;
 
-                // Decrement only after thread_map_count_ has been incremented
-                --addfrom->new_tasks_count_.data_;
+                    // insert the thread into the work-items queue assuming it
+                    // is in pending state, thread would go out of scope
+                    // otherwise
+                    HPX_ASSERT(schedule_now);
 
-                // insert the thread into the work-items queue assuming it is
-                // in pending state, thread would go out of scope otherwise
-                HPX_ASSERT(schedule_now);
+                    // pushing the new thread into the pending queue of the
+                    // specified thread_queue
+                    ++added;
+                    schedule_thread(HPX_MOVE(thrd));
 
-                // pushing the new thread into the pending queue of the
-                // specified thread_queue
-                ++added;
-                schedule_thread(HPX_MOVE(thrd));
+                    task = next;
+                } while (task != nullptr);
             }
 
             if (added)
@@ -328,25 +418,10 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                thread_heap_small_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                thread_heap_medium_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.large_stacksize_)
+            thread_heap* heap = get_thread_heap(stacksize);
+            if (heap != nullptr)
             {
-                thread_heap_large_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                thread_heap_huge_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.nostack_stacksize_)
-            {
-                thread_heap_nostack_.push_back(thrd);
+                heap->push(get_thread_id_data(thrd));
             }
             else
             {
@@ -463,11 +538,6 @@ namespace hpx { namespace threads { namespace policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
-          , thread_heap_small_()
-          , thread_heap_medium_()
-          , thread_heap_large_()
-          , thread_heap_huge_()
-          , thread_heap_nostack_()
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -490,23 +560,7 @@ namespace hpx { namespace threads { namespace policies {
             p->destroy();
         }
 
-        ~thread_queue()
-        {
-            for (auto t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
-        }
+        ~thread_queue() = default;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t get_creation_time(bool reset)
@@ -543,6 +597,14 @@ namespace hpx { namespace threads { namespace policies {
             return new_tasks_count_.data_.load(order);
         }
 
+        // This returns the deadline of the pending thread which will be
+        // handed out next (deadline ordered pending queues only)
+        std::chrono::steady_clock::time_point get_pending_queue_front_deadline()
+            const noexcept
+        {
+            return work_items_.front_deadline();
+        }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::uint64_t get_average_task_wait_time() const
         {
@@ -666,16 +728,16 @@ namespace hpx { namespace threads { namespace policies {
             {
                 threads::thread_id_ref_type thrd;
 
-                // The mutex can not be locked while a new thread is getting
-                // created, as it might have that the current HPX thread gets
-                // suspended.
-                {
-                    std::unique_lock<mutex_type> lk(mtx_);
+                bool schedule_now =
+                    data.initial_state == thread_schedule_state::pending;
 
-                    bool schedule_now =
-                        data.initial_state == thread_schedule_state::pending;
+                // The thread object is taken from the lock-free thread heaps
+                // (or newly allocated) without holding the mutex, which is
+                // needed only to register the new thread in the thread map.
+                create_thread_object(thrd, data);
 
-                    create_thread_object(thrd, data, lk);
+                {
+                    std::unique_lock<mutex_type> lk(mtx_);
 
                     // add a new entry in the map for this thread
                     std::pair<thread_map_type::iterator, bool> p =
@@ -694,33 +756,34 @@ namespace hpx { namespace threads { namespace policies {
                     // this thread has to be in the map now
                     HPX_ASSERT(
                         thread_map_.find(thrd.noref()) != thread_map_.end());
-                    HPX_ASSERT(
-                        &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
-                        this);
+                }
 
-                    // push the new thread in the pending thread queue
-                    if (schedule_now)
-                    {
-                        // return the thread_id_ref of the newly created thread
-                        if (id)
-                        {
-                            *id = thrd;
-                        }
-                        schedule_thread(HPX_MOVE(thrd));
-                    }
-                    else
+                HPX_ASSERT(
+                    &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
+                    this);
+
+                // push the new thread in the pending thread queue
+                if (schedule_now)
+                {
+                    // return the thread_id_ref of the newly created thread
+                    if (id)
                     {
-                        // if the thread should not be scheduled the id must be
-                        // returned to the caller as otherwise the thread would
-                        // go out of scope right away.
-                        HPX_ASSERT(id != nullptr);
-                        *id = HPX_MOVE(thrd);
+                        *id = thrd;
                     }
-
-                    if (&ec != &throws)
-                        ec = make_success_code();
-                    return;
+                    schedule_thread(HPX_MOVE(thrd));
+                }
+                else
+                {
+                    // if the thread should not be scheduled the id must be
+                    // returned to the caller as otherwise the thread would
+                    // go out of scope right away.
+                    HPX_ASSERT(id != nullptr);
+                    *id = HPX_MOVE(thrd);
                 }
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
             }
 
             // if the initial state is not pending, delayed creation will
@@ -749,10 +812,71 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
-        void move_work_items_from(thread_queue* src, std::int64_t count)
+        // register a batch of staged tasks for later thread creation, the
+        // batch is linked into a single chain of task descriptions which is
+        // pushed onto the staged queue at once, the count of new tasks is
+        // updated only once for the whole batch
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
         {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                HPX_ASSERT(!data[i].run_now);
+                if (data[i].initial_state != thread_schedule_state::pending)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "thread_queue::create_thread_bulk",
+                        "staged tasks must have 'pending' as their initial "
+                        "state");
+                }
+            }
+
+            if (count == 0)
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+#endif
+            task_description* first = nullptr;
+            task_description** last = &first;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                HPX_ASSERT(d.stacksize != threads::thread_stacksize::current);
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{HPX_MOVE(d), now};
+#else
+                new (td) task_description{HPX_MOVE(d)};    //-V106
+#endif
+                *last = td;
+                last = &td->next;
+            }
+
+            new_tasks_count_.data_ += static_cast<std::int64_t>(count);
+            new_tasks_.push(first);
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        // move at most 'count' pending threads from the given queue to this
+        // one, returns the number of threads actually moved
+        std::int64_t move_work_items_from(thread_queue* src, std::int64_t count)
+        {
+            std::int64_t moved = 0;
             thread_description_ptr trd;
-            while (src->work_items_.pop(trd))
+            while (moved != count && src->work_items_.pop(trd))
             {
                 --src->work_items_count_.data_;
 
@@ -767,45 +891,56 @@ namespace hpx { namespace threads { namespace policies {
                 }
 #endif
 
-                bool finished = count == ++work_items_count_.data_;
+                ++work_items_count_.data_;
                 work_items_.push(trd);
-                if (finished)
-                    break;
+                ++moved;
             }
+            return moved;
         }
 
-        void move_task_items_from(thread_queue* src, std::int64_t count)
+        // move at most 'count' staged tasks from the given queue to this one,
+        // returns the number of tasks actually moved
+        std::int64_t move_task_items_from(thread_queue* src, std::int64_t count)
         {
+            std::int64_t moved = 0;
             task_description* task = nullptr;
-            while (src->new_tasks_.pop(task))
+            while (moved != count && src->new_tasks_.pop(task))
             {
+                // move as many tasks of a batch as requested, the rest of the
+                // batch stays with the source queue
+                std::int64_t const n = src->split_task_chain(
+                    task, count < 0 ? count : count - moved);
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
                 if (get_maintain_queue_wait_times_enabled())
                 {
                     std::int64_t now =
                         hpx::chrono::high_resolution_clock::now();
-                    src->new_tasks_wait_ += now - task->waittime;
-                    ++src->new_tasks_wait_count_;
-                    task->waittime = now;
+                    for (task_description* t = task; t != nullptr; t = t->next)
+                    {
+                        src->new_tasks_wait_ += now - t->waittime;
+                        ++src->new_tasks_wait_count_;
+                        t->waittime = now;
+                    }
                 }
 #endif
 
-                bool finish = count == ++new_tasks_count_.data_;
+                new_tasks_count_.data_ += n;
 
                 // Decrement only after the local new_tasks_count_ has
                 // been incremented
-                --src->new_tasks_count_.data_;
+                src->new_tasks_count_.data_ -= n;
 
                 if (new_tasks_.push(task))
                 {
-                    if (finish)
-                        break;
+                    moved += n;
                 }
                 else
                 {
-                    --new_tasks_count_.data_;
+                    new_tasks_count_.data_ -= n;
                 }
             }
+            return moved;
         }
 
         /// Return the next thread to be executed, return false if none is
@@ -1115,12 +1250,34 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t /* num_thread */)
+        void on_start_thread(std::size_t num_thread)
         {
-            thread_heap_small_.reserve(parameters_.init_threads_count_);
-            thread_heap_medium_.reserve(parameters_.init_threads_count_);
-            thread_heap_large_.reserve(parameters_.init_threads_count_);
-            thread_heap_huge_.reserve(parameters_.init_threads_count_);
+            // queues with an owning worker thread are bound to it now
+            detail::bind_queue_owner(work_items_, num_thread, 0);
+
+            // Connect the thread heaps to the overflow pools of the NUMA
+            // domain the worker thread running this queue is bound to. Each
+            // heap caches locally as many thread objects as may be cleaned up
+            // at once.
+            if (!thread_heaps_connected_)
+            {
+                std::int64_t const capacity =
+                    (std::max)(parameters_.init_threads_count_,
+                        parameters_.max_terminated_threads_);
+
+                thread_heap_small_.connect(
+                    parameters_.small_stacksize_, capacity);
+                thread_heap_medium_.connect(
+                    parameters_.medium_stacksize_, capacity);
+                thread_heap_large_.connect(
+                    parameters_.large_stacksize_, capacity);
+                thread_heap_huge_.connect(
+                    parameters_.huge_stacksize_, capacity);
+                thread_heap_nostack_.connect(
+                    parameters_.nostack_stacksize_, capacity);
+
+                thread_heaps_connected_ = true;
+            }
 
             // Pre-allocate init_threads_count threads, with accompanying stack,
             // with the default stack size
@@ -1131,7 +1288,6 @@ namespace hpx { namespace threads { namespace policies {
                 "fails you've most likely changed the default without changing "
                 "the code here.");
 
-            std::lock_guard<mutex_type> lk(mtx_);
             for (std::int64_t i = 0; i < parameters_.init_threads_count_; ++i)
             {
                 // We don't care about the init parameters since this thread
@@ -1149,10 +1305,13 @@ namespace hpx { namespace threads { namespace policies {
                 p->init();
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                thread_heap_small_.push(p);
             }
         }
-        void on_stop_thread(std::size_t /* num_thread */) {}
+        void on_stop_thread(std::size_t num_thread)
+        {
+            detail::release_queue_owner(work_items_, num_thread, 0);
+        }
         void on_error(
             std::size_t /* num_thread */, std::exception_ptr const& /* e */)
         {
@@ -1190,11 +1349,13 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> new_tasks_wait_count_;
 #endif
 
-        thread_heap_type thread_heap_small_;
-        thread_heap_type thread_heap_medium_;
-        thread_heap_type thread_heap_large_;
-        thread_heap_type thread_heap_huge_;
-        thread_heap_type thread_heap_nostack_;
+        // lock-free caches of recycled thread objects
+        thread_heap thread_heap_small_;
+        thread_heap thread_heap_medium_;
+        thread_heap thread_heap_large_;
+        thread_heap thread_heap_huge_;
+        thread_heap thread_heap_nostack_;
+        bool thread_heaps_connected_ = false;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
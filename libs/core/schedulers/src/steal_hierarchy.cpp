@@ -0,0 +1,96 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/schedulers/steal_hierarchy.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace hpx { namespace threads { namespace policies {
+
+    char const* get_steal_level_name(steal_level level)
+    {
+        static char const* const names[] = {
+            "core", "l2_cache", "l3_cache", "numa_domain", "socket", "machine"};
+
+        std::size_t const l = static_cast<std::size_t>(level);
+        return l < steal_level_count ? names[l] : "unknown";
+    }
+
+    namespace {
+
+        steal_level get_steal_level(topology const& topo, std::size_t thief_pu,
+            std::size_t thief_domain, std::size_t victim_pu,
+            std::size_t victim_domain)
+        {
+            if (thief_domain != victim_domain)
+            {
+                return topo.get_socket_number(thief_pu) ==
+                        topo.get_socket_number(victim_pu) ?
+                    steal_level::socket :
+                    steal_level::machine;
+            }
+
+            if (test(topo.get_core_affinity_mask(thief_pu), victim_pu))
+                return steal_level::core;
+            if (test(topo.get_cache_affinity_mask(thief_pu, 2), victim_pu))
+                return steal_level::l2_cache;
+            if (test(topo.get_cache_affinity_mask(thief_pu, 3), victim_pu))
+                return steal_level::l3_cache;
+
+            return steal_level::numa_domain;
+        }
+    }    // namespace
+
+    void steal_hierarchy::init(topology const& topo,
+        std::vector<std::size_t> const& pus,
+        std::vector<std::size_t> const& domains)
+    {
+        HPX_ASSERT(pus.size() == domains.size());
+
+        std::size_t const num_workers = pus.size();
+
+        orders_.clear();
+        orders_.resize(num_workers);
+
+        std::vector<steal_level> levels(num_workers);
+        for (std::size_t thief = 0; thief != num_workers; ++thief)
+        {
+            for (std::size_t victim = 0; victim != num_workers; ++victim)
+            {
+                if (victim != thief)
+                {
+                    levels[victim] = get_steal_level(topo, pus[thief],
+                        domains[thief], pus[victim], domains[victim]);
+                }
+            }
+
+            // group the victims by level, inside each level start with the
+            // worker following the thief to spread concurrent steals
+            order& o = orders_[thief];
+            o.victims_.reserve(num_workers - 1);
+            for (std::size_t l = 0; l != steal_level_count; ++l)
+            {
+                o.offsets_[l] = o.victims_.size();
+                for (std::size_t i = 1; i != num_workers; ++i)
+                {
+                    std::size_t const victim = (thief + i) % num_workers;
+                    if (levels[victim] == static_cast<steal_level>(l))
+                    {
+                        o.victims_.push_back(victim);
+                    }
+                }
+            }
+            o.offsets_[steal_level_count] = o.victims_.size();
+
+            HPX_ASSERT(o.victims_.size() == num_workers - 1);
+        }
+    }
+}}}    // namespace hpx::threads::policies
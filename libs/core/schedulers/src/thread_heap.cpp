@@ -0,0 +1,91 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/thread_heap.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace threads { namespace policies { namespace detail {
+
+    thread_heap_overflow::thread_heap_overflow()
+      : count_(0)
+    {
+    }
+
+    thread_heap_overflow::~thread_heap_overflow()
+    {
+        thread_data* p = nullptr;
+        while (items_.pop(p))
+        {
+            p->destroy();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        struct thread_heap_overflow_registry
+        {
+            using key_type = std::pair<std::ptrdiff_t, std::size_t>;
+
+            std::mutex mtx_;
+            std::map<key_type, std::weak_ptr<thread_heap_overflow>> pools_;
+        };
+
+        thread_heap_overflow_registry& get_registry()
+        {
+            static thread_heap_overflow_registry registry;
+            return registry;
+        }
+    }    // namespace
+
+    std::shared_ptr<thread_heap_overflow> get_thread_heap_overflow(
+        std::ptrdiff_t stacksize, std::size_t numa_node)
+    {
+        thread_heap_overflow_registry& registry = get_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+
+        std::weak_ptr<thread_heap_overflow>& entry =
+            registry.pools_[std::make_pair(stacksize, numa_node)];
+
+        std::shared_ptr<thread_heap_overflow> pool = entry.lock();
+        if (!pool)
+        {
+            pool = std::make_shared<thread_heap_overflow>();
+            entry = pool;
+        }
+        return pool;
+    }
+
+    std::size_t get_thread_heap_numa_node()
+    {
+        topology const& topo = create_topology();
+
+        error_code ec(throwmode::lightweight);
+        mask_type mask = topo.get_cpubind_mask(ec);
+        if (ec)
+        {
+            return 0;
+        }
+
+        std::size_t const num_pu = find_first(mask);
+        if (num_pu == std::size_t(-1))
+        {
+            return 0;
+        }
+        return topo.get_numa_node_number(num_pu);
+    }
+}}}}    // namespace hpx::threads::policies::detail
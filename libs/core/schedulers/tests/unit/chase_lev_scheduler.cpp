@@ -0,0 +1,91 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the priority local scheduler using Chase-Lev deques can be
+// selected through the runtime configuration (--hpx:queuing) and that it runs
+// work pushed by the owning worker threads as well as by other threads.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> num_calls(0);
+
+std::uint64_t fib(std::uint64_t n)
+{
+    ++num_calls;
+    if (n < 2)
+        return n;
+
+    // the new thread is pushed to the deque of the current worker thread
+    hpx::future<std::uint64_t> f = hpx::async(&fib, n - 1);
+    std::uint64_t const r = fib(n - 2);
+    return f.get() + r;
+}
+
+void test_scheduler_selected()
+{
+    hpx::threads::thread_pool_base& pool = hpx::resource::get_thread_pool(0);
+    HPX_TEST_EQ(std::string(pool.get_scheduler()->get_description()),
+        std::string("core-local_priority_queue_scheduler_chase_lev"));
+}
+
+void test_owner_push()
+{
+    num_calls = 0;
+    HPX_TEST_EQ(hpx::async(&fib, 20).get(), std::uint64_t(6765));
+    HPX_TEST_EQ(num_calls.load(), std::size_t(21891));
+}
+
+void test_remote_push()
+{
+    // threads scheduled on a given worker thread by a different thread end
+    // up in the inbox of the target queue
+    hpx::threads::thread_pool_base& pool = hpx::resource::get_thread_pool(0);
+    std::size_t const num_threads = pool.get_os_thread_count();
+
+    std::vector<hpx::future<std::size_t>> futures;
+    for (std::size_t i = 0; i != 10 * num_threads; ++i)
+    {
+        hpx::execution::parallel_executor exec{
+            hpx::threads::thread_schedule_hint(
+                std::int16_t(i % num_threads))};
+        futures.push_back(hpx::async(exec, [i]() { return i; }));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), i);
+    }
+}
+
+int hpx_main()
+{
+    test_scheduler_selected();
+    test_owner_push();
+    test_remote_push();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=local-priority-chase-lev"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
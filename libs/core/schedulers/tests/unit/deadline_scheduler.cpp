@@ -0,0 +1,156 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the deadline scheduler runs threads in the order of their
+// deadlines and that it counts the threads which were started too late.
+// Verify that the deadline heap hands out its entries in deadline order while
+// growing its storage.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_deadline_order()
+{
+    constexpr std::size_t num_tasks = 100;
+
+    // all tasks are queued before the (only) worker thread gets to run any
+    // of them
+    std::vector<std::size_t> order;
+    order.reserve(num_tasks + 1);
+    hpx::latch l(num_tasks + 2);
+
+    auto const now = std::chrono::steady_clock::now();
+
+    // a task without any deadline is run last
+    ex::execute(ex::thread_pool_scheduler{}, [&]() {
+        order.push_back(num_tasks);
+        l.count_down(1);
+    });
+
+    // queue the tasks in reverse order of their deadlines
+    for (std::size_t i = num_tasks; i != 0; --i)
+    {
+        auto sched = ex::with_deadline(ex::thread_pool_scheduler{},
+            now + std::chrono::hours(1) + std::chrono::milliseconds(i - 1));
+        HPX_TEST(ex::get_deadline(sched) != hpx::threads::no_deadline());
+
+        ex::execute(sched, [&, i]() {
+            order.push_back(i - 1);
+            l.count_down(1);
+        });
+    }
+
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), num_tasks + 1);
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+}
+
+// mimics the staged queue entries of a thread_queue
+struct staged_entry
+{
+    struct
+    {
+        std::chrono::steady_clock::time_point deadline;
+    } data;
+};
+
+void test_deadline_heap()
+{
+    // more entries than the initially reserved storage can hold
+    constexpr std::size_t num_entries = 1000;
+
+    hpx::threads::policies::deadline_heap_backend<staged_entry*> heap;
+    HPX_TEST(heap.empty());
+    HPX_TEST(heap.front_deadline() == hpx::threads::no_deadline());
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 100);
+
+    auto const now = std::chrono::steady_clock::now();
+    std::vector<staged_entry> entries(num_entries);
+    for (auto& e : entries)
+    {
+        e.data.deadline = now + std::chrono::milliseconds(dist(gen));
+        HPX_TEST(heap.push(&e));
+    }
+
+    staged_entry* prev = nullptr;
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        auto const front = heap.front_deadline();
+
+        staged_entry* e = nullptr;
+        HPX_TEST(heap.pop(e));
+        HPX_TEST(e != nullptr);
+        HPX_TEST(e->data.deadline == front);
+
+        // equal deadlines are handed out in FIFO order
+        if (prev != nullptr)
+        {
+            HPX_TEST(prev->data.deadline < e->data.deadline ||
+                (prev->data.deadline == e->data.deadline && prev < e));
+        }
+        prev = e;
+    }
+
+    staged_entry* e = nullptr;
+    HPX_TEST(!heap.pop(e));
+    HPX_TEST(heap.empty());
+    HPX_TEST(heap.front_deadline() == hpx::threads::no_deadline());
+}
+
+void test_deadline_misses()
+{
+    hpx::threads::thread_pool_base& pool = hpx::resource::get_thread_pool(0);
+    std::int64_t const misses = pool.get_deadline_miss_count(0, false);
+
+    // a deadline in the past can't be met
+    hpx::latch l(2);
+    ex::execute(ex::with_deadline(ex::thread_pool_scheduler{},
+                    std::chrono::steady_clock::now() - std::chrono::seconds(1)),
+        [&]() { l.count_down(1); });
+    l.arrive_and_wait();
+
+    HPX_TEST_LT(misses, pool.get_deadline_miss_count(0, false));
+    HPX_TEST_LT(std::int64_t(0), pool.get_deadline_miss_count(std::size_t(-1), true));
+    HPX_TEST_EQ(std::int64_t(0), pool.get_deadline_miss_count(std::size_t(-1), false));
+}
+
+int hpx_main()
+{
+    test_deadline_order();
+    test_deadline_heap();
+    test_deadline_misses();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=deadline", "hpx.os_threads=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,60 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that idle worker threads get parked and are woken up as soon as new
+// work is scheduled for them.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    hpx::threads::thread_pool_base& pool = hpx::resource::get_thread_pool(0);
+
+    std::size_t const num_thread = pool.get_os_thread_count() - 1;
+    hpx::execution::parallel_executor exec{
+        hpx::threads::thread_schedule_hint(std::int16_t(num_thread))};
+
+    // give the worker thread some time to become idle and to be parked, then
+    // send some work its way
+    for (int i = 0; i != 10 && pool.get_idle_wake_count(num_thread, false) == 0;
+         ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        bool executed = false;
+        hpx::async(exec, [&executed]() { executed = true; }).get();
+        HPX_TEST(executed);
+    }
+
+    HPX_TEST_LT(std::int64_t(0), pool.get_idle_park_count(num_thread, false));
+    HPX_TEST_LT(std::int64_t(0), pool.get_idle_wake_count(num_thread, false));
+    HPX_TEST_LT(std::int64_t(0), pool.get_idle_park_time(num_thread, false));
+    HPX_TEST_LTE(std::int64_t(0), pool.get_idle_wake_latency(num_thread, false));
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=2", "hpx.max_idle_loop_count=1000",
+        "hpx.idle_backoff_spin_count=10", "hpx.idle_backoff_pause_count=100"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -90,6 +90,13 @@ int main(int argc, char* argv[])
         test_scheduler<scheduler_type>(argc, argv);
     }
 
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_chase_lev>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     {
         using scheduler_type =
@@ -106,5 +113,21 @@ int main(int argc, char* argv[])
     }
 #endif
 
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_lifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+#endif
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the topology-aware stealing order used by the shared priority queue
+// scheduler and run some work using limited steal budgets.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using hpx::threads::policies::steal_hierarchy;
+using hpx::threads::policies::steal_level;
+using hpx::threads::policies::steal_level_count;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_steal_hierarchy()
+{
+    auto const& topo = hpx::threads::create_topology();
+
+    std::size_t const num_workers = topo.get_number_of_pus();
+    std::vector<std::size_t> pus(num_workers);
+    std::vector<std::size_t> domains(num_workers);
+    for (std::size_t i = 0; i != num_workers; ++i)
+    {
+        pus[i] = i;
+        domains[i] = topo.get_numa_node_number(i);
+    }
+
+    steal_hierarchy hierarchy;
+    hierarchy.init(topo, pus, domains);
+    HPX_TEST_EQ(hierarchy.size(), num_workers);
+
+    for (std::size_t thief = 0; thief != num_workers; ++thief)
+    {
+        // every other worker shows up exactly once
+        std::vector<std::size_t> seen(num_workers, 0);
+        for (std::size_t l = 0; l != steal_level_count; ++l)
+        {
+            steal_level const level = static_cast<steal_level>(l);
+            for (std::size_t n = 0; n != hierarchy.victim_count(thief, level);
+                 ++n)
+            {
+                std::size_t const victim = hierarchy.victim(thief, level, n);
+                HPX_TEST_NEQ(victim, thief);
+                ++seen[victim];
+
+                // victims on the same NUMA domain are visited first
+                HPX_TEST_EQ(domains[thief] == domains[victim],
+                    level < steal_level::socket);
+
+                if (level == steal_level::core)
+                {
+                    HPX_TEST(hpx::threads::test(
+                        topo.get_core_affinity_mask(thief), victim));
+                }
+                else if (level == steal_level::l2_cache)
+                {
+                    HPX_TEST(hpx::threads::test(
+                        topo.get_cache_affinity_mask(thief, 2), victim));
+                }
+                else if (level == steal_level::l3_cache)
+                {
+                    HPX_TEST(hpx::threads::test(
+                        topo.get_cache_affinity_mask(thief, 3), victim));
+                }
+            }
+        }
+
+        for (std::size_t victim = 0; victim != num_workers; ++victim)
+        {
+            HPX_TEST_EQ(seen[victim], std::size_t(victim == thief ? 0 : 1));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_steal_hierarchy();
+
+    // spawn work from a single thread to force the other workers to steal
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(1000);
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async([&count]() { ++count; }));
+    }
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(count.load(), std::size_t(1000));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=shared-priority",
+        "hpx.thread_queue.steal_budget_core=1",
+        "hpx.thread_queue.steal_budget_l2_cache=1",
+        "hpx.thread_queue.steal_budget_l3_cache=2",
+        "hpx.thread_queue.steal_budget_numa_domain=2"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
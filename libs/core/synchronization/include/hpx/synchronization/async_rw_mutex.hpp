@@ -9,18 +9,18 @@
 
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/optional.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/operation_state.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
-#include <hpx/functional/move_only_function.hpp>
-#include <hpx/synchronization/mutex.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <exception>
+#include <iterator>
 #include <memory>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -32,16 +32,91 @@ namespace hpx { namespace experimental {
             readwrite
         };
 
+        // Operation states waiting for access are linked into an intrusive
+        // list held by the shared state of the preceding access. Registering
+        // and triggering a waiting operation state does not allocate.
+        template <typename SharedState>
+        struct async_rw_mutex_operation_state_base
+        {
+            using shared_state_ptr_type = std::shared_ptr<SharedState>;
+            using continuation_type = void (*)(
+                async_rw_mutex_operation_state_base*, shared_state_ptr_type);
+
+            explicit async_rw_mutex_operation_state_base(
+                continuation_type continuation) noexcept
+              : continuation_(continuation)
+            {
+            }
+
+            async_rw_mutex_operation_state_base* next_ = nullptr;
+            continuation_type continuation_;
+        };
+
+        template <typename SharedState>
+        struct async_rw_mutex_continuations
+        {
+            using operation_state_base_type =
+                async_rw_mutex_operation_state_base<SharedState>;
+
+            bool empty() const noexcept
+            {
+                return head_.load(std::memory_order_relaxed) == nullptr;
+            }
+
+            // Operation states may be started concurrently.
+            void push(operation_state_base_type* op) noexcept
+            {
+                operation_state_base_type* head =
+                    head_.load(std::memory_order_relaxed);
+                do
+                {
+                    op->next_ = head;
+                } while (!head_.compare_exchange_weak(
+                    head, op, std::memory_order_release));
+            }
+
+            // Grant access to all waiting operation states (all readers of a
+            // batch or a single writer) in the order they were started.
+            void trigger(
+                std::shared_ptr<SharedState> const& next_state) noexcept
+            {
+                operation_state_base_type* op =
+                    head_.exchange(nullptr, std::memory_order_acquire);
+
+                operation_state_base_type* fifo = nullptr;
+                while (op != nullptr)
+                {
+                    operation_state_base_type* next = op->next_;
+                    op->next_ = fifo;
+                    fifo = op;
+                    op = next;
+                }
+
+                while (fifo != nullptr)
+                {
+                    // the operation state may be destroyed by its
+                    // continuation
+                    operation_state_base_type* next = fifo->next_;
+                    fifo->continuation_(fifo, next_state);
+                    fifo = next;
+                }
+            }
+
+            std::atomic<operation_state_base_type*> head_{nullptr};
+        };
+
         template <typename T>
         struct async_rw_mutex_shared_state
         {
             using shared_state_ptr_type =
                 std::shared_ptr<async_rw_mutex_shared_state>;
+            using operation_state_base_type =
+                async_rw_mutex_operation_state_base<
+                    async_rw_mutex_shared_state>;
+
             hpx::optional<T> value;
             shared_state_ptr_type next_state;
-            hpx::mutex mtx;
-            hpx::detail::small_vector<
-                hpx::move_only_function<void(shared_state_ptr_type)>, 1>
+            async_rw_mutex_continuations<async_rw_mutex_shared_state>
                 continuations;
 
             async_rw_mutex_shared_state() = default;
@@ -71,10 +146,7 @@ namespace hpx { namespace experimental {
                     // wrapped value, so we move the value to the next state.
                     next_state->set_value(HPX_MOVE(value.value()));
 
-                    for (auto& continuation : continuations)
-                    {
-                        continuation(next_state);
-                    }
+                    continuations.trigger(next_state);
                 }
             }
 
@@ -93,11 +165,9 @@ namespace hpx { namespace experimental {
                 next_state = HPX_MOVE(state);
             }
 
-            template <typename F>
-            void add_continuation(F&& continuation)
+            void add_continuation(operation_state_base_type* op) noexcept
             {
-                std::lock_guard<hpx::mutex> l(mtx);
-                continuations.emplace_back(HPX_FORWARD(F, continuation));
+                continuations.push(op);
             }
         };
 
@@ -106,10 +176,12 @@ namespace hpx { namespace experimental {
         {
             using shared_state_ptr_type =
                 std::shared_ptr<async_rw_mutex_shared_state>;
+            using operation_state_base_type =
+                async_rw_mutex_operation_state_base<
+                    async_rw_mutex_shared_state>;
+
             shared_state_ptr_type next_state;
-            hpx::mutex mtx;
-            hpx::detail::small_vector<
-                hpx::move_only_function<void(shared_state_ptr_type)>, 1>
+            async_rw_mutex_continuations<async_rw_mutex_shared_state>
                 continuations;
 
             async_rw_mutex_shared_state() = default;
@@ -128,10 +200,7 @@ namespace hpx { namespace experimental {
                 HPX_ASSERT((continuations.empty() && !next_state) ||
                     (!continuations.empty() && next_state));
 
-                for (auto& continuation : continuations)
-                {
-                    continuation(next_state);
-                }
+                continuations.trigger(next_state);
             }
 
             void set_next_state(
@@ -142,11 +211,9 @@ namespace hpx { namespace experimental {
                 next_state = HPX_MOVE(state);
             }
 
-            template <typename F>
-            void add_continuation(F&& continuation)
+            void add_continuation(operation_state_base_type* op) noexcept
             {
-                std::lock_guard<hpx::mutex> l(mtx);
-                continuations.emplace_back(HPX_FORWARD(F, continuation));
+                continuations.push(op);
             }
         };
 
@@ -289,6 +356,103 @@ namespace hpx { namespace experimental {
             async_rw_mutex_access_wrapper& operator=(
                 async_rw_mutex_access_wrapper const&) = delete;
         };
+
+        // A range of read-only senders which belong to the same batch. All
+        // senders of a batch refer to the same pair of shared states, they are
+        // created on the fly while iterating, the range does not allocate.
+        template <typename Sender, typename SharedStatePtr>
+        class async_rw_mutex_read_range
+        {
+        public:
+            class iterator
+            {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = Sender;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = Sender;
+
+                iterator() = default;
+
+                Sender operator*() const
+                {
+                    return Sender{range->prev_state, range->state};
+                }
+
+                iterator& operator++() noexcept
+                {
+                    ++index;
+                    return *this;
+                }
+
+                iterator operator++(int) noexcept
+                {
+                    iterator tmp = *this;
+                    ++index;
+                    return tmp;
+                }
+
+                friend bool operator==(
+                    iterator const& lhs, iterator const& rhs) noexcept
+                {
+                    return lhs.index == rhs.index;
+                }
+
+                friend bool operator!=(
+                    iterator const& lhs, iterator const& rhs) noexcept
+                {
+                    return lhs.index != rhs.index;
+                }
+
+            private:
+                friend class async_rw_mutex_read_range;
+
+                iterator(async_rw_mutex_read_range const* range,
+                    std::size_t index) noexcept
+                  : range(range)
+                  , index(index)
+                {
+                }
+
+                async_rw_mutex_read_range const* range = nullptr;
+                std::size_t index = 0;
+            };
+
+            async_rw_mutex_read_range() = default;
+            async_rw_mutex_read_range(SharedStatePtr prev_state,
+                SharedStatePtr state, std::size_t count) noexcept
+              : prev_state(HPX_MOVE(prev_state))
+              , state(HPX_MOVE(state))
+              , count(count)
+            {
+            }
+
+            iterator begin() const noexcept
+            {
+                return iterator(this, 0);
+            }
+
+            iterator end() const noexcept
+            {
+                return iterator(this, count);
+            }
+
+            std::size_t size() const noexcept
+            {
+                return count;
+            }
+
+            bool empty() const noexcept
+            {
+                return count == 0;
+            }
+
+        private:
+            SharedStatePtr prev_state;
+            SharedStatePtr state;
+            std::size_t count = 0;
+        };
     }    // namespace detail
 
     /// Read-write mutex where access is granted to a value through senders.
@@ -315,6 +479,11 @@ namespace hpx { namespace experimental {
     ///
     /// Retrieving senders from the mutex is not thread-safe.
     ///
+    /// All read-only senders retrieved between two read-write senders form a
+    /// batch which is granted access at once when the preceding read-write
+    /// access is released. read_many(n) retrieves n read-only senders of the
+    /// same batch.
+    ///
     /// The mutex is movable and non-copyable.
     template <typename ReadWriteT = void, typename ReadT = ReadWriteT,
         typename Allocator = hpx::util::internal_allocator<>>
@@ -345,6 +514,11 @@ namespace hpx { namespace experimental {
     //
     // The protected value is moved from state to state and is released when the
     // last shared state is destroyed.
+    //
+    // Started operation states link themselves into an intrusive list held by
+    // the previous shared state. Waiting for access and releasing it therefore
+    // do not allocate; only the creation of a new shared state (once per
+    // read-write access and once per batch of read-only accesses) does.
 
     template <typename Allocator>
     class async_rw_mutex<void, void, Allocator>
@@ -399,6 +573,22 @@ namespace hpx { namespace experimental {
             return {prev_state, state};
         }
 
+        // Returns a range of n read-only senders which are granted access
+        // together. The senders are created while iterating over the range.
+        detail::async_rw_mutex_read_range<
+            sender<detail::async_rw_mutex_access_type::read>,
+            shared_state_ptr_type>
+        read_many(std::size_t n)
+        {
+            if (n == 0)
+            {
+                return {};
+            }
+
+            auto s = read();
+            return {HPX_MOVE(s.prev_state), HPX_MOVE(s.state), n};
+        }
+
         sender<detail::async_rw_mutex_access_type::readwrite> readwrite()
         {
             prev_state = HPX_MOVE(state);
@@ -447,7 +637,11 @@ namespace hpx { namespace experimental {
 
             template <typename R>
             struct operation_state
+              : detail::async_rw_mutex_operation_state_base<shared_state_type>
             {
+                using base_type = detail::async_rw_mutex_operation_state_base<
+                    shared_state_type>;
+
                 std::decay_t<R> r;
                 shared_state_ptr_type prev_state;
                 shared_state_ptr_type state;
@@ -455,7 +649,8 @@ namespace hpx { namespace experimental {
                 template <typename R_>
                 operation_state(R_&& r, shared_state_ptr_type prev_state,
                     shared_state_ptr_type state)
-                  : r(HPX_FORWARD(R_, r))
+                  : base_type(&operation_state::continuation)
+                  , r(HPX_FORWARD(R_, r))
                   , prev_state(HPX_MOVE(prev_state))
                   , state(HPX_MOVE(state))
                 {
@@ -466,6 +661,26 @@ namespace hpx { namespace experimental {
                 operation_state(operation_state const&) = delete;
                 operation_state& operator=(operation_state const&) = delete;
 
+                static void continuation(
+                    base_type* base, shared_state_ptr_type state)
+                {
+                    auto& os = static_cast<operation_state&>(*base);
+
+                    // The access wrapper keeps the state alive, the operation
+                    // state itself must not delay the next access.
+                    os.state.reset();
+
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(os.r), access_type{HPX_MOVE(state)});
+                        },
+                        [&](std::exception_ptr ep) {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(os.r), HPX_MOVE(ep));
+                        });
+                }
+
                 friend void tag_invoke(hpx::execution::experimental::start_t,
                     operation_state& os) noexcept
                 {
@@ -473,24 +688,9 @@ namespace hpx { namespace experimental {
                         "async_rw_lock::sender::operation_state state is "
                         "empty, was the sender already started?");
 
-                    auto continuation =
-                        [r = HPX_MOVE(os.r)](
-                            shared_state_ptr_type state) mutable {
-                            try
-                            {
-                                hpx::execution::experimental::set_value(
-                                    HPX_MOVE(r), access_type{HPX_MOVE(state)});
-                            }
-                            catch (...)
-                            {
-                                hpx::execution::experimental::set_error(
-                                    HPX_MOVE(r), std::current_exception());
-                            }
-                        };
-
                     if (os.prev_state)
                     {
-                        os.prev_state->add_continuation(HPX_MOVE(continuation));
+                        os.prev_state->add_continuation(&os);
 
                         // We release prev_state here to allow continuations to
                         // run. The operation state may otherwise keep it alive
@@ -501,7 +701,7 @@ namespace hpx { namespace experimental {
                     {
                         // There is no previous state on the first access. We
                         // can immediately trigger the continuation.
-                        continuation(HPX_MOVE(os.state));
+                        continuation(&os, HPX_MOVE(os.state));
                     }
                 }
             };
@@ -538,6 +738,10 @@ namespace hpx { namespace experimental {
         template <detail::async_rw_mutex_access_type AccessType>
         struct sender;
 
+        using shared_state_type =
+            detail::async_rw_mutex_shared_state<std::decay_t<ReadWriteT>>;
+        using shared_state_ptr_type = std::shared_ptr<shared_state_type>;
+
     public:
         using read_type = std::decay_t<ReadT> const;
         using readwrite_type = std::decay_t<ReadWriteT>;
@@ -592,6 +796,22 @@ namespace hpx { namespace experimental {
             return {prev_state, state};
         }
 
+        // Returns a range of n read-only senders which are granted access
+        // together. The senders are created while iterating over the range.
+        detail::async_rw_mutex_read_range<
+            sender<detail::async_rw_mutex_access_type::read>,
+            shared_state_ptr_type>
+        read_many(std::size_t n)
+        {
+            if (n == 0)
+            {
+                return {};
+            }
+
+            auto s = read();
+            return {HPX_MOVE(s.prev_state), HPX_MOVE(s.state), n};
+        }
+
         sender<detail::async_rw_mutex_access_type::readwrite> readwrite()
         {
             prev_state = HPX_MOVE(state);
@@ -615,10 +835,6 @@ namespace hpx { namespace experimental {
         }
 
     private:
-        using shared_state_type =
-            detail::async_rw_mutex_shared_state<value_type>;
-        using shared_state_ptr_type = std::shared_ptr<shared_state_type>;
-
         template <detail::async_rw_mutex_access_type AccessType>
         struct sender
         {
@@ -649,7 +865,11 @@ namespace hpx { namespace experimental {
 
             template <typename R>
             struct operation_state
+              : detail::async_rw_mutex_operation_state_base<shared_state_type>
             {
+                using base_type = detail::async_rw_mutex_operation_state_base<
+                    shared_state_type>;
+
                 std::decay_t<R> r;
                 shared_state_ptr_type prev_state;
                 shared_state_ptr_type state;
@@ -657,7 +877,8 @@ namespace hpx { namespace experimental {
                 template <typename R_>
                 operation_state(R_&& r, shared_state_ptr_type prev_state,
                     shared_state_ptr_type state)
-                  : r(HPX_FORWARD(R_, r))
+                  : base_type(&operation_state::continuation)
+                  , r(HPX_FORWARD(R_, r))
                   , prev_state(HPX_MOVE(prev_state))
                   , state(HPX_MOVE(state))
                 {
@@ -668,6 +889,26 @@ namespace hpx { namespace experimental {
                 operation_state(operation_state const&) = delete;
                 operation_state& operator=(operation_state const&) = delete;
 
+                static void continuation(
+                    base_type* base, shared_state_ptr_type state)
+                {
+                    auto& os = static_cast<operation_state&>(*base);
+
+                    // The access wrapper keeps the state alive, the operation
+                    // state itself must not delay the next access.
+                    os.state.reset();
+
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(os.r), access_type{HPX_MOVE(state)});
+                        },
+                        [&](std::exception_ptr ep) {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(os.r), HPX_MOVE(ep));
+                        });
+                }
+
                 friend void tag_invoke(hpx::execution::experimental::start_t,
                     operation_state& os) noexcept
                 {
@@ -675,24 +916,9 @@ namespace hpx { namespace experimental {
                         "async_rw_lock::sender::operation_state state is "
                         "empty, was the sender already started?");
 
-                    auto continuation =
-                        [r = HPX_MOVE(os.r)](
-                            shared_state_ptr_type state) mutable {
-                            try
-                            {
-                                hpx::execution::experimental::set_value(
-                                    HPX_MOVE(r), access_type{HPX_MOVE(state)});
-                            }
-                            catch (...)
-                            {
-                                hpx::execution::experimental::set_error(
-                                    HPX_MOVE(r), std::current_exception());
-                            }
-                        };
-
                     if (os.prev_state)
                     {
-                        os.prev_state->add_continuation(HPX_MOVE(continuation));
+                        os.prev_state->add_continuation(&os);
                         // We release prev_state here to allow continuations to
                         // run. The operation state may otherwise keep it alive
                         // longer than needed.
@@ -702,7 +928,7 @@ namespace hpx { namespace experimental {
                     {
                         // There is no previous state on the first access. We
                         // can immediately trigger the continuation.
-                        continuation(HPX_MOVE(os.state));
+                        continuation(&os, HPX_MOVE(os.state));
                     }
                 }
             };
@@ -12,6 +12,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/detail/os_thread_parking.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 
@@ -93,6 +94,9 @@ namespace hpx {
     /// Cpp17MoveConstructible (Table 28), Cpp17MoveAssignable (Table 30), and
     /// Cpp17Destructible (Table 32) requirements.
     ///
+    /// HPX threads blocking on the phase synchronization point are suspended,
+    /// while OS threads (not managed by HPX) are parked at the OS level.
+    ///
     template <typename OnCompletion = detail::empty_oncompletion>
     class barrier
     {
@@ -154,6 +158,11 @@ namespace hpx {
                 completion_();
                 arrived_ = new_expected;
                 phase_ = !old_phase;
+
+                // wake up OS threads while holding the lock, a released
+                // thread has to acquire it before returning from wait, thus
+                // it can't destroy the barrier while it is being accessed
+                parking_.notify_all();
                 cond_.notify_all(HPX_MOVE(l));
             }
             return old_phase;
@@ -205,6 +214,13 @@ namespace hpx {
         ///                 types ([thread.mutex.requirements.mutex]).
         void wait(arrival_token&& old_phase) const
         {
+            if (lcos::local::detail::is_os_thread())
+            {
+                // OS threads can't be suspended, park them instead
+                wait_os_thread(old_phase);
+                return;
+            }
+
             std::unique_lock<mutex_type> l(mtx_);
             if (phase_ == old_phase)
             {
@@ -216,6 +232,12 @@ namespace hpx {
         /// Effects:        Equivalent to: wait(arrive()).
         void arrive_and_wait()
         {
+            if (lcos::local::detail::is_os_thread())
+            {
+                wait_os_thread(arrive(1));
+                return;
+            }
+
             std::unique_lock<mutex_type> l(mtx_);
             arrival_token old_phase = arrive_locked(l, 1);
             if (phase_ == old_phase)
@@ -251,8 +273,33 @@ namespace hpx {
         }
 
     private:
+        /// \cond NOINTERNAL
+        // The parking lot may be notified by the completion of a phase other
+        // than the one this thread is waiting for (a notification of the
+        // previous phase may be delayed), thus the phase has to be checked
+        // again after each wakeup.
+        void wait_os_thread(arrival_token old_phase) const
+        {
+            for (;;)
+            {
+                std::uint32_t const epoch = parking_.prepare_wait();
+                {
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (phase_ != old_phase)
+                    {
+                        l.unlock();
+                        parking_.cancel_wait();
+                        return;
+                    }
+                }
+                parking_.wait(epoch);
+            }
+        }
+        /// \endcond
+
         mutable mutex_type mtx_;
         mutable hpx::lcos::local::detail::condition_variable cond_;
+        mutable hpx::lcos::local::detail::os_thread_parking parking_;
 
         std::ptrdiff_t expected_;
         std::ptrdiff_t arrived_;
@@ -13,6 +13,7 @@
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/detail/channel_senders.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <cstddef>
@@ -27,11 +28,19 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // multiple producers and multiple consumers. The data is stored in a
     // ring-buffer.
+    //
+    // Besides the non-blocking get() and set() operations the channel exposes
+    // the senders async_get(), async_set(), async_get_n(), and async_set_n()
+    // which complete once data or buffer space is available.
     template <typename T, typename Mutex = util::spinlock>
     class bounded_channel
+      : public detail::channel_async_base<bounded_channel<T, Mutex>, T>
     {
     private:
         using mutex_type = Mutex;
+        using base_type =
+            detail::channel_async_base<bounded_channel<T, Mutex>, T>;
+        friend base_type;
 
         bool is_full(std::size_t tail) const noexcept
         {
@@ -67,7 +76,8 @@ namespace hpx { namespace lcos { namespace local {
         }
 
         bounded_channel(bounded_channel&& rhs) noexcept
-          : head_(rhs.head_)
+          : base_type()
+          , head_(rhs.head_)
           , tail_(rhs.tail_)
           , size_(rhs.size_)
           , buffer_(HPX_MOVE(rhs.buffer_))
@@ -105,6 +115,54 @@ namespace hpx { namespace lcos { namespace local {
         }
 
         bool get(T* val = nullptr) const noexcept
+        {
+            if (!get_impl(val))
+            {
+                return false;
+            }
+
+            if (val != nullptr)
+            {
+                this->notify_setters();
+            }
+            return true;
+        }
+
+        bool set(T&& t) noexcept
+        {
+            if (!set_impl(HPX_MOVE(t)))
+            {
+                return false;
+            }
+
+            this->notify_getters();
+            return true;
+        }
+
+        std::size_t close()
+        {
+            {
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                close(l);
+            }
+
+            // cancel all pending asynchronous operations
+            return this->notify_closed();
+        }
+
+        std::size_t capacity() const
+        {
+            return size_ - 1;
+        }
+
+        bool is_closed() const noexcept
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            return closed_;
+        }
+
+    private:
+        bool get_impl(T* val) const noexcept
         {
             std::unique_lock<mutex_type> l(mtx_.data_);
             if (closed_)
@@ -134,7 +192,7 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
-        bool set(T&& t) noexcept
+        bool set_impl(T&& t) noexcept
         {
             std::unique_lock<mutex_type> l(mtx_.data_);
             if (closed_)
@@ -159,17 +217,6 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
-        std::size_t close()
-        {
-            std::unique_lock<mutex_type> l(mtx_.data_);
-            return close(l);
-        }
-
-        std::size_t capacity() const
-        {
-            return size_ - 1;
-        }
-
     protected:
         std::size_t close(std::unique_lock<mutex_type>& l)
         {
@@ -13,6 +13,7 @@
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/detail/channel_senders.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
@@ -28,11 +29,19 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // a multiple producers and a single consumer. The data is stored in a
     // ring-buffer.
+    //
+    // Besides the non-blocking get() and set() operations the channel exposes
+    // the senders async_get(), async_set(), async_get_n(), and async_set_n()
+    // which complete once data or buffer space is available.
     template <typename T, typename Mutex = util::spinlock>
     class base_channel_mpsc
+      : public detail::channel_async_base<base_channel_mpsc<T, Mutex>, T>
     {
     private:
         using mutex_type = Mutex;
+        using base_type =
+            detail::channel_async_base<base_channel_mpsc<T, Mutex>, T>;
+        friend base_type;
 
         bool is_full(std::size_t tail) const noexcept
         {
@@ -70,7 +79,8 @@ namespace hpx { namespace lcos { namespace local {
         }
 
         base_channel_mpsc(base_channel_mpsc&& rhs) noexcept
-          : size_(rhs.size_)
+          : base_type()
+          , size_(rhs.size_)
           , buffer_(HPX_MOVE(rhs.buffer_))
         {
             head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
@@ -117,6 +127,56 @@ namespace hpx { namespace lcos { namespace local {
         }
 
         bool get(T* val = nullptr) const noexcept
+        {
+            if (!get_impl(val))
+            {
+                return false;
+            }
+
+            if (val != nullptr)
+            {
+                this->notify_setters();
+            }
+            return true;
+        }
+
+        bool set(T&& t) noexcept
+        {
+            if (!set_impl(HPX_MOVE(t)))
+            {
+                return false;
+            }
+
+            this->notify_getters();
+            return true;
+        }
+
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_weak(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::base_channel_mpsc::close",
+                    "attempting to close an already closed channel");
+            }
+
+            // cancel all pending asynchronous operations
+            return this->notify_closed();
+        }
+
+        std::size_t capacity() const
+        {
+            return size_ - 1;
+        }
+
+        bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+    private:
+        bool get_impl(T* val) const noexcept
         {
             if (closed_.load(std::memory_order_relaxed))
             {
@@ -145,7 +205,7 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
-        bool set(T&& t) noexcept
+        bool set_impl(T&& t) noexcept
         {
             if (closed_.load(std::memory_order_relaxed))
             {
@@ -172,23 +232,6 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
-        std::size_t close()
-        {
-            bool expected = false;
-            if (!closed_.compare_exchange_weak(expected, true))
-            {
-                HPX_THROW_EXCEPTION(hpx::invalid_status,
-                    "hpx::lcos::local::base_channel_mpsc::close",
-                    "attempting to close an already closed channel");
-            }
-            return 0;
-        }
-
-        std::size_t capacity() const
-        {
-            return size_ - 1;
-        }
-
     private:
         // keep the mutex with the tail and the head pointer in separate cache
         // lines
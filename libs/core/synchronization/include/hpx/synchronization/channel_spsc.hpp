@@ -12,6 +12,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/channel_senders.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -25,10 +26,18 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // a single producer and a single consumer. The data is stored in a
     // ring-buffer.
+    //
+    // Besides the non-blocking get() and set() operations the channel exposes
+    // the senders async_get(), async_set(), async_get_n(), and async_set_n()
+    // which complete once data or buffer space is available.
     template <typename T>
     class channel_spsc
+      : public detail::channel_async_base<channel_spsc<T>, T>
     {
     private:
+        using base_type = detail::channel_async_base<channel_spsc<T>, T>;
+        friend base_type;
+
         bool is_full(std::size_t tail) const noexcept
         {
             std::size_t numitems =
@@ -65,7 +74,8 @@ namespace hpx { namespace lcos { namespace local {
         }
 
         channel_spsc(channel_spsc&& rhs) noexcept
-          : size_(rhs.size_)
+          : base_type()
+          , size_(rhs.size_)
           , buffer_(HPX_MOVE(rhs.buffer_))
         {
             head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
@@ -110,6 +120,56 @@ namespace hpx { namespace lcos { namespace local {
         }
 
         bool get(T* val = nullptr) const noexcept
+        {
+            if (!get_impl(val))
+            {
+                return false;
+            }
+
+            if (val != nullptr)
+            {
+                this->notify_setters();
+            }
+            return true;
+        }
+
+        bool set(T&& t) noexcept
+        {
+            if (!set_impl(HPX_MOVE(t)))
+            {
+                return false;
+            }
+
+            this->notify_getters();
+            return true;
+        }
+
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_weak(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::channel_spsc::close",
+                    "attempting to close an already closed channel");
+            }
+
+            // cancel all pending asynchronous operations
+            return this->notify_closed();
+        }
+
+        std::size_t capacity() const
+        {
+            return size_ - 1;
+        }
+
+        bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+    private:
+        bool get_impl(T* val) const noexcept
         {
             if (closed_.load(std::memory_order_relaxed))
             {
@@ -138,7 +198,7 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
-        bool set(T&& t) noexcept
+        bool set_impl(T&& t) noexcept
         {
             if (closed_.load(std::memory_order_relaxed))
             {
@@ -162,23 +222,6 @@ namespace hpx { namespace lcos { namespace local {
             return true;
         }
 
-        std::size_t close()
-        {
-            bool expected = false;
-            if (!closed_.compare_exchange_weak(expected, true))
-            {
-                HPX_THROW_EXCEPTION(hpx::invalid_status,
-                    "hpx::lcos::local::channel_spsc::close",
-                    "attempting to close an already closed channel");
-            }
-            return 0;
-        }
-
-        std::size_t capacity() const
-        {
-            return size_ - 1;
-        }
-
     private:
         // keep the head and the tail pointer in separate cache lines
         mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
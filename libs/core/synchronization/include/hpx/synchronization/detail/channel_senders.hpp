@@ -0,0 +1,659 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Waiters are embedded into the operation states of the channel senders,
+    // thus suspending an operation does not allocate.
+    struct channel_waiter
+    {
+        using resume_function = void (*)(channel_waiter*) noexcept;
+
+        explicit channel_waiter(resume_function resume) noexcept
+          : resume_(resume)
+        {
+        }
+
+        channel_waiter* next_ = nullptr;
+        resume_function resume_;
+    };
+
+    // An intrusive FIFO list of operations waiting for one of the ends of a
+    // channel to make progress.
+    class channel_waiter_list
+    {
+    public:
+        channel_waiter_list() = default;
+
+        // Queue the given waiter unless the operation can be completed right
+        // away. The operation is attempted after the waiter has announced
+        // itself, which guarantees that no notification can be lost.
+        template <typename F>
+        bool wait_unless(channel_waiter* w, F&& attempt)
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+
+            count_.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (attempt())
+            {
+                count_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            w->next_ = nullptr;
+            if (tail_ == nullptr)
+            {
+                head_ = w;
+            }
+            else
+            {
+                tail_->next_ = w;
+            }
+            tail_ = w;
+            return false;
+        }
+
+        // Resume the oldest waiter, if any. This is called after the other
+        // end of the channel has made progress.
+        void notify_one() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (count_.load(std::memory_order_relaxed) == 0)
+                return;
+
+            channel_waiter* w = nullptr;
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                w = head_;
+                if (w == nullptr)
+                    return;
+
+                head_ = w->next_;
+                if (head_ == nullptr)
+                    tail_ = nullptr;
+                count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            resume(w);
+        }
+
+        // Resume all waiters, returns the number of resumed waiters.
+        std::size_t notify_all() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (count_.load(std::memory_order_relaxed) == 0)
+                return 0;
+
+            channel_waiter* w = nullptr;
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                w = head_;
+                head_ = tail_ = nullptr;
+            }
+
+            std::size_t count = 0;
+            while (w != nullptr)
+            {
+                channel_waiter* next = w->next_;
+                count_.fetch_sub(1, std::memory_order_relaxed);
+                resume(w);
+                w = next;
+                ++count;
+            }
+            return count;
+        }
+
+    private:
+        // Waiters are resumed (and their receivers are completed) directly
+        // from inside the operation of the other end. Operations which are
+        // started from such completions could nest without bounds, thus the
+        // waiter is resumed on a new thread once the nesting becomes too
+        // deep (the same limit as for future continuations applies).
+        static void resume(channel_waiter* w) noexcept
+        {
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+            bool const resume_directly =
+                this_thread::has_sufficient_stack_space();
+#else
+            bool const resume_directly =
+                threads::get_continuation_recursion_count() <
+                    HPX_CONTINUATION_MAX_RECURSION_DEPTH &&
+                threads::get_self_ptr() != nullptr;
+#endif
+            if (!resume_directly)
+            {
+                try
+                {
+                    threads::thread_init_data data(
+                        threads::make_thread_function_nullary(
+                            [w]() { w->resume_(w); }),
+                        "channel_waiter_list::resume",
+                        threads::thread_priority::boost);
+                    threads::register_work(data);
+                    return;
+                }
+                catch (...)
+                {
+                    // no thread could be created (e.g. outside of the
+                    // runtime), resume the waiter directly instead
+                }
+            }
+
+            std::size_t& count = threads::get_continuation_recursion_count();
+            ++count;
+            w->resume_(w);
+            --count;
+        }
+
+        hpx::spinlock mtx_;
+        channel_waiter* head_ = nullptr;
+        channel_waiter* tail_ = nullptr;
+
+        // number of operations which are about to wait or are waiting
+        std::atomic<std::size_t> count_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Base class providing sender based (asynchronous) operations to the
+    // bounded channels. Derived has to expose
+    //
+    //      bool get_impl(T*), bool set_impl(T&&)
+    //      bool is_closed() const
+    //
+    // where get_impl and set_impl are non-blocking and must not notify any
+    // waiters. set_impl may move from its argument only if it succeeds. The
+    // public (synchronous) operations of Derived have to invoke
+    // notify_getters() and notify_setters() after having made progress.
+    template <typename Derived, typename T>
+    class channel_async_base
+    {
+    protected:
+        channel_async_base() = default;
+
+        // waiters are not transferred, a channel must not be moved while
+        // asynchronous operations are pending
+        channel_async_base(channel_async_base&&) noexcept {}
+        channel_async_base& operator=(channel_async_base&&) noexcept
+        {
+            return *this;
+        }
+
+        ~channel_async_base() = default;
+
+        // resume an operation waiting for a value to become available
+        void notify_getters() const noexcept
+        {
+            getters_.notify_one();
+        }
+
+        // resume an operation waiting for buffer space to become available
+        void notify_setters() const noexcept
+        {
+            setters_.notify_one();
+        }
+
+        // resume all waiting operations after the channel has been closed
+        std::size_t notify_closed() const noexcept
+        {
+            return getters_.notify_all() + setters_.notify_all();
+        }
+
+    private:
+        Derived& derived() const noexcept
+        {
+            return const_cast<Derived&>(static_cast<Derived const&>(*this));
+        }
+
+        static std::exception_ptr closed_error(char const* name)
+        {
+            return HPX_GET_EXCEPTION(hpx::invalid_status, name,
+                "the channel was closed while waiting for this operation");
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Common implementation of all operation states. Operation is a CRTP
+        // parameter exposing
+        //
+        //      bool attempt(Derived&, bool& progress)
+        //          returns true if the operation has finished, progress is
+        //          set if elements were moved from or to the channel
+        //      void complete() noexcept
+        //
+        template <typename Operation, bool IsGetter>
+        struct operation_base : channel_waiter
+        {
+            explicit operation_base(Derived& channel) noexcept
+              : channel_waiter(&operation_base::resume)
+              , channel_(channel)
+            {
+            }
+
+            operation_base(operation_base&&) = delete;
+            operation_base& operator=(operation_base&&) = delete;
+            operation_base(operation_base const&) = delete;
+            operation_base& operator=(operation_base const&) = delete;
+
+            channel_waiter_list& waiters() const noexcept
+            {
+                return IsGetter ? channel_.getters_ : channel_.setters_;
+            }
+
+            static void notify_other_end(Derived& channel) noexcept
+            {
+                if constexpr (IsGetter)
+                {
+                    channel.notify_setters();
+                }
+                else
+                {
+                    channel.notify_getters();
+                }
+            }
+
+            void run() noexcept
+            {
+                Operation& op = static_cast<Operation&>(*this);
+
+                // Once the operation has been queued it may be resumed,
+                // completed and destroyed by the other end at any time, thus
+                // no member may be accessed after wait_unless has returned
+                // false.
+                Derived& channel = channel_;
+
+                bool progress = false;
+                bool const done = waiters().wait_unless(this, [&]() {
+                    bool const finished = op.attempt(channel, progress);
+                    return finished || channel.is_closed();
+                });
+
+                // wake up the other end only after having released the lock
+                // protecting our own waiters
+                if (progress)
+                {
+                    notify_other_end(channel);
+                }
+
+                if (done)
+                {
+                    op.complete();
+                }
+            }
+
+            static void resume(channel_waiter* w) noexcept
+            {
+                static_cast<operation_base*>(w)->run();
+            }
+
+            Derived& channel_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Receiver>
+        struct get_operation
+          : operation_base<get_operation<Receiver>, true>
+        {
+            template <typename Receiver_>
+            get_operation(Derived& channel, Receiver_&& r)
+              : operation_base<get_operation, true>(channel)
+              , r_(HPX_FORWARD(Receiver_, r))
+            {
+            }
+
+            bool attempt(Derived& channel, bool& progress)
+            {
+                received_ = channel.get_impl(&value_);
+                progress = received_;
+                return received_;
+            }
+
+            void complete() noexcept
+            {
+                if (!received_)
+                {
+                    hpx::execution::experimental::set_error(HPX_MOVE(r_),
+                        closed_error("hpx::lcos::local::channel::async_get"));
+                    return;
+                }
+
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r_), HPX_MOVE(value_));
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r_), HPX_MOVE(ep));
+                    });
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                get_operation& os) noexcept
+            {
+                os.run();
+            }
+
+            std::decay_t<Receiver> r_;
+            T value_;
+            bool received_ = false;
+        };
+
+        template <typename Receiver>
+        struct set_operation
+          : operation_base<set_operation<Receiver>, false>
+        {
+            template <typename Receiver_>
+            set_operation(Derived& channel, T&& value, Receiver_&& r)
+              : operation_base<set_operation, false>(channel)
+              , r_(HPX_FORWARD(Receiver_, r))
+              , value_(HPX_MOVE(value))
+            {
+            }
+
+            bool attempt(Derived& channel, bool& progress)
+            {
+                stored_ = channel.set_impl(HPX_MOVE(value_));
+                progress = stored_;
+                return stored_;
+            }
+
+            void complete() noexcept
+            {
+                if (!stored_)
+                {
+                    hpx::execution::experimental::set_error(HPX_MOVE(r_),
+                        closed_error("hpx::lcos::local::channel::async_set"));
+                    return;
+                }
+
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::execution::experimental::set_value(HPX_MOVE(r_));
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r_), HPX_MOVE(ep));
+                    });
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                set_operation& os) noexcept
+            {
+                os.run();
+            }
+
+            std::decay_t<Receiver> r_;
+            T value_;
+            bool stored_ = false;
+        };
+
+        // the batch operations complete with the number of elements moved,
+        // which is smaller than requested only if the channel was closed
+        template <typename OutIter, typename Receiver>
+        struct get_n_operation
+          : operation_base<get_n_operation<OutIter, Receiver>, true>
+        {
+            template <typename Receiver_>
+            get_n_operation(
+                Derived& channel, OutIter out, std::size_t n, Receiver_&& r)
+              : operation_base<get_n_operation, true>(channel)
+              , r_(HPX_FORWARD(Receiver_, r))
+              , out_(HPX_MOVE(out))
+              , n_(n)
+            {
+            }
+
+            bool attempt(Derived& channel, bool& progress)
+            {
+                T value;
+                while (count_ != n_ && channel.get_impl(&value))
+                {
+                    *out_ = HPX_MOVE(value);
+                    ++out_;
+                    ++count_;
+                    progress = true;
+                }
+                return count_ == n_;
+            }
+
+            void complete() noexcept
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r_), count_);
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r_), HPX_MOVE(ep));
+                    });
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                get_n_operation& os) noexcept
+            {
+                os.run();
+            }
+
+            std::decay_t<Receiver> r_;
+            OutIter out_;
+            std::size_t n_;
+            std::size_t count_ = 0;
+        };
+
+        template <typename InIter, typename Receiver>
+        struct set_n_operation
+          : operation_base<set_n_operation<InIter, Receiver>, false>
+        {
+            template <typename Receiver_>
+            set_n_operation(
+                Derived& channel, InIter in, std::size_t n, Receiver_&& r)
+              : operation_base<set_n_operation, false>(channel)
+              , r_(HPX_FORWARD(Receiver_, r))
+              , in_(HPX_MOVE(in))
+              , n_(n)
+            {
+            }
+
+            bool attempt(Derived& channel, bool& progress)
+            {
+                while (count_ != n_ && channel.set_impl(HPX_MOVE(*in_)))
+                {
+                    ++in_;
+                    ++count_;
+                    progress = true;
+                }
+                return count_ == n_;
+            }
+
+            void complete() noexcept
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(r_), count_);
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(r_), HPX_MOVE(ep));
+                    });
+            }
+
+            friend void tag_invoke(hpx::execution::experimental::start_t,
+                set_n_operation& os) noexcept
+            {
+                os.run();
+            }
+
+            std::decay_t<Receiver> r_;
+            InIter in_;
+            std::size_t n_;
+            std::size_t count_ = 0;
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        struct get_sender
+        {
+            Derived* channel_;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<T>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                get_sender const&, Env) -> generate_completion_signatures<Env>;
+
+            template <typename R>
+            friend get_operation<R> tag_invoke(
+                hpx::execution::experimental::connect_t, get_sender s, R&& r)
+            {
+                return {*s.channel_, HPX_FORWARD(R, r)};
+            }
+        };
+
+        struct set_sender
+        {
+            Derived* channel_;
+            T value_;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                set_sender const&, Env) -> generate_completion_signatures<Env>;
+
+            template <typename R>
+            friend set_operation<R> tag_invoke(
+                hpx::execution::experimental::connect_t, set_sender&& s, R&& r)
+            {
+                return {*s.channel_, HPX_MOVE(s.value_), HPX_FORWARD(R, r)};
+            }
+        };
+
+        template <typename Iter, bool IsGetter>
+        struct batch_sender
+        {
+            Derived* channel_;
+            Iter it_;
+            std::size_t n_;
+
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<std::size_t>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                batch_sender const&, Env)
+                -> generate_completion_signatures<Env>;
+
+            template <typename R>
+            using operation_type = std::conditional_t<IsGetter,
+                get_n_operation<Iter, R>, set_n_operation<Iter, R>>;
+
+            template <typename R>
+            friend operation_type<R> tag_invoke(
+                hpx::execution::experimental::connect_t, batch_sender s, R&& r)
+            {
+                return {*s.channel_, HPX_MOVE(s.it_), s.n_, HPX_FORWARD(R, r)};
+            }
+        };
+
+        // Return a sender which receives the next value from the channel.
+        // The sender completes with an error if the channel is closed before
+        // a value becomes available.
+        get_sender async_get() const noexcept
+        {
+            return {&derived()};
+        }
+
+        // Return a sender which stores the given value into the channel as
+        // soon as space is available. The sender completes with an error if
+        // the channel is closed before that.
+        set_sender async_set(T value) noexcept
+        {
+            return {&derived(), HPX_MOVE(value)};
+        }
+
+        // Return a sender which moves n values from the channel to the given
+        // output iterator, completing with the number of values received.
+        template <typename OutIter>
+        batch_sender<OutIter, true> async_get_n(
+            OutIter out, std::size_t n) const
+        {
+            return {&derived(), HPX_MOVE(out), n};
+        }
+
+        // Return a sender which moves n values read from the given input
+        // iterator into the channel, completing with the number of values
+        // stored.
+        template <typename InIter>
+        batch_sender<InIter, false> async_set_n(InIter in, std::size_t n)
+        {
+            return {&derived(), HPX_MOVE(in), n};
+        }
+
+    private:
+        mutable channel_waiter_list getters_;
+        mutable channel_waiter_list setters_;
+    };
+}}}}    // namespace hpx::lcos::local::detail
@@ -0,0 +1,104 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+#if !(defined(__linux) || defined(linux) || defined(__linux__))
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::lcos::local::detail {
+
+    // Returns whether the calling thread is not an HPX thread, i.e. whether
+    // it can't be suspended but has to be blocked at the OS level.
+    HPX_CORE_EXPORT bool is_os_thread() noexcept;
+
+    // os_thread_parking blocks OS threads (threads not managed by HPX) until
+    // the owning synchronization primitive signals a state change. On Linux
+    // the waiting threads are parked on a futex, elsewhere a condition
+    // variable is used.
+    //
+    // A waiter first announces itself by calling prepare_wait() and then
+    // re-checks the predicate it is waiting for. If the predicate is still
+    // not satisfied it calls wait() with the epoch returned from
+    // prepare_wait(), otherwise it calls cancel_wait(). Notifiers have to
+    // make the predicate true (using sequentially consistent operations or
+    // under a lock shared with the waiter) before calling notify_all().
+    //
+    // wait() may return after any call to notify_all(), waiters which need
+    // to observe a specific state change have to re-check their predicate
+    // and wait again if needed. wait() does not return before all calls to
+    // notify_all() which are in progress have stopped accessing the parking
+    // object, thus a released waiter may destroy the owning primitive.
+    class HPX_CORE_EXPORT os_thread_parking
+    {
+    public:
+        HPX_NON_COPYABLE(os_thread_parking);
+
+        constexpr os_thread_parking() noexcept
+          : epoch_(0)
+          , waiters_(0)
+          , notifying_(0)
+        {
+        }
+
+        std::uint32_t prepare_wait() noexcept
+        {
+            std::uint32_t const epoch = epoch_.load(std::memory_order_acquire);
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+            return epoch;
+        }
+
+        void cancel_wait() noexcept
+        {
+            waiters_.fetch_sub(1, std::memory_order_release);
+        }
+
+        // Block the calling OS thread until notify_all() was invoked after
+        // the given epoch was read by prepare_wait().
+        void wait(std::uint32_t epoch) noexcept;
+
+        // Wake up all parked threads, this does not enter the kernel if
+        // there are no OS threads waiting.
+        void notify_all() noexcept
+        {
+            // released waiters do not return before this has been reset
+            notifying_.fetch_add(1, std::memory_order_seq_cst);
+            epoch_.fetch_add(1, std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_seq_cst) != 0)
+            {
+                wake_all();
+            }
+            notifying_.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        void wake_all() noexcept;
+
+        // wait for all notifications in progress to complete
+        void wait_for_notifiers() const noexcept;
+
+        // futex word on Linux
+        std::atomic<std::uint32_t> epoch_;
+        std::atomic<std::uint32_t> waiters_;
+        std::atomic<std::uint32_t> notifying_;
+
+#if !(defined(__linux) || defined(linux) || defined(__linux__))
+        std::mutex mtx_;
+        std::condition_variable cond_;
+#endif
+    };
+}    // namespace hpx::lcos::local::detail
+
+#include <hpx/config/warnings_suffix.hpp>
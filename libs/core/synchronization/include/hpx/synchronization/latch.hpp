@@ -11,6 +11,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/detail/os_thread_parking.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
@@ -28,6 +29,10 @@ namespace hpx {
     /// threads to block until an operation is completed. An individual latch
     /// is a singleuse object; once the operation has been completed, the latch
     /// cannot be reused.
+    ///
+    /// HPX threads blocking on a latch are suspended, while OS threads (not
+    /// managed by HPX) are parked at the OS level. Both are woken by the same
+    /// call that decrements the counter to zero.
     class latch
     {
     public:
@@ -46,6 +51,7 @@ namespace hpx {
         explicit latch(std::ptrdiff_t count)
           : mtx_()
           , cond_()
+          , parking_()
           , counter_(count)
           , notified_(count == 0)
         {
@@ -98,6 +104,11 @@ namespace hpx {
                 std::unique_lock l(mtx_.data_);
                 notified_ = true;
 
+                // wake up OS threads while holding the lock, a released
+                // thread has to acquire it before returning from wait, thus
+                // it can't destroy the latch while it is being accessed
+                parking_.data_.notify_all();
+
                 // Note: we use notify_one repeatedly instead of notify_all as we
                 // know that our implementation of condition_variable::notify_one
                 // relinquishes the lock before resuming the waiting thread
@@ -126,6 +137,13 @@ namespace hpx {
         ///
         void wait() const
         {
+            if (lcos::local::detail::is_os_thread())
+            {
+                // OS threads can't be suspended, park them instead
+                wait_os_thread();
+                return;
+            }
+
             std::unique_lock l(mtx_.data_);
             if (counter_.load(std::memory_order_relaxed) > 0 || !notified_)
             {
@@ -144,6 +162,13 @@ namespace hpx {
         {
             HPX_ASSERT(update >= 0);
 
+            if (lcos::local::detail::is_os_thread())
+            {
+                count_down(update);
+                wait_os_thread();
+                return;
+            }
+
             std::unique_lock l(mtx_.data_);
 
             std::ptrdiff_t old_count =
@@ -162,6 +187,9 @@ namespace hpx {
             {
                 notified_ = true;
 
+                // wake up OS threads while holding the lock (see count_down)
+                parking_.data_.notify_all();
+
                 // Note: we use notify_one repeatedly instead of notify_all as we
                 // know that our implementation of condition_variable::notify_one
                 // relinquishes the lock before resuming the waiting thread
@@ -176,10 +204,37 @@ namespace hpx {
         }
 
     protected:
+        /// \cond NOINTERNAL
+        // The latch is released once notified_ has been set while holding the
+        // lock. Checking it under the lock (instead of looking at counter_)
+        // ensures that the thread that released the latch has stopped
+        // accessing it before this thread returns and possibly destroys it.
+        void wait_os_thread() const
+        {
+            for (;;)
+            {
+                std::uint32_t const epoch = parking_.data_.prepare_wait();
+                {
+                    std::unique_lock l(mtx_.data_);
+                    if (notified_)
+                    {
+                        l.unlock();
+                        parking_.data_.cancel_wait();
+                        return;
+                    }
+                }
+                parking_.data_.wait(epoch);
+            }
+        }
+        /// \endcond
+
         mutable util::cache_line_data<mutex_type> mtx_;
         mutable util::cache_line_data<
             hpx::lcos::local::detail::condition_variable>
             cond_;
+        mutable util::cache_line_data<
+            hpx::lcos::local::detail::os_thread_parking>
+            parking_;
         std::atomic<std::ptrdiff_t> counter_;
         bool notified_;
     };
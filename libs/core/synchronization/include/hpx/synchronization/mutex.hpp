@@ -16,6 +16,9 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 namespace hpx { namespace threads {
 
     using thread_id_ref_type = thread_id_ref;
@@ -33,6 +36,12 @@ namespace hpx { namespace threads {
 namespace hpx {
 
     ///////////////////////////////////////////////////////////////////////////
+    /// The state of the mutex is kept in a single atomic word holding the
+    /// owning HPX thread (if any) and a flag signaling that other threads are
+    /// suspended waiting for the mutex. Uncontended lock and unlock
+    /// operations touch this word only. A thread trying to acquire a locked
+    /// mutex spins for a bounded amount of time (unless other threads are
+    /// suspended waiting for it already), and suspends afterwards.
     class mutex
     {
     public:
@@ -65,8 +74,19 @@ namespace hpx {
         HPX_CORE_EXPORT void unlock(error_code& ec = throws);
 
     protected:
+        // the owner is stored as a pointer to its thread_data (used as an
+        // identifier only, it is never dereferenced), the lowest bit is set
+        // if there are suspended threads waiting for the mutex
+        static constexpr std::uintptr_t has_waiters = 1;
+
+        HPX_CORE_EXPORT bool lock_slow(std::uintptr_t self,
+            hpx::chrono::steady_time_point const* abs_time,
+            char const* description, error_code& ec);
+
+        std::atomic<std::uintptr_t> state_;
+
+        // protects the queue of suspended threads
         mutable mutex_type mtx_;
-        threads::thread_id_type owner_id_;
         hpx::lcos::local::detail::condition_variable cond_;
     };
 
@@ -9,231 +9,307 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/mutex.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <vector>
 
 namespace hpx {
 
     namespace detail {
 
+        // The shared_mutex is optimized for read-mostly use. Readers announce
+        // themselves by incrementing a reader indicator associated with the
+        // core they are running on (each of the indicators lives on a
+        // separate cache line), they don't touch any shared state as long as
+        // no writer is around. A reader may release the lock on a different
+        // core than the one it acquired it on, thus the individual indicators
+        // may become negative, only their sum reflects the number of active
+        // readers.
+        //
+        // Writers announce themselves by setting the writer flag, which makes
+        // new readers take the slow path, and then wait for the active
+        // readers to drain. Waiting writers take precedence over new readers
+        // and new upgraders. All writer, upgrader, and blocked reader
+        // handoffs are coordinated using an internal mutex and condition
+        // variables.
         template <typename Mutex = hpx::mutex>
         class shared_mutex
         {
         private:
             typedef Mutex mutex_type;
 
-            struct state_data
-            {
-                unsigned shared_count;
-                bool exclusive;
-                bool upgrade;
-                bool exclusive_waiting_blocked;
-            };
+            using indicator_type =
+                util::cache_line_data<std::atomic<std::int64_t>>;
 
-            state_data state;
-            mutex_type state_change;
-            hpx::condition_variable shared_cond;
-            hpx::condition_variable exclusive_cond;
-            hpx::condition_variable upgrade_cond;
+            std::atomic<std::int64_t>& reader_indicator() noexcept
+            {
+                std::size_t const num = hpx::get_worker_thread_num();
+                return readers_[num % readers_.size()].data_;
+            }
 
-            void release_waiters()
+            std::int64_t count_readers() const noexcept
             {
-                exclusive_cond.notify_one();
-                shared_cond.notify_all();
+                std::int64_t count = 0;
+                for (auto const& indicator : readers_)
+                {
+                    count += indicator.data_.load(std::memory_order_seq_cst);
+                }
+                return count;
             }
 
-        public:
-            shared_mutex()
-              : state{0u, false, false, false}
-              , shared_cond()
-              , exclusive_cond()
-              , upgrade_cond()
+            // wait for all active readers (except the given number) to leave
+            void wait_for_readers(std::int64_t remaining = 0) const
             {
+                hpx::util::yield_while(
+                    [&]() { return count_readers() != remaining; },
+                    "hpx::shared_mutex::lock");
             }
 
-            void lock_shared()
+            bool try_lock_shared_fast() noexcept
             {
-                std::unique_lock<mutex_type> lk(state_change);
+                if (writer_.data_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
 
-                while (state.exclusive || state.exclusive_waiting_blocked)
+                // Pairs with the writer setting the flag and summing up the
+                // reader indicators afterwards: either the writer sees this
+                // reader or this reader sees the writer.
+                auto& indicator = reader_indicator();
+                indicator.fetch_add(1, std::memory_order_seq_cst);
+                if (HPX_LIKELY(!writer_.data_.load(std::memory_order_seq_cst)))
                 {
-                    shared_cond.wait(lk);
+                    return true;
                 }
 
-                ++state.shared_count;
+                // a writer has shown up in the meantime, back off
+                indicator.fetch_sub(1, std::memory_order_release);
+                return false;
             }
 
-            bool try_lock_shared()
+            // the following functions must be called while holding mtx_
+            void update_writer_flag() noexcept
             {
-                std::unique_lock<mutex_type> lk(state_change);
+                writer_.data_.store(exclusive_ || waiting_writers_ != 0,
+                    std::memory_order_seq_cst);
+            }
 
-                if (state.exclusive || state.exclusive_waiting_blocked)
-                    return false;
+            void release_waiters()
+            {
+                exclusive_cond_.notify_one();
+                shared_cond_.notify_all();
+            }
 
-                else
+        public:
+            shared_mutex()
+              : readers_((std::max)(std::size_t(1),
+                    std::size_t(threads::hardware_concurrency())))
+              , exclusive_(false)
+              , upgrade_(false)
+              , waiting_writers_(0)
+            {
+                for (auto& indicator : readers_)
                 {
-                    ++state.shared_count;
-                    return true;
+                    indicator.data_.store(0, std::memory_order_relaxed);
                 }
+                writer_.data_.store(false, std::memory_order_relaxed);
             }
 
-            void unlock_shared()
+            void lock_shared()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-
-                bool const last_reader = !--state.shared_count;
+                if (try_lock_shared_fast())
+                {
+                    return;
+                }
 
-                if (last_reader)
+                std::unique_lock<mutex_type> lk(mtx_);
+                while (exclusive_ || waiting_writers_ != 0)
                 {
-                    if (state.upgrade)
-                    {
-                        state.upgrade = false;
-                        state.exclusive = true;
+                    shared_cond_.wait(lk);
+                }
 
-                        upgrade_cond.notify_one();
-                    }
-                    else
-                    {
-                        state.exclusive_waiting_blocked = false;
-                    }
+                // no writer can be draining the readers while we hold mtx_
+                reader_indicator().fetch_add(1, std::memory_order_seq_cst);
+            }
 
-                    release_waiters();
-                }
+            bool try_lock_shared()
+            {
+                return try_lock_shared_fast();
             }
 
-            void lock()
+            void unlock_shared()
             {
-                std::unique_lock<mutex_type> lk(state_change);
+                reader_indicator().fetch_sub(1, std::memory_order_release);
+            }
 
-                while (state.shared_count || state.exclusive)
+            void lock()
+            {
                 {
-                    state.exclusive_waiting_blocked = true;
-                    exclusive_cond.wait(lk);
+                    std::unique_lock<mutex_type> lk(mtx_);
+
+                    ++waiting_writers_;
+                    update_writer_flag();
+
+                    while (exclusive_ || upgrade_)
+                    {
+                        exclusive_cond_.wait(lk);
+                    }
+
+                    --waiting_writers_;
+                    exclusive_ = true;
+                    update_writer_flag();
                 }
 
-                state.exclusive = true;
+                wait_for_readers();
             }
 
             bool try_lock()
             {
-                std::unique_lock<mutex_type> lk(state_change);
+                std::unique_lock<mutex_type> lk(mtx_);
 
-                if (state.shared_count || state.exclusive)
+                if (exclusive_ || upgrade_)
                     return false;
 
-                else
-                {
-                    state.exclusive = true;
+                exclusive_ = true;
+                update_writer_flag();
+
+                if (count_readers() == 0)
                     return true;
-                }
+
+                exclusive_ = false;
+                update_writer_flag();
+                release_waiters();
+                return false;
             }
 
             void unlock()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                state.exclusive = false;
-                state.exclusive_waiting_blocked = false;
+                std::unique_lock<mutex_type> lk(mtx_);
+                exclusive_ = false;
+                update_writer_flag();
                 release_waiters();
             }
 
             void lock_upgrade()
             {
-                std::unique_lock<mutex_type> lk(state_change);
+                std::unique_lock<mutex_type> lk(mtx_);
 
-                while (state.exclusive || state.exclusive_waiting_blocked ||
-                    state.upgrade)
+                while (exclusive_ || waiting_writers_ != 0 || upgrade_)
                 {
-                    shared_cond.wait(lk);
+                    shared_cond_.wait(lk);
                 }
 
-                ++state.shared_count;
-                state.upgrade = true;
+                reader_indicator().fetch_add(1, std::memory_order_seq_cst);
+                upgrade_ = true;
             }
 
             bool try_lock_upgrade()
             {
-                std::unique_lock<mutex_type> lk(state_change);
+                std::unique_lock<mutex_type> lk(mtx_);
 
-                if (state.exclusive || state.exclusive_waiting_blocked ||
-                    state.upgrade)
+                if (exclusive_ || waiting_writers_ != 0 || upgrade_)
                     return false;
 
-                else
-                {
-                    ++state.shared_count;
-                    state.upgrade = true;
-                    return true;
-                }
+                reader_indicator().fetch_add(1, std::memory_order_seq_cst);
+                upgrade_ = true;
+                return true;
             }
 
             void unlock_upgrade()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                state.upgrade = false;
-                bool const last_reader = !--state.shared_count;
-
-                if (last_reader)
-                {
-                    state.exclusive_waiting_blocked = false;
-                    release_waiters();
-                }
+                std::unique_lock<mutex_type> lk(mtx_);
+                upgrade_ = false;
+                reader_indicator().fetch_sub(1, std::memory_order_release);
+                release_waiters();
             }
 
             void unlock_upgrade_and_lock()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                --state.shared_count;
-
-                while (state.shared_count)
                 {
-                    upgrade_cond.wait(lk);
+                    std::unique_lock<mutex_type> lk(mtx_);
+                    upgrade_ = false;
+                    exclusive_ = true;
+                    update_writer_flag();
+                    reader_indicator().fetch_sub(1, std::memory_order_release);
                 }
 
-                state.upgrade = false;
-                state.exclusive = true;
+                wait_for_readers();
             }
 
             void unlock_and_lock_upgrade()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                state.exclusive = false;
-                state.upgrade = true;
-                ++state.shared_count;
-                state.exclusive_waiting_blocked = false;
+                std::unique_lock<mutex_type> lk(mtx_);
+                reader_indicator().fetch_add(1, std::memory_order_seq_cst);
+                exclusive_ = false;
+                upgrade_ = true;
+                update_writer_flag();
                 release_waiters();
             }
 
             void unlock_and_lock_shared()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                state.exclusive = false;
-                ++state.shared_count;
-                state.exclusive_waiting_blocked = false;
+                std::unique_lock<mutex_type> lk(mtx_);
+                reader_indicator().fetch_add(1, std::memory_order_seq_cst);
+                exclusive_ = false;
+                update_writer_flag();
                 release_waiters();
             }
 
             bool try_unlock_shared_and_lock()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                if (!state.exclusive && !state.exclusive_waiting_blocked &&
-                    !state.upgrade && state.shared_count == 1)
+                std::unique_lock<mutex_type> lk(mtx_);
+
+                if (exclusive_ || waiting_writers_ != 0 || upgrade_)
+                    return false;
+
+                exclusive_ = true;
+                update_writer_flag();
+
+                // the only remaining reader has to be the calling thread
+                if (count_readers() == 1)
                 {
-                    state.shared_count = 0;
-                    state.exclusive = true;
+                    reader_indicator().fetch_sub(1, std::memory_order_release);
                     return true;
                 }
+
+                exclusive_ = false;
+                update_writer_flag();
+                release_waiters();
                 return false;
             }
 
             void unlock_upgrade_and_lock_shared()
             {
-                std::unique_lock<mutex_type> lk(state_change);
-                state.upgrade = false;
-                state.exclusive_waiting_blocked = false;
+                std::unique_lock<mutex_type> lk(mtx_);
+                upgrade_ = false;
                 release_waiters();
             }
+
+        private:
+            // per-core reader indicators
+            std::vector<indicator_type> readers_;
+
+            // set while a writer holds or waits for the lock
+            util::cache_line_data<std::atomic<bool>> writer_;
+
+            // slow path state, protected by mtx_
+            mutex_type mtx_;
+            bool exclusive_;
+            bool upgrade_;
+            std::size_t waiting_writers_;
+
+            hpx::condition_variable shared_cond_;
+            hpx::condition_variable exclusive_cond_;
         };
     }    // namespace detail
 
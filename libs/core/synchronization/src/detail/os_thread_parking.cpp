@@ -0,0 +1,85 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/synchronization/detail/os_thread_parking.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace hpx::lcos::local::detail {
+
+    bool is_os_thread() noexcept
+    {
+        return threads::get_self_ptr() == nullptr;
+    }
+
+    void os_thread_parking::wait_for_notifiers() const noexcept
+    {
+        // the notifier is about to leave notify_all(), this is short
+        while (notifying_.load(std::memory_order_acquire) != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(int),
+        "the futex word has to be of the size of an int");
+
+    void os_thread_parking::wait(std::uint32_t epoch) noexcept
+    {
+        // the futex call returns immediately if the epoch has changed in
+        // the meantime, spurious wakeups are handled by the loop
+        while (epoch_.load(std::memory_order_acquire) == epoch)
+        {
+            ::syscall(SYS_futex, reinterpret_cast<int*>(&epoch_),
+                FUTEX_WAIT_PRIVATE, static_cast<int>(epoch), nullptr, nullptr,
+                0);
+        }
+        waiters_.fetch_sub(1, std::memory_order_release);
+        wait_for_notifiers();
+    }
+
+    void os_thread_parking::wake_all() noexcept
+    {
+        ::syscall(SYS_futex, reinterpret_cast<int*>(&epoch_),
+            FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+#else
+    void os_thread_parking::wait(std::uint32_t epoch) noexcept
+    {
+        {
+            std::unique_lock<std::mutex> l(mtx_);
+            cond_.wait(l, [&]() {
+                return epoch_.load(std::memory_order_acquire) != epoch;
+            });
+        }
+        waiters_.fetch_sub(1, std::memory_order_release);
+        wait_for_notifiers();
+    }
+
+    void os_thread_parking::wake_all() noexcept
+    {
+        // acquiring the mutex ensures that no waiter can miss the
+        // notification between checking the epoch and blocking
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+        }
+        cond_.notify_all();
+    }
+#endif
+}    // namespace hpx::lcos::local::detail
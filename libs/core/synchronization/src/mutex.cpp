@@ -18,14 +18,30 @@
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
 namespace hpx {
 
+    namespace {
+
+        // upper bound for the number of spin iterations before suspending,
+        // the owner may be suspended itself, so this is kept short
+        constexpr std::size_t mutex_max_spin_count = 256;
+
+        std::uintptr_t get_self_state() noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(
+                threads::get_self_id_data());
+        }
+    }    // namespace
+
     ///////////////////////////////////////////////////////////////////////////
     mutex::mutex(char const* const description)
-      : owner_id_(threads::invalid_thread_id)
+      : state_(0)
     {
         HPX_ITT_SYNC_CREATE(this, "hpx::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "hpx::mutex");
@@ -41,22 +57,21 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type self_id = threads::get_self_id();
-        if (owner_id_ == self_id)
+        std::uintptr_t const self = get_self_state();
+        std::uintptr_t expected = 0;
+        if (HPX_UNLIKELY(!state_.compare_exchange_strong(expected, self,
+                std::memory_order_acquire, std::memory_order_relaxed)))
         {
-            HPX_ITT_SYNC_CANCEL(this);
-            l.unlock();
-            HPX_THROWS_IF(ec, deadlock, description,
-                "The calling thread already owns the mutex");
-            return;
-        }
+            if ((expected & ~has_waiters) == self)
+            {
+                HPX_ITT_SYNC_CANCEL(this);
+                HPX_THROWS_IF(ec, deadlock, description,
+                    "The calling thread already owns the mutex");
+                return;
+            }
 
-        while (owner_id_ != threads::invalid_thread_id)
-        {
-            cond_.wait(l, ec);
-            if (ec)
+            if (!lock_slow(self, nullptr, description, ec))
             {
                 HPX_ITT_SYNC_CANCEL(this);
                 return;
@@ -65,7 +80,88 @@ namespace hpx {
 
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+    }
+
+    // Spin for a bounded number of iterations, suspend afterwards. The owner
+    // recorded in state_ is never dereferenced as its thread_data may have
+    // been destroyed in the meantime. Returns false if
+    // the mutex could not be acquired (either because of an error or because
+    // the given point in time has been reached).
+    bool mutex::lock_slow(std::uintptr_t self,
+        hpx::chrono::steady_time_point const* abs_time,
+        char const* description, error_code& ec)
+    {
+        for (std::size_t k = 0; k != mutex_max_spin_count; ++k)
+        {
+            std::uintptr_t expected = state_.load(std::memory_order_relaxed);
+            if (expected == 0)
+            {
+                if (state_.compare_exchange_weak(expected, self,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+                continue;
+            }
+
+            // don't spin if others are waiting already
+            if (expected & has_waiters)
+            {
+                break;
+            }
+
+            HPX_SMT_PAUSE;
+        }
+
+        std::unique_lock<mutex_type> l(mtx_);
+        while (true)
+        {
+            std::uintptr_t expected = state_.load(std::memory_order_relaxed);
+            if ((expected & ~has_waiters) == 0)
+            {
+                // take over the mutex, keep the flag set if other threads
+                // are still waiting
+                std::uintptr_t const desired =
+                    self | (cond_.empty(l) ? 0 : has_waiters);
+                if (state_.compare_exchange_weak(expected, desired,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+                continue;
+            }
+
+            // make sure the owner will wake us up, this is done while
+            // holding the lock protecting the queue of waiting threads
+            if (!(expected & has_waiters) &&
+                !state_.compare_exchange_weak(expected,
+                    expected | has_waiters, std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            if (abs_time == nullptr)
+            {
+                cond_.wait(l, description, ec);
+                if (!ec)
+                {
+                    continue;
+                }
+            }
+            else if (cond_.wait_until(l, *abs_time, description, ec) !=
+                    threads::thread_restart_state::timeout &&
+                !ec)
+            {
+                continue;
+            }
+
+            // give up, reset the flag if there is nobody else waiting
+            if (cond_.empty(l))
+            {
+                state_.fetch_and(~has_waiters, std::memory_order_relaxed);
+            }
+            return false;
+        }
     }
 
     bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
@@ -73,18 +169,17 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        if (owner_id_ != threads::invalid_thread_id)
+        std::uintptr_t expected = 0;
+        if (!state_.compare_exchange_strong(expected, get_self_state(),
+                std::memory_order_acquire, std::memory_order_relaxed))
         {
             HPX_ITT_SYNC_CANCEL(this);
             return false;
         }
 
-        threads::thread_id_type self_id = threads::get_self_id();
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
         return true;
     }
 
@@ -95,19 +190,29 @@ namespace hpx {
         HPX_ITT_SYNC_RELEASING(this);
         // Unregister lock early as the lock guard below may suspend.
         util::unregister_lock(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type self_id = threads::get_self_id();
-        if (HPX_UNLIKELY(owner_id_ != self_id))
+        std::uintptr_t const self = get_self_state();
+        std::uintptr_t expected = self;
+        if (HPX_LIKELY(state_.compare_exchange_strong(
+                expected, 0, std::memory_order_release)))
+        {
+            HPX_ITT_SYNC_RELEASED(this);
+            return;
+        }
+
+        if (HPX_UNLIKELY((expected & ~has_waiters) != self))
         {
-            l.unlock();
             HPX_THROWS_IF(ec, lock_error, "mutex::unlock",
                 "The calling thread does not own the mutex");
             return;
         }
 
+        // there are suspended threads, wake up one of them (the flag is
+        // set again by the woken thread if others are still waiting)
+        std::unique_lock<mutex_type> l(mtx_);
+
         HPX_ITT_SYNC_RELEASED(this);
-        owner_id_ = threads::invalid_thread_id;
+        state_.store(0, std::memory_order_release);
 
         {
             util::ignore_while_checking il(&l);
@@ -127,31 +232,19 @@ namespace hpx {
 
     bool timed_mutex::try_lock_until(
         hpx::chrono::steady_time_point const& abs_time,
-        char const* /* description */, error_code& ec)
+        char const* description, error_code& ec)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type self_id = threads::get_self_id();
-        if (owner_id_ != threads::invalid_thread_id)
+        std::uintptr_t const self = get_self_state();
+        std::uintptr_t expected = 0;
+        if (!state_.compare_exchange_strong(expected, self,
+                std::memory_order_acquire, std::memory_order_relaxed))
         {
-            threads::thread_restart_state const reason =
-                cond_.wait_until(l, abs_time, ec);
-            if (ec)
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
-
-            if (reason == threads::thread_restart_state::timeout)    //-V110
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
-
-            if (owner_id_ != threads::invalid_thread_id)    //-V110
+            if ((expected & ~has_waiters) == self ||
+                !lock_slow(self, &abs_time, description, ec))
             {
                 HPX_ITT_SYNC_CANCEL(this);
                 return false;
@@ -160,7 +253,6 @@ namespace hpx {
 
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
         return true;
     }
 }    // namespace hpx
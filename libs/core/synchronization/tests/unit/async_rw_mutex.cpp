@@ -19,6 +19,7 @@
 #include <vector>
 
 using hpx::execution::experimental::execute;
+using hpx::execution::experimental::make_future;
 using hpx::execution::experimental::then;
 using hpx::execution::experimental::thread_pool_scheduler;
 using hpx::execution::experimental::transfer;
@@ -192,6 +193,37 @@ void test_moved(async_rw_mutex<ReadWriteT, ReadT> rwm)
     HPX_TEST(called);
 }
 
+template <typename ReadWriteT, typename ReadT = ReadWriteT>
+void test_read_many(async_rw_mutex<ReadWriteT, ReadT> rwm)
+{
+    using read_access_type =
+        typename async_rw_mutex<ReadWriteT, ReadT>::read_access_type;
+
+    // All read-only accesses of a batch are granted at the same time
+    constexpr std::size_t num_readers = 5;
+    auto senders = rwm.read_many(num_readers);
+    HPX_TEST_EQ(senders.size(), num_readers);
+
+    std::vector<read_access_type> accesses;
+    for (auto sender : senders)
+    {
+        accesses.push_back(sync_wait(std::move(sender)));
+    }
+
+    // The next read-write access is granted once all read-only accesses of
+    // the batch have been released
+    std::atomic<bool> called{false};
+    auto f = make_future(rwm.readwrite() | then([&](auto) { called = true; }));
+    HPX_TEST(!called);
+
+    accesses.pop_back();
+    HPX_TEST(!called);
+
+    accesses.clear();
+    f.get();
+    HPX_TEST(called);
+}
+
 template <typename ReadWriteT, typename ReadT = ReadWriteT>
 void test_multiple_accesses(
     async_rw_mutex<ReadWriteT, ReadT> rwm, std::size_t iterations)
@@ -273,6 +305,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_moved(async_rw_mutex<std::size_t>{0});
     test_moved(async_rw_mutex<mytype, mytype_base>{mytype{}});
 
+    test_read_many(async_rw_mutex<void>{});
+    test_read_many(async_rw_mutex<std::size_t>{0});
+    test_read_many(async_rw_mutex<mytype, mytype_base>{mytype{}});
+
     std::size_t iterations = 100;
     test_multiple_accesses(async_rw_mutex<void>{}, iterations);
     test_multiple_accesses(async_rw_mutex<std::size_t>{0}, iterations);
@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -206,6 +207,71 @@ void test_barrier_oncomplete_split()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_barrier_os_threads()
+{
+    constexpr std::size_t threads = 8;
+    constexpr std::size_t iterations = 100;
+
+    // mix OS threads and HPX threads waiting on the same barrier
+    std::shared_ptr<hpx::barrier<oncomplete>> b =
+        std::make_shared<hpx::barrier<oncomplete>>(2 * threads + 1);
+
+    c1 = 0;
+    complete = 0;
+
+    std::vector<std::thread> os_threads;
+    os_threads.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        os_threads.emplace_back([b]() {
+            for (std::size_t j = 0; j != iterations; ++j)
+            {
+                ++c1;
+                if (j % 2 == 0)
+                {
+                    b->arrive_and_wait();
+                }
+                else
+                {
+                    b->wait(b->arrive());
+                }
+
+                // no thread may leave the barrier before its phase has
+                // completed
+                HPX_TEST_LTE(j + 1, complete.load());
+            }
+        });
+    }
+
+    std::vector<hpx::future<void>> results;
+    results.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        results.push_back(hpx::async([b]() {
+            for (std::size_t j = 0; j != iterations; ++j)
+            {
+                ++c1;
+                b->arrive_and_wait();
+            }
+        }));
+    }
+
+    for (std::size_t j = 0; j != iterations; ++j)
+    {
+        b->arrive_and_wait();
+    }
+
+    hpx::wait_all(results);
+    for (auto& t : os_threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(2 * threads * iterations, c1);
+    HPX_TEST_EQ(complete, iterations);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -215,6 +281,8 @@ int hpx_main()
     test_barrier_empty_oncomplete_split();
     test_barrier_oncomplete_split();
 
+    test_barrier_os_threads();
+
     return hpx::local::finalize();
 }
 
@@ -0,0 +1,208 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the sender based operations exposed by the bounded channels.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+#include <hpx/synchronization/channel_mpsc.hpp>
+#include <hpx/synchronization/channel_spsc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using hpx::this_thread::experimental::sync_wait;
+
+constexpr int num_values = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void test_async_get_set()
+{
+    // a small capacity forces both ends to suspend frequently
+    Channel c(std::size_t(2));
+
+    hpx::future<void> producer = hpx::async([&c]() {
+        for (int i = 0; i != num_values; ++i)
+        {
+            sync_wait(c.async_set(int(i)));
+        }
+    });
+
+    std::int64_t sum = 0;
+    for (int i = 0; i != num_values; ++i)
+    {
+        int value = sync_wait(c.async_get());
+        HPX_TEST_EQ(value, i);
+        sum += value;
+    }
+    producer.get();
+
+    HPX_TEST_EQ(sum, std::int64_t(num_values - 1) * num_values / 2);
+}
+
+template <typename Channel>
+void test_async_batch()
+{
+    Channel c(std::size_t(16));
+
+    std::vector<int> input(num_values);
+    std::iota(input.begin(), input.end(), 0);
+
+    hpx::future<std::size_t> producer = hpx::async([&]() {
+        return sync_wait(c.async_set_n(input.begin(), input.size()));
+    });
+
+    std::vector<int> output(num_values);
+    HPX_TEST_EQ(sync_wait(c.async_get_n(output.begin(), output.size())),
+        output.size());
+    HPX_TEST_EQ(producer.get(), input.size());
+
+    HPX_TEST(input == output);
+}
+
+template <typename Channel>
+void test_async_batch_move_only()
+{
+    Channel c(std::size_t(16));
+
+    std::vector<std::unique_ptr<int>> input;
+    for (int i = 0; i != num_values; ++i)
+    {
+        input.push_back(std::make_unique<int>(i));
+    }
+
+    hpx::future<std::size_t> producer = hpx::async([&]() {
+        return sync_wait(c.async_set_n(input.begin(), input.size()));
+    });
+
+    std::vector<std::unique_ptr<int>> output(num_values);
+    HPX_TEST_EQ(sync_wait(c.async_get_n(output.begin(), output.size())),
+        output.size());
+    HPX_TEST_EQ(producer.get(), input.size());
+
+    for (int i = 0; i != num_values; ++i)
+    {
+        HPX_TEST(!input[i]);
+        HPX_TEST_EQ(*output[i], i);
+    }
+}
+
+// Both ends keep receiving from one channel and sending to the other one.
+// Every send resumes the waiting receiver of the other end, which sends in
+// turn, thus the completions would nest without bounds if the waiters were
+// always resumed directly.
+template <typename Channel>
+struct ping_pong
+{
+    ping_pong(Channel& in, Channel& out, int first)
+      : in_(in)
+      , out_(out)
+      , expected_(first)
+    {
+    }
+
+    void receive(int remaining)
+    {
+        namespace ex = hpx::execution::experimental;
+
+        ex::start_detached(
+            in_.async_get() | ex::then([this, remaining](int value) {
+                HPX_TEST_EQ(value, expected_);
+                expected_ += 2;
+
+                // the next receive is pending before the other end is
+                // resumed
+                if (remaining != 1)
+                {
+                    receive(remaining - 1);
+                }
+
+                HPX_TEST(out_.set(value + 1));
+
+                if (remaining == 1)
+                {
+                    done_.set_value();
+                }
+            }));
+    }
+
+    Channel& in_;
+    Channel& out_;
+    int expected_;
+    hpx::promise<void> done_;
+};
+
+template <typename Channel>
+void test_async_ping_pong()
+{
+    Channel pings(std::size_t(2));
+    Channel pongs(std::size_t(2));
+
+    ping_pong<Channel> ping(pings, pongs, 0);
+    ping_pong<Channel> pong(pongs, pings, 1);
+
+    hpx::future<void> ping_done = ping.done_.get_future();
+    hpx::future<void> pong_done = pong.done_.get_future();
+
+    ping.receive(num_values);
+    pong.receive(num_values);
+
+    HPX_TEST(pings.set(0));
+
+    ping_done.get();
+    pong_done.get();
+}
+
+template <typename Channel>
+void test_async_close()
+{
+    Channel c(std::size_t(1));
+
+    // the pending receive is canceled by closing the channel
+    hpx::future<int> f =
+        hpx::execution::experimental::make_future(c.async_get());
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST_EQ(c.close(), std::size_t(1));
+    HPX_TEST_THROW(f.get(), hpx::exception);
+
+    // operations started on a closed channel complete immediately
+    HPX_TEST_THROW(sync_wait(c.async_set(42)), hpx::exception);
+}
+
+template <template <typename> typename Channel>
+void test_channel()
+{
+    test_async_get_set<Channel<int>>();
+    test_async_batch<Channel<int>>();
+    test_async_batch_move_only<Channel<std::unique_ptr<int>>>();
+    test_async_ping_pong<Channel<int>>();
+    test_async_close<Channel<int>>();
+}
+
+int hpx_main()
+{
+    test_channel<hpx::lcos::local::channel_spsc>();
+    test_channel<hpx::lcos::local::channel_mpsc>();
+    test_channel<hpx::lcos::local::channel_mpmc>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
@@ -12,6 +12,8 @@
 #include <atomic>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #define NUM_THREADS std::size_t(100)
@@ -100,6 +102,66 @@ int hpx_main()
         HPX_TEST_EQ(num_threads.load(), NUM_THREADS);
     }
 
+    // OS threads and HPX threads waiting on the same latch
+    {
+        num_threads.store(0);
+
+        constexpr std::size_t num_os_threads = 4;
+
+        hpx::latch l(2 * num_os_threads + 1);
+
+        std::vector<std::thread> os_threads;
+        for (std::size_t i = 0; i != num_os_threads; ++i)
+        {
+            os_threads.emplace_back(&test_arrive_and_wait, std::ref(l));
+        }
+
+        std::vector<hpx::future<void>> results;
+        for (std::size_t i = 0; i != num_os_threads; ++i)
+        {
+            results.push_back(hpx::async(&test_arrive_and_wait, std::ref(l)));
+        }
+
+        // an OS thread blocking in wait only
+        std::thread waiter([&l]() {
+            l.wait();
+            HPX_TEST(l.try_wait());
+        });
+
+        l.arrive_and_wait();
+
+        hpx::wait_all(results);
+        for (auto& t : os_threads)
+        {
+            t.join();
+        }
+        waiter.join();
+
+        HPX_TEST(l.try_wait());
+        HPX_TEST_EQ(num_threads.load(), 2 * num_os_threads);
+    }
+
+    // the latch may be destroyed as soon as wait() has returned, while the
+    // releasing thread may still be about to return from count_down()
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        auto l = std::make_unique<hpx::latch>(1);
+        hpx::apply([&l]() { l->count_down(1); });
+        l->wait();
+        l.reset();
+    }
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        auto l = std::make_unique<hpx::latch>(1);
+        std::thread waiter([&l]() {
+            l->wait();
+            l.reset();
+        });
+        hpx::apply([&l]() { l->count_down(1); });
+        waiter.join();
+    }
+
     HPX_TEST_EQ(hpx::local::finalize(), 0);
     return 0;
 }
@@ -16,6 +16,7 @@
 #include <hpx/synchronization/mutex.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -259,6 +260,50 @@ struct test_timedlock
     }
 };
 
+template <typename M>
+struct test_contention
+{
+    typedef M mutex_type;
+
+    void operator()()
+    {
+        constexpr std::size_t num_threads = 16;
+        constexpr std::size_t num_iterations = 1000;
+
+        mutex_type mutex;
+        std::size_t counter = 0;
+
+        std::vector<hpx::thread> threads;
+        threads.reserve(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            threads.emplace_back([&, i]() {
+                for (std::size_t j = 0; j != num_iterations; ++j)
+                {
+                    std::lock_guard<mutex_type> l(mutex);
+                    ++counter;
+
+                    // suspend while holding the lock every now and then,
+                    // forcing the other threads to stop spinning
+                    if ((i + j) % 64 == 0)
+                    {
+                        hpx::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        HPX_TEST_EQ(counter, num_threads * num_iterations);
+        HPX_TEST(mutex.try_lock());
+        mutex.unlock();
+    }
+};
+
 template <typename M>
 struct test_recursive_lock
 {
@@ -277,6 +322,7 @@ void test_mutex()
 {
     test_lock<hpx::mutex>()();
     test_trylock<hpx::mutex>()();
+    test_contention<hpx::mutex>()();
 }
 
 void test_timed_mutex()
@@ -284,6 +330,7 @@ void test_timed_mutex()
     test_lock<hpx::timed_mutex>()();
     test_trylock<hpx::timed_mutex>()();
     test_timedlock<hpx::timed_mutex>()();
+    test_contention<hpx::timed_mutex>()();
 }
 
 //void test_recursive_mutex()
@@ -14,6 +14,7 @@
 
 #include <hpx/modules/testing.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <shared_mutex>
@@ -346,6 +347,50 @@ void test_unlocking_last_reader_only_unblocks_one_writer()
         unblocked_count_mutex, max_simultaneous_writers, 1u);
 }
 
+// readers may release the lock on a different core than they acquired it on
+void test_read_mostly_with_migrating_readers()
+{
+    unsigned const number_of_threads = 16;
+    unsigned const number_of_iterations = 1000;
+
+    hpx::shared_mutex rw_mutex;
+    std::atomic<unsigned> active_readers(0);
+    std::atomic<bool> writer_active(false);
+    unsigned writes = 0;
+
+    std::vector<hpx::future<void>> threads;
+    for (unsigned i = 0; i != number_of_threads; ++i)
+    {
+        threads.push_back(hpx::async([&, i]() {
+            for (unsigned j = 0; j != number_of_iterations; ++j)
+            {
+                if ((i + j) % 100 == 0)
+                {
+                    std::unique_lock<hpx::shared_mutex> l(rw_mutex);
+                    HPX_TEST_EQ(active_readers.load(), 0u);
+                    HPX_TEST(!writer_active.exchange(true));
+                    ++writes;
+                    writer_active.store(false);
+                }
+                else
+                {
+                    std::shared_lock<hpx::shared_mutex> l(rw_mutex);
+                    ++active_readers;
+                    HPX_TEST(!writer_active.load());
+                    hpx::this_thread::yield();
+                    HPX_TEST(!writer_active.load());
+                    --active_readers;
+                }
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(writes, number_of_threads * number_of_iterations / 100);
+    HPX_TEST(rw_mutex.try_lock());
+    rw_mutex.unlock();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main()
 {
@@ -354,6 +399,7 @@ int hpx_main()
     test_reader_blocks_writer();
     test_unlocking_writer_unblocks_all_readers();
     test_unlocking_last_reader_only_unblocks_one_writer();
+    test_read_mostly_with_migrating_readers();
 
     return hpx::local::finalize();
 }
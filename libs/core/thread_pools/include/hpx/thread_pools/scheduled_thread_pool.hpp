@@ -77,6 +77,9 @@ namespace hpx { namespace threads { namespace detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -282,6 +285,29 @@ namespace hpx { namespace threads { namespace detail {
 
         std::int64_t get_idle_loop_count(std::size_t num, bool reset) override;
         std::int64_t get_busy_loop_count(std::size_t num, bool reset) override;
+
+        std::int64_t get_idle_park_count(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_count(num, reset);
+        }
+        std::int64_t get_idle_wake_count(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_wake_count(num, reset);
+        }
+        std::int64_t get_idle_park_time(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_time(num, reset);
+        }
+        std::int64_t get_idle_wake_latency(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_wake_latency(num, reset);
+        }
+        std::int64_t get_deadline_miss_count(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_deadline_miss_count(num, reset);
+        }
         std::int64_t get_scheduler_utilization() const override;
 
     protected:
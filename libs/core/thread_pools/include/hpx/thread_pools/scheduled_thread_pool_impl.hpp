@@ -233,7 +233,7 @@ namespace hpx { namespace threads { namespace detail {
             sched_->Scheduler::set_all_states_at_least(hpx::state::stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(std::size_t(-1));
+            sched_->Scheduler::wake_all_idle_workers();
 
             if (blocking)
             {
@@ -246,7 +246,7 @@ namespace hpx { namespace threads { namespace detail {
                     // make sure no OS thread is waiting
                     LTM_(info).format("stop: {} notify_all", id_.name());
 
-                    sched_->Scheduler::do_some_work(std::size_t(-1));
+                    sched_->Scheduler::wake_all_idle_workers();
 
                     LTM_(info).format("stop: {} join:{}", id_.name(), i);
 
@@ -642,6 +642,27 @@ namespace hpx { namespace threads { namespace detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 &&
+            !sched_->Scheduler::is_state(hpx::state::running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -1970,6 +1991,9 @@ namespace hpx { namespace threads { namespace detail {
         hpx::state expected = hpx::state::running;
         state.compare_exchange_strong(expected, hpx::state::pre_sleep);
 
+        // make sure the virtual core is not parked waiting for work
+        sched_->Scheduler::wake_idle_worker(virt_core);
+
         l.unlock();
 
         HPX_ASSERT(expected == hpx::state::running ||
@@ -625,6 +625,9 @@ namespace hpx { namespace threads { namespace detail {
         {
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
 
+            // wake up threads whose timed suspension has expired
+            scheduler.SchedulingPolicy::process_timers();
+
             // Get the next HPX thread from the queue
             bool running = this_state.load(std::memory_order_relaxed) <
                 hpx::state::pre_sleep;
@@ -961,6 +964,14 @@ namespace hpx { namespace threads { namespace detail {
                     added = std::size_t(-1);
                 }
 
+                // back off gradually (spin, pause, yield) while no new work
+                // shows up, the scheduler thread will eventually be parked
+                // by the outer callback
+                if (running && added == 0)
+                {
+                    scheduler.SchedulingPolicy::idle_backoff(idle_loop_count);
+                }
+
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
                 // do background work in parcel layer and in agas
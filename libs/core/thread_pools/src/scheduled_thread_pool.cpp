@@ -5,8 +5,10 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/schedulers/deadline_queue_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/local_workrequesting_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_queue_scheduler.hpp>
@@ -33,6 +35,13 @@ template class HPX_CORE_EXPORT
     hpx::threads::policies::static_priority_queue_scheduler<>;
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::static_priority_queue_scheduler<>>;
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev>>;
+
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
 template class HPX_CORE_EXPORT
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
@@ -57,6 +66,27 @@ template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
         hpx::threads::policies::lockfree_abp_lifo>>;
 #endif
 
+template class HPX_CORE_EXPORT hpx::threads::policies::local_queue_scheduler<
+    std::mutex, hpx::threads::policies::deadline_heap>;
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::deadline_queue_scheduler<>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::deadline_queue_scheduler<>>;
+
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_workrequesting_scheduler<>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_fifo>>;
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_lifo>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_lifo>>;
+#endif
+
 template class HPX_CORE_EXPORT
     hpx::threads::policies::shared_priority_queue_scheduler<>;
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
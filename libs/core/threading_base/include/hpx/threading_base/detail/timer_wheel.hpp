@@ -0,0 +1,150 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hierarchical hashed timer wheel keeping track of the threads to wake
+    /// up at a given point in time. Time is measured in ticks of one
+    /// microsecond. The wheel consists of 11 levels of 64 slots each, every
+    /// level covering a 64 times larger range of ticks than the level below,
+    /// which is sufficient to represent any point in time without an overflow
+    /// list. A timer is stored on the level of the most significant 6 bit
+    /// digit in which its expiration tick differs from the current tick of
+    /// the wheel, it is moved down to lower levels once the wheel reaches
+    /// its slot. Inserting and canceling timers are O(1) operations, timers
+    /// never expire before their expiration time.
+    ///
+    /// The timer entries are provided by the caller (they are usually kept
+    /// on the stack of the waiting thread), the wheel does not allocate any
+    /// memory.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        class entry
+        {
+        public:
+            entry() noexcept
+              : prev_(nullptr)
+              , next_(nullptr)
+              , expiry_(0)
+              , list_(no_list)
+              , priority_(thread_priority::default_)
+              , retry_on_active_(true)
+            {
+            }
+
+            HPX_NON_COPYABLE(entry);
+
+        private:
+            friend class timer_wheel;
+
+            entry* prev_;
+            entry* next_;
+            std::uint64_t expiry_;
+            std::uint16_t list_;
+            thread_priority priority_;
+            bool retry_on_active_;
+            thread_id_ref_type thrd_;
+        };
+
+        /// The thread of an expired timer and how it has to be woken up.
+        struct expired_timer
+        {
+            thread_id_ref_type thrd;
+            thread_priority priority = thread_priority::default_;
+            bool retry_on_active = true;
+        };
+
+        timer_wheel() noexcept;
+
+        HPX_NON_COPYABLE(timer_wheel);
+
+        /// Arm the timer \a e to hand out \a thrd once \a abs_time has been
+        /// reached. The thread is to be woken up using the given \a priority
+        /// and \a retry_on_active. Returns false (without arming the timer)
+        /// if \a abs_time has already been reached by the wheel. \a earliest
+        /// is set to true if the new timer expires before all other armed
+        /// timers.
+        bool add(entry& e, clock_type::time_point abs_time,
+            thread_id_ref_type thrd, thread_priority priority,
+            bool retry_on_active, bool& earliest);
+
+        /// Disarm the timer \a e. Returns false if the timer has already been
+        /// handed out by \a expire (or if it was never armed).
+        bool cancel(entry& e);
+
+        /// Advance the wheel to \a now and hand out the threads of at most
+        /// \a max expired timers. Returns the number of entries stored in
+        /// \a expired. This function does not wait for other threads
+        /// currently operating on the wheel and returns zero instead.
+        std::size_t expire(clock_type::time_point now, expired_timer* expired,
+            std::size_t max);
+
+        /// Return whether no timers are armed.
+        bool empty() const noexcept
+        {
+            return next_expiry_.load(std::memory_order_relaxed) ==
+                (std::numeric_limits<std::uint64_t>::max)();
+        }
+
+        /// Return a point in time not later than the expiration of the next
+        /// timer, clock_type::time_point::max() if no timers are armed.
+        clock_type::time_point next_expiry() const noexcept;
+
+    private:
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t levels = (64 + slot_bits - 1) / slot_bits;
+
+        static constexpr std::uint16_t no_list = std::uint16_t(-1);
+        static constexpr std::uint16_t expired_list = levels * slots;
+
+        void link(entry* e, std::uint16_t list) noexcept;
+        void unlink(entry* e) noexcept;
+
+        void insert(entry* e) noexcept;
+        std::uint64_t next_tick(std::size_t level) const noexcept;
+        void advance(std::uint64_t tick) noexcept;
+        void update_next_expiry() noexcept;
+
+        using mutex_type = hpx::util::detail::spinlock;
+
+        mutex_type mtx_;
+        std::uint64_t current_;
+
+        // lower bound of the next expiration tick, max() if empty
+        std::atomic<std::uint64_t> next_expiry_;
+
+        // one bit per non-empty slot on each of the levels
+        std::array<std::uint64_t, levels> occupied_;
+
+        // heads of the timer lists of all slots and of the list of expired
+        // timers (the last element)
+        std::array<entry*, levels * slots + 1> heads_;
+        entry* expired_tail_;
+    };
+}}}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
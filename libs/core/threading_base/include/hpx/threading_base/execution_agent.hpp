@@ -66,6 +66,38 @@ namespace hpx { namespace threads {
 
         execution_context context_;
     };
+
+    // Stackless threads run on the stack of the worker thread executing them
+    // and can't be suspended. This agent is installed while such a thread
+    // runs, it turns any attempt to suspend into an exception instead of
+    // blocking the worker thread (which may be the only one able to make the
+    // awaited work progress).
+    struct HPX_CORE_EXPORT stackless_execution_agent
+      : hpx::execution_base::agent_base
+    {
+        explicit stackless_execution_agent(thread_id_type id) noexcept;
+
+        std::string description() const override;
+
+        execution_context const& context() const override
+        {
+            return context_;
+        }
+
+        void yield(char const* desc) override;
+        void yield_k(std::size_t k, char const* desc) override;
+        void suspend(char const* desc) override;
+        void resume(char const* desc) override;
+        void abort(char const* desc) override;
+        void sleep_for(hpx::chrono::steady_duration const& sleep_duration,
+            char const* desc) override;
+        void sleep_until(hpx::chrono::steady_time_point const& sleep_time,
+            char const* desc) override;
+
+    private:
+        thread_id_type id_;
+        execution_context context_;
+    };
 }}    // namespace hpx::threads
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace threads {
     ///////////////////////////////////////////////////////////////////////////
@@ -209,6 +210,55 @@ namespace hpx { namespace threads {
     {
         return register_work(data, detail::get_self_or_default_pool(), ec);
     }
+
+    /// \brief Create a batch of new work items using the given data.
+    ///
+    /// All work items are handed to the scheduler of the given thread pool
+    /// at once. Consecutive work items sharing the same scheduling hint are
+    /// pushed to their target queue in one go and only one idle worker thread
+    /// is woken up for each of those runs.
+    ///
+    /// \param data       [in] The data to use for creating the threads. The
+    ///                   elements are left in a moved-from state.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    inline void register_work_bulk(std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (auto& d : data)
+        {
+            d.run_now = false;
+        }
+        pool->create_work_bulk(data.data(), data.size(), ec);
+    }
+
+    /// \brief Create a batch of new work items using the given data on the
+    ///        same thread pool as the calling thread, or on the default
+    ///        thread pool if not on an HPX thread.
+    ///
+    /// \param data       [in] The data to use for creating the threads. The
+    ///                   elements are left in a moved-from state.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    inline void register_work_bulk(
+        std::vector<threads::thread_init_data>& data, error_code& ec = throws)
+    {
+        register_work_bulk(data, detail::get_self_or_default_pool(), ec);
+    }
 }}    // namespace hpx::threads
 
 /// \endcond
@@ -12,6 +12,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +25,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -31,6 +33,7 @@
 #include <iosfwd>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -93,13 +96,100 @@ namespace hpx { namespace threads { namespace policies {
             return description_;
         }
 
+        /// This function gets called by the scheduling loop after the
+        /// scheduler thread \a num_thread has been idle for a while. If idle
+        /// backoff is enabled, the calling OS thread is parked until new work
+        /// is scheduled for it or until the (exponentially growing) backoff
+        /// time has elapsed.
         void idle_callback(std::size_t num_thread);
 
+        /// This function gets called by the scheduling loop for each
+        /// iteration not finding any work. If idle backoff is enabled, the
+        /// calling thread first keeps spinning, then starts issuing pause
+        /// instructions, and finally yields its core to the operating system
+        /// until it is eventually parked by \a idle_callback.
+        void idle_backoff(std::int64_t idle_loop_count) const
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            if (idle_loop_count <= thread_queue_init_.idle_backoff_spin_count_ ||
+                !(mode_.data_.load(std::memory_order_relaxed) &
+                    policies::scheduler_mode::enable_idle_backoff))
+            {
+                return;
+            }
+
+            if (idle_loop_count <= thread_queue_init_.idle_backoff_spin_count_ +
+                    thread_queue_init_.idle_backoff_pause_count_)
+            {
+                HPX_SMT_PAUSE;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+#else
+            (void) idle_loop_count;
+#endif
+        }
+
+        /// This function gets called by the schedulers whenever new work has
+        /// been added to the queues of the scheduler thread \a num_thread,
+        /// waking it up if it is currently parked.
+        void wake_idle_worker(std::size_t num_thread)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            if (mode_.data_.load(std::memory_order_relaxed) &
+                policies::scheduler_mode::enable_idle_backoff)
+            {
+                // Pairs with the fence issued by a parking thread. Either the
+                // parking thread sees the new work or we see that it is
+                // parked.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (parked_workers_.data_.load(std::memory_order_relaxed) != 0)
+                {
+                    unpark_worker(num_thread);
+                }
+            }
+#else
+            (void) num_thread;
+#endif
+        }
+
+        /// Wake up all currently parked scheduler threads.
+        void wake_all_idle_workers();
+
+        /// The timer wheel holding the timed suspensions of the threads
+        /// managed by this scheduler.
+        threads::detail::timer_wheel& get_timer_wheel() noexcept
+        {
+            return timers_;
+        }
+
+        /// This function gets called by the scheduling loop, it wakes up the
+        /// threads whose timers have expired. Returns the number of threads
+        /// woken up.
+        std::size_t process_timers();
+
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
         /// possibly idling OS threads
         void do_some_work(std::size_t);
 
+        // statistics of parked scheduler threads (times are in nanoseconds)
+        std::int64_t get_idle_park_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_wake_count(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_park_time(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_wake_latency(
+            std::size_t num_thread, bool reset);
+
+        // number of times a thread was run only after its deadline had
+        // passed, maintained by deadline aware schedulers only
+        virtual std::int64_t get_deadline_miss_count(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
@@ -222,6 +312,12 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create a batch of staged threads. The default implementation
+        // creates the threads one by one, schedulers may override this to
+        // enqueue all threads targeting the same queue at once.
+        virtual void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_id_ref_type& thrd, bool enable_stealing) = 0;
 
@@ -374,17 +470,41 @@ namespace hpx { namespace threads { namespace policies {
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking scheduler threads on idle queues
         struct idle_backoff_data
         {
+            // one while the scheduler thread is parked, zero otherwise (this
+            // is used as the futex word on Linux)
+            std::atomic<std::uint32_t> parked_;
             std::uint32_t wait_count_;
             double max_idle_backoff_time_;
+
+            // time (in nanoseconds) the wake-up request was issued at
+            std::atomic<std::int64_t> wake_request_time_;
+
+            std::atomic<std::int64_t> park_count_;
+            std::atomic<std::int64_t> wake_count_;
+            std::atomic<std::int64_t> park_time_;
+            std::atomic<std::int64_t> wake_latency_;
+
+#if !(defined(__linux) || defined(linux) || defined(__linux__))
+            std::mutex mtx_;
+            std::condition_variable cond_;
+#endif
         };
+
+        bool park_worker(
+            std::size_t num_thread, std::chrono::nanoseconds period);
+        void unpark_worker(std::size_t num_thread);
+        bool unpark_worker(idle_backoff_data& data);
+
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+        util::cache_line_data<std::atomic<std::int64_t>> parked_workers_;
 #endif
 
+        // timed suspensions of threads, driven by the scheduling loop
+        threads::detail::timer_wheel timers_;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
@@ -28,6 +28,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <forward_list>
@@ -464,6 +465,18 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        // the absolute point in time this thread should have completed its
+        // execution by, no_deadline() if none was given
+        std::chrono::steady_clock::time_point get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(
+            std::chrono::steady_clock::time_point deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -547,6 +560,13 @@ namespace hpx { namespace threads {
             return *static_cast<ThreadQueue*>(queue_);
         }
 
+        /// Associate a recycled thread object with a different thread queue,
+        /// may be called only while the thread object is not in use.
+        void set_queue(void* queue) noexcept
+        {
+            queue_ = queue;
+        }
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -640,6 +660,7 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::chrono::steady_clock::time_point deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
@@ -757,7 +778,8 @@ namespace hpx { namespace threads {
     {
         if (is_stackless())
         {
-            return static_cast<thread_data_stackless*>(this)->call();
+            return static_cast<thread_data_stackless*>(this)->call(
+                agent_storage);
         }
         return static_cast<thread_data_stackful*>(this)->call(agent_storage);
     }
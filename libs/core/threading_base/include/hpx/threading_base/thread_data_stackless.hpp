@@ -15,6 +15,7 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -55,11 +56,15 @@ namespace hpx { namespace threads {
         static util::internal_allocator<thread_data_stackless> thread_alloc_;
 
     public:
-        stackless_coroutine_type::result_type call()
+        stackless_coroutine_type::result_type call(
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage)
         {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+            hpx::execution_base::this_thread::reset_agent ctx(
+                agent_storage, agent_);
             return coroutine_(this->thread_data::set_state_ex(
                 thread_restart_state::signaled));
         }
@@ -136,6 +141,7 @@ namespace hpx { namespace threads {
             std::ptrdiff_t stacksize, thread_id_addref addref)
           : thread_data(init_data, queue, stacksize, true, addref)
           , coroutine_(HPX_MOVE(init_data.func), thread_id_type(this_()))
+          , agent_(thread_id_type(this_()))
         {
             HPX_ASSERT(coroutine_.is_ready());
         }
@@ -154,6 +160,7 @@ namespace hpx { namespace threads {
 
     private:
         stackless_coroutine_type coroutine_;
+        stackless_execution_agent agent_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
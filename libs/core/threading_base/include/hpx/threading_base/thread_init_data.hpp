@@ -16,12 +16,20 @@
 #endif
 #include <hpx/type_support/unused.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
 
 namespace hpx { namespace threads {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline of threads which were not given an explicit deadline.
+    constexpr std::chrono::steady_clock::time_point no_deadline() noexcept
+    {
+        return (std::chrono::steady_clock::time_point::max)();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     class thread_init_data
     {
@@ -44,6 +52,7 @@ namespace hpx { namespace threads {
           , stacksize(thread_stacksize::default_)
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
+          , deadline(no_deadline())
           , scheduler_base(nullptr)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -62,6 +71,7 @@ namespace hpx { namespace threads {
             stacksize = rhs.stacksize;
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
+            deadline = rhs.deadline;
             scheduler_base = rhs.scheduler_base;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
@@ -100,6 +110,7 @@ namespace hpx { namespace threads {
           , stacksize(rhs.stacksize)
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
+          , deadline(rhs.deadline)
           , scheduler_base(rhs.scheduler_base)
         {
         }
@@ -133,6 +144,7 @@ namespace hpx { namespace threads {
           , stacksize(stacksize_)
           , initial_state(initial_state_)
           , run_now(run_now_)
+          , deadline(no_deadline())
           , scheduler_base(scheduler_base_)
         {
             HPX_UNUSED(desc);
@@ -167,6 +179,10 @@ namespace hpx { namespace threads {
         thread_schedule_state initial_state;
         bool run_now;
 
+        // The absolute point in time the new thread should have completed
+        // its execution by. It is used by deadline aware schedulers only.
+        std::chrono::steady_clock::time_point deadline;
+
         policies::scheduler_base* scheduler_base;
     };
 }}    // namespace hpx::threads
@@ -188,6 +188,8 @@ namespace hpx { namespace threads {
             thread_init_data& data, thread_id_ref_type& id, error_code& ec) = 0;
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -445,6 +447,35 @@ namespace hpx { namespace threads {
         virtual std::int64_t get_busy_loop_count(
             std::size_t num, bool reset) = 0;
 
+        // statistics of parked (idle) worker threads
+        virtual std::int64_t get_idle_park_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_wake_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_park_time(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_wake_latency(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // number of threads run only after their deadline had passed
+        virtual std::int64_t get_deadline_miss_count(
+            std::size_t /*num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         virtual bool enumerate_threads(
             hpx::function<bool(thread_id_type)> const& /*f*/,
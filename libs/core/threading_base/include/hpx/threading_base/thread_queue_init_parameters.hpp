@@ -39,7 +39,11 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE)
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t idle_backoff_spin_count = std::int64_t(
+                HPX_IDLE_BACKOFF_SPIN_COUNT),
+            std::int64_t idle_backoff_pause_count = std::int64_t(
+                HPX_IDLE_BACKOFF_PAUSE_COUNT))
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -55,6 +59,8 @@ namespace hpx { namespace threads { namespace policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , idle_backoff_spin_count_(idle_backoff_spin_count)
+          , idle_backoff_pause_count_(idle_backoff_pause_count)
         {
         }
 
@@ -73,5 +79,7 @@ namespace hpx { namespace threads { namespace policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t idle_backoff_spin_count_;
+        std::int64_t idle_backoff_pause_count_;
     };
 }}}    // namespace hpx::threads::policies
@@ -1,4 +1,4 @@
-//  Copyright (c) 2007-2021 Hartmut Kaiser
+//  Copyright (c) 2007-2022 Hartmut Kaiser
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -13,84 +13,125 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace hpx { namespace threads { namespace detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        case thread_schedule_state::pending:
-        case thread_schedule_state::pending_do_not_schedule:
-        case thread_schedule_state::pending_boost:
-        case thread_schedule_state::suspended:
-            break;
+    namespace {
 
-        default:
+        bool verify_work(threads::thread_init_data const& data, error_code& ec)
         {
-            HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
-                "invalid initial state: {}", data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            case thread_schedule_state::pending:
+            case thread_schedule_state::pending_do_not_schedule:
+            case thread_schedule_state::pending_boost:
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
+                    "invalid initial state: {}", data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
-                "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
+                    "description is nullptr");
+                return false;
+            }
 #endif
+            return true;
+        }
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+        void log_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data const& data)
+        {
+            LTM_(info)
+                .format("create_work: pool({}), scheduler({}), "
+                        "initial_state({}), thread_priority({})",
+                    *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
+                ;
+        }
 
-        thread_self* self = get_self_ptr();
+        // The properties every new work item inherits from the thread
+        // creating it.
+        struct parent_data
+        {
+            explicit parent_data(thread_self* self)
+            {
+                if (self)
+                {
+#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
+                    parent_id = get_thread_id_data(self->get_thread_id());
+                    parent_phase = self->get_thread_phase();
+#endif
+                    high_recursive = thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority();
+                }
+            }
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
+            thread_id_type parent_id;
+            std::size_t parent_phase = 0;
+#endif
+            bool high_recursive = false;
+        };
+
+        void init_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, parent_data const& parent)
         {
-            if (self)
+#ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
+            if (nullptr == data.parent_id && parent.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                data.parent_id = parent.parent_id;
+                data.parent_phase = parent.parent_phase;
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
+            if (0 == data.parent_locality_id)
+                data.parent_locality_id = detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            // Pass critical priority from parent to child.
+            if (parent.high_recursive &&
+                data.priority == thread_priority::default_)
             {
                 data.priority = thread_priority::high_recursive;
             }
+
+            // create the new thread
+            if (data.priority == thread_priority::default_)
+                data.priority = thread_priority::normal;
+
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::boost == data.priority);
         }
+    }    // namespace
+
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!verify_work(data, ec))
+            return invalid_thread_id;
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
-            data.priority = thread_priority::normal;
+        log_work(scheduler, data);
 
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::boost == data.priority);
+        init_work(scheduler, data, parent_data(get_self_ptr()));
 
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
@@ -101,4 +142,45 @@ namespace hpx { namespace threads { namespace detail {
 
         return id;
     }
+
+    void create_work_bulk(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        if (count == 0)
+            return;
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (!verify_work(data[i], ec))
+                return;
+        }
+
+        log_work(scheduler, data[0]);
+        LTM_(info).format("create_work_bulk: {} work items", count);
+
+        parent_data const parent(get_self_ptr());
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            init_work(scheduler, data[i], parent);
+        }
+
+        scheduler->create_thread_bulk(data, count, ec);
+        if (ec)
+            return;
+
+        // Wake up one worker thread for each run of work items sharing the
+        // same hint instead of once per work item. The hints have to be
+        // captured after the threads were created as the scheduler may have
+        // adjusted them.
+        std::int16_t hint = data[0].schedulehint.hint;
+        scheduler->do_some_work(hint);
+        for (std::size_t i = 1; i != count; ++i)
+        {
+            if (data[i].schedulehint.hint != hint)
+            {
+                hint = data[i].schedulehint.hint;
+                scheduler->do_some_work(hint);
+            }
+        }
+    }
 }}}    // namespace hpx::threads::detail
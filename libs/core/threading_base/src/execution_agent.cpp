@@ -8,6 +8,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/errors/throw_exception.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/logging.hpp>
@@ -208,4 +209,58 @@ namespace hpx { namespace threads {
             thread_schedule_state::pending, statex, thread_priority::normal,
             thread_schedule_hint{}, false);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    stackless_execution_agent::stackless_execution_agent(
+        thread_id_type id) noexcept
+      : id_(id)
+    {
+    }
+
+    std::string stackless_execution_agent::description() const
+    {
+        return hpx::util::format(
+            "{}: {}", id_, get_thread_id_data(id_)->get_description());
+    }
+
+    // yielding and sleeping is done by the worker thread itself, the same
+    // way as for any other OS thread
+    void stackless_execution_agent::yield(const char* desc)
+    {
+        hpx::execution_base::detail::get_default_agent().yield(desc);
+    }
+
+    void stackless_execution_agent::yield_k(std::size_t k, const char* desc)
+    {
+        hpx::execution_base::detail::get_default_agent().yield_k(k, desc);
+    }
+
+    void stackless_execution_agent::suspend(const char* desc)
+    {
+        HPX_THROW_EXCEPTION(invalid_status, desc,
+            "thread({}) is stackless and can't be suspended, run work that "
+            "may block (wait for a future, lock a mutex, etc.) on a stackful "
+            "thread instead",
+            description());
+    }
+
+    // a stackless thread never suspends, any waiter registered by it has
+    // already been abandoned by the time it is resumed
+    void stackless_execution_agent::resume(const char* /* desc */) {}
+
+    void stackless_execution_agent::abort(const char* /* desc */) {}
+
+    void stackless_execution_agent::sleep_for(
+        hpx::chrono::steady_duration const& sleep_duration, const char* desc)
+    {
+        hpx::execution_base::detail::get_default_agent().sleep_for(
+            sleep_duration, desc);
+    }
+
+    void stackless_execution_agent::sleep_until(
+        hpx::chrono::steady_time_point const& sleep_time, const char* desc)
+    {
+        hpx::execution_base::detail::get_default_agent().sleep_until(
+            sleep_time, desc);
+    }
 }}    // namespace hpx::threads
@@ -10,12 +10,20 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
 
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -56,26 +64,210 @@ namespace hpx { namespace threads { namespace policies {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double max_time = thread_queue_init.max_idle_backoff_time_;
 
-        wait_counts_.resize(num_threads);
+        wait_counts_ =
+            std::vector<util::cache_line_data<idle_backoff_data>>(num_threads);
         for (auto&& data : wait_counts_)
         {
+            data.data_.parked_.store(0, std::memory_order_relaxed);
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
+            data.data_.wake_request_time_.store(0, std::memory_order_relaxed);
+            data.data_.park_count_.store(0, std::memory_order_relaxed);
+            data.data_.wake_count_.store(0, std::memory_order_relaxed);
+            data.data_.park_time_.store(0, std::memory_order_relaxed);
+            data.data_.wake_latency_.store(0, std::memory_order_relaxed);
         }
+        parked_workers_.data_.store(0, std::memory_order_relaxed);
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].store(hpx::state::initialized);
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+
+        std::int64_t idle_backoff_timestamp() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(int),
+            "the futex word has to be of the size of an int");
+
+        // Wait for the futex word to change from one to zero or for the given
+        // timeout to expire, whichever happens first.
+        void futex_wait(std::atomic<std::uint32_t>& word,
+            std::chrono::nanoseconds timeout) noexcept
+        {
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+            ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+
+            ::syscall(SYS_futex, reinterpret_cast<int*>(&word),
+                FUTEX_WAIT_PRIVATE, 1, &ts, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& word) noexcept
+        {
+            ::syscall(SYS_futex, reinterpret_cast<int*>(&word),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+#endif
+
+        template <typename Data>
+        std::int64_t accumulate_idle_backoff_counter(
+            std::vector<util::cache_line_data<Data>>& data,
+            std::size_t num_thread, bool reset,
+            std::atomic<std::int64_t> Data::*counter)
+        {
+            auto get = [&](Data& d) -> std::int64_t {
+                return reset ? (d.*counter).exchange(0) :
+                               (d.*counter).load(std::memory_order_relaxed);
+            };
+
+            if (num_thread != std::size_t(-1))
+            {
+                return get(data[num_thread].data_);
+            }
+
+            std::int64_t result = 0;
+            for (auto&& d : data)
+            {
+                result += get(d.data_);
+            }
+            return result;
+        }
+    }    // namespace
+
+    bool scheduler_base::park_worker(
+        std::size_t num_thread, std::chrono::nanoseconds period)
+    {
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+
+        data.parked_.store(1, std::memory_order_relaxed);
+        parked_workers_.data_.fetch_add(1, std::memory_order_relaxed);
+
+        // Pairs with the fence in wake_idle_worker. Either we see the work
+        // which was added concurrently or the thread adding it sees us being
+        // parked.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // don't go to sleep if new work has arrived in the meantime or if
+        // this scheduler thread is supposed to stop running
+        if (states_[num_thread].load(std::memory_order_relaxed) !=
+                hpx::state::running ||
+            get_queue_length(num_thread) != 0)
+        {
+            bool const woken =
+                data.parked_.exchange(0, std::memory_order_acq_rel) == 0;
+            parked_workers_.data_.fetch_sub(1, std::memory_order_relaxed);
+            return woken;
+        }
+
+        data.park_count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::int64_t const start = idle_backoff_timestamp();
+        std::int64_t const deadline = start +
+            std::chrono::duration_cast<std::chrono::nanoseconds>(period)
+                .count();
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        for (std::int64_t now = start;
+             data.parked_.load(std::memory_order_acquire) != 0 && now < deadline;
+             now = idle_backoff_timestamp())
+        {
+            futex_wait(data.parked_, std::chrono::nanoseconds(deadline - now));
+        }
+#else
+        {
+            std::unique_lock<std::mutex> l(data.mtx_);
+            data.cond_.wait_for(l, period, [&data]() {
+                return data.parked_.load(std::memory_order_acquire) == 0;
+            });
+        }
+#endif
+
+        // if the thread was not woken up explicitly, reset the parked state
+        // ourselves
+        bool const woken =
+            data.parked_.exchange(0, std::memory_order_acq_rel) == 0;
+        parked_workers_.data_.fetch_sub(1, std::memory_order_relaxed);
+
+        std::int64_t const end = idle_backoff_timestamp();
+        data.park_time_.fetch_add(end - start, std::memory_order_relaxed);
+
+        if (woken)
+        {
+            std::int64_t const latency =
+                end - data.wake_request_time_.load(std::memory_order_relaxed);
+
+            data.wake_count_.fetch_add(1, std::memory_order_relaxed);
+            data.wake_latency_.fetch_add(
+                (std::max)(latency, std::int64_t(0)),
+                std::memory_order_relaxed);
+        }
+        return woken;
+    }
+
+    bool scheduler_base::unpark_worker(idle_backoff_data& data)
+    {
+        if (data.parked_.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        data.wake_request_time_.store(
+            idle_backoff_timestamp(), std::memory_order_relaxed);
+        if (data.parked_.exchange(0, std::memory_order_acq_rel) == 0)
+        {
+            return false;    // somebody else was faster
+        }
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+        futex_wake(data.parked_);
+#else
+        {
+            // make sure the parked thread is either not waiting yet or is
+            // already waiting on the condition variable
+            std::lock_guard<std::mutex> l(data.mtx_);
+        }
+        data.cond_.notify_one();
+#endif
+        return true;
+    }
+
+    void scheduler_base::unpark_worker(std::size_t num_thread)
+    {
+        if (num_thread < wait_counts_.size())
+        {
+            unpark_worker(wait_counts_[num_thread].data_);
+            return;
+        }
+
+        // no specific scheduler thread was requested, wake up the first one
+        // found to be parked (this keeps the set of running threads compact)
+        for (auto&& data : wait_counts_)
+        {
+            if (unpark_worker(data.data_))
+            {
+                return;
+            }
+        }
+    }
+#endif
+
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::scheduler_mode::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
+            // Park this thread for some time, additionally it gets woken up
+            // on new work.
 
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
@@ -83,13 +275,29 @@ namespace hpx { namespace threads { namespace policies {
             double exponent = (std::min)(double(data.wait_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
 
-            std::chrono::milliseconds period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::nanoseconds period =
+                std::chrono::milliseconds(std::lround((std::min)(
+                    data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+
+            // don't sleep beyond the expiration of the next timer
+            if (!timers_.empty())
+            {
+                auto const next_timer =
+                    timers_.next_expiry() - std::chrono::steady_clock::now();
+                if (next_timer <= std::chrono::nanoseconds(0))
+                {
+                    return;
+                }
+                if (next_timer < period)
+                {
+                    period = std::chrono::duration_cast<
+                        std::chrono::nanoseconds>(next_timer);
+                }
+            }
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            if (park_worker(num_thread, period))
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
@@ -100,17 +308,116 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
+    void scheduler_base::wake_all_idle_workers()
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (auto&& data : wait_counts_)
+        {
+            unpark_worker(data.data_);
+        }
+#endif
+    }
+
+    std::size_t scheduler_base::process_timers()
+    {
+        if (timers_.empty())
+        {
+            return 0;
+        }
+
+        constexpr std::size_t max_expired = 32;
+        threads::detail::timer_wheel::expired_timer expired[max_expired];
+
+        std::size_t const count = timers_.expire(
+            std::chrono::steady_clock::now(), expired, max_expired);
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            // the timer thread may still be active (if it has not suspended
+            // yet or if it was aborted concurrently), it is woken up the way
+            // the caller of set_thread_state_timed asked for
+            error_code ec(throwmode::lightweight);
+            threads::detail::set_thread_state(expired[i].thrd.noref(),
+                thread_schedule_state::pending, thread_restart_state::timeout,
+                expired[i].priority, thread_schedule_hint(),
+                expired[i].retry_on_active, ec);
+        }
+        return count;
+    }
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
-#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        // The schedulers wake up the thread the work was queued for, this
+        // additionally wakes up one (possibly stealing) thread if no specific
+        // thread was targeted.
+        wake_idle_worker(num_thread);
+    }
+
+    void scheduler_base::create_thread_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
         {
-            cond_.notify_all();
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+                return;
         }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t scheduler_base::get_idle_park_count(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        return accumulate_idle_backoff_counter(
+            wait_counts_, num_thread, reset, &idle_backoff_data::park_count_);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
+#endif
+    }
+
+    std::int64_t scheduler_base::get_idle_wake_count(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        return accumulate_idle_backoff_counter(
+            wait_counts_, num_thread, reset, &idle_backoff_data::wake_count_);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
+#endif
+    }
+
+    std::int64_t scheduler_base::get_idle_park_time(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        return accumulate_idle_backoff_counter(
+            wait_counts_, num_thread, reset, &idle_backoff_data::park_time_);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
+#endif
+    }
+
+    std::int64_t scheduler_base::get_idle_wake_latency(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        return accumulate_idle_backoff_counter(
+            wait_counts_, num_thread, reset, &idle_backoff_data::wake_latency_);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
 #endif
     }
 
@@ -465,9 +465,11 @@ namespace hpx { namespace this_thread {
 #endif
             // We might need to dispatch 'nextid' to it's correct scheduler
             // only if our current scheduler is the same, we should yield the id
+            // (stackless threads can't yield to other threads either)
             if (nextid &&
-                get_thread_id_data(nextid)->get_scheduler_base() !=
-                    get_thread_id_data(id)->get_scheduler_base())
+                (get_thread_id_data(id)->is_stackless() ||
+                    get_thread_id_data(nextid)->get_scheduler_base() !=
+                        get_thread_id_data(id)->get_scheduler_base()))
             {
                 auto* scheduler =
                     get_thread_id_data(nextid)->get_scheduler_base();
@@ -547,9 +549,11 @@ namespace hpx { namespace this_thread {
 
             // We might need to dispatch 'nextid' to it's correct scheduler
             // only if our current scheduler is the same, we should yield the id
+            // (stackless threads can't yield to other threads either)
             if (nextid &&
-                get_thread_id_data(nextid)->get_scheduler_base() !=
-                    get_thread_id_data(id)->get_scheduler_base())
+                (get_thread_id_data(id)->is_stackless() ||
+                    get_thread_id_data(nextid)->get_scheduler_base() !=
+                        get_thread_id_data(id)->get_scheduler_base()))
             {
                 auto* scheduler =
                     get_thread_id_data(nextid)->get_scheduler_base();
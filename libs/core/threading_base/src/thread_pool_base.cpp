@@ -81,6 +81,17 @@ namespace hpx { namespace threads {
         return active_os_thread_count;
     }
 
+    void thread_pool_base::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (ec)
+                return;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void thread_pool_base::init_pool_time_scale()
     {
@@ -0,0 +1,342 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace threads { namespace detail {
+
+    namespace {
+
+        constexpr std::uint64_t max_tick =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        // index of the least significant bit set, value must not be zero
+        inline std::size_t lowest_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+            std::size_t bit = 0;
+            while (!(value & 1))
+            {
+                value >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        // index of the most significant bit set, value must not be zero
+        inline std::size_t highest_bit(std::uint64_t value) noexcept
+        {
+            HPX_ASSERT(value != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+            std::size_t bit = 0;
+            while (value >>= 1)
+            {
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        std::uint64_t nanoseconds_since_epoch(
+            timer_wheel::clock_type::time_point t) noexcept
+        {
+            auto const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    t.time_since_epoch())
+                    .count();
+            return ns < 0 ? 0 : static_cast<std::uint64_t>(ns);
+        }
+
+        // the last tick which has been reached at the given point in time
+        std::uint64_t tick_reached(
+            timer_wheel::clock_type::time_point t) noexcept
+        {
+            return nanoseconds_since_epoch(t) / 1000;
+        }
+
+        // the first tick at which the given point in time has been reached
+        // (max_tick is reserved to mark an empty wheel)
+        std::uint64_t tick_expires(
+            timer_wheel::clock_type::time_point t) noexcept
+        {
+            if (t == (timer_wheel::clock_type::time_point::max)())
+                return max_tick - 1;
+
+            std::uint64_t const ns = nanoseconds_since_epoch(t);
+            return ns / 1000 + (ns % 1000 != 0 ? 1 : 0);
+        }
+    }    // namespace
+
+    timer_wheel::timer_wheel() noexcept
+      : current_(tick_reached(clock_type::now()))
+      , next_expiry_(max_tick)
+      , expired_tail_(nullptr)
+    {
+        occupied_.fill(0);
+        heads_.fill(nullptr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel::link(entry* e, std::uint16_t list) noexcept
+    {
+        HPX_ASSERT(e->list_ == no_list);
+
+        e->list_ = list;
+        e->prev_ = nullptr;
+        if (list == expired_list)
+        {
+            // the expired timers are handed out in FIFO order
+            e->next_ = nullptr;
+            e->prev_ = expired_tail_;
+            if (expired_tail_ != nullptr)
+                expired_tail_->next_ = e;
+            else
+                heads_[list] = e;
+            expired_tail_ = e;
+            return;
+        }
+
+        e->next_ = heads_[list];
+        if (e->next_ != nullptr)
+            e->next_->prev_ = e;
+        heads_[list] = e;
+        occupied_[list / slots] |= std::uint64_t(1) << (list % slots);
+    }
+
+    void timer_wheel::unlink(entry* e) noexcept
+    {
+        std::uint16_t const list = e->list_;
+        HPX_ASSERT(list != no_list);
+
+        if (e->prev_ != nullptr)
+            e->prev_->next_ = e->next_;
+        else
+            heads_[list] = e->next_;
+
+        if (e->next_ != nullptr)
+            e->next_->prev_ = e->prev_;
+        else if (list == expired_list)
+            expired_tail_ = e->prev_;
+
+        if (list != expired_list && heads_[list] == nullptr)
+            occupied_[list / slots] &= ~(std::uint64_t(1) << (list % slots));
+
+        e->prev_ = nullptr;
+        e->next_ = nullptr;
+        e->list_ = no_list;
+    }
+
+    // store the timer on the level of the most significant digit its
+    // expiration tick differs from the current tick, the timer has to expire
+    // after the current tick
+    void timer_wheel::insert(entry* e) noexcept
+    {
+        HPX_ASSERT(e->expiry_ > current_);
+
+        std::size_t const level =
+            highest_bit(e->expiry_ ^ current_) / slot_bits;
+        std::size_t const slot =
+            (e->expiry_ >> (level * slot_bits)) & (slots - 1);
+
+        link(e, static_cast<std::uint16_t>(level * slots + slot));
+    }
+
+    // All occupied slots on a level have a larger digit than the current tick
+    // at that level. Thus, the next tick at which anything needs to be done
+    // is given by the first occupied slot on the lowest non-empty level.
+    std::uint64_t timer_wheel::next_tick(std::size_t level) const noexcept
+    {
+        HPX_ASSERT(occupied_[level] != 0);
+
+        std::size_t const shift = level * slot_bits;
+        return ((((current_ >> shift) >> slot_bits) << slot_bits) |
+                   lowest_bit(occupied_[level]))
+            << shift;
+    }
+
+    void timer_wheel::advance(std::uint64_t tick) noexcept
+    {
+        while (current_ < tick)
+        {
+            std::size_t level = 0;
+            while (level != levels && occupied_[level] == 0)
+                ++level;
+
+            if (level == levels)
+            {
+                current_ = tick;
+                break;
+            }
+
+            std::uint64_t const next = next_tick(level);
+            if (next > tick)
+            {
+                current_ = tick;
+                break;
+            }
+            current_ = next;
+
+            // expire the timers in that slot or move them to lower levels
+            std::size_t const slot = lowest_bit(occupied_[level]);
+            std::uint16_t const list =
+                static_cast<std::uint16_t>(level * slots + slot);
+            entry* e = heads_[list];
+            heads_[list] = nullptr;
+            occupied_[level] &= ~(std::uint64_t(1) << slot);
+
+            while (e != nullptr)
+            {
+                entry* next_entry = e->next_;
+                e->list_ = no_list;
+                if (e->expiry_ <= current_)
+                    link(e, expired_list);
+                else
+                    insert(e);
+                e = next_entry;
+            }
+        }
+    }
+
+    void timer_wheel::update_next_expiry() noexcept
+    {
+        if (heads_[expired_list] != nullptr)
+        {
+            next_expiry_.store(current_, std::memory_order_relaxed);
+            return;
+        }
+
+        for (std::size_t level = 0; level != levels; ++level)
+        {
+            if (occupied_[level] != 0)
+            {
+                next_expiry_.store(
+                    next_tick(level), std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        next_expiry_.store(max_tick, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool timer_wheel::add(entry& e, clock_type::time_point abs_time,
+        thread_id_ref_type thrd, thread_priority priority,
+        bool retry_on_active, bool& earliest)
+    {
+        HPX_ASSERT(e.list_ == no_list);
+
+        std::uint64_t const expiry = tick_expires(abs_time);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        if (expiry <= current_)
+        {
+            earliest = false;
+            return false;
+        }
+
+        e.expiry_ = expiry;
+        e.priority_ = priority;
+        e.retry_on_active_ = retry_on_active;
+        e.thrd_ = HPX_MOVE(thrd);
+        insert(&e);
+
+        earliest = expiry < next_expiry_.load(std::memory_order_relaxed);
+        if (earliest)
+        {
+            next_expiry_.store(expiry, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    bool timer_wheel::cancel(entry& e)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (e.list_ == no_list)
+        {
+            return false;
+        }
+
+        unlink(&e);
+        e.thrd_ = thread_id_ref_type();
+
+        // the next expiration tick is a lower bound only, there is no need
+        // to recompute it here
+        if (heads_[expired_list] == nullptr &&
+            std::all_of(occupied_.begin(), occupied_.end(),
+                [](std::uint64_t bits) { return bits == 0; }))
+        {
+            next_expiry_.store(max_tick, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    std::size_t timer_wheel::expire(
+        clock_type::time_point now, expired_timer* expired, std::size_t max)
+    {
+        std::uint64_t const tick = tick_reached(now);
+        if (tick < next_expiry_.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            return 0;
+        }
+
+        if (tick > current_)
+        {
+            advance(tick);
+        }
+
+        std::size_t count = 0;
+        while (count != max && heads_[expired_list] != nullptr)
+        {
+            entry* e = heads_[expired_list];
+            unlink(e);
+            expired_timer& timer = expired[count++];
+            timer.thrd = HPX_MOVE(e->thrd_);
+            timer.priority = e->priority_;
+            timer.retry_on_active = e->retry_on_active_;
+        }
+
+        update_next_expiry();
+        return count;
+    }
+
+    timer_wheel::clock_type::time_point timer_wheel::next_expiry()
+        const noexcept
+    {
+        std::uint64_t const tick = next_expiry_.load(std::memory_order_relaxed);
+        if (tick >= std::uint64_t(
+                        (std::numeric_limits<std::int64_t>::max)() / 1000))
+        {
+            return (clock_type::time_point::max)();
+        }
+
+        return clock_type::time_point(
+            std::chrono::duration_cast<clock_type::duration>(
+                std::chrono::microseconds(tick)));
+    }
+}}}    // namespace hpx::threads::detail
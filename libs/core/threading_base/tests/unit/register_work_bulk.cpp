@@ -0,0 +1,82 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that work items registered in bulk are all executed, independently
+// of their scheduling hints and priorities.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_register_work_bulk(hpx::threads::thread_priority priority,
+    bool use_hint, std::size_t num_tasks)
+{
+    hpx::threads::thread_pool_base* pool =
+        hpx::threads::detail::get_self_or_default_pool();
+    std::size_t const num_threads = pool->get_os_thread_count();
+
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // group consecutive tasks on the same worker thread
+        hpx::threads::thread_schedule_hint hint;
+        if (use_hint)
+        {
+            hint = hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(
+                (i * num_threads) / num_tasks));
+        }
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&count, &l]() {
+                                  ++count;
+                                  l.count_down(1);
+                              }),
+            "test_register_work_bulk", priority, hint);
+    }
+
+    hpx::threads::register_work_bulk(data, pool);
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+int hpx_main()
+{
+    using hpx::threads::thread_priority;
+
+    for (thread_priority priority : {thread_priority::default_,
+             thread_priority::normal, thread_priority::low,
+             thread_priority::high})
+    {
+        test_register_work_bulk(priority, true, 1000);
+        test_register_work_bulk(priority, false, 1000);
+        test_register_work_bulk(priority, true, 1);
+    }
+
+    // an empty batch is fine as well
+    std::vector<hpx::threads::thread_init_data> data;
+    hpx::threads::register_work_bulk(data);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
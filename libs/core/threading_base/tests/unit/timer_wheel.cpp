@@ -0,0 +1,212 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the timer wheel never expires timers early, that canceled
+// timers are not handed out, and that timed suspensions of many concurrent
+// threads work as expected.
+
+#include <hpx/local/condition_variable.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_timer_wheel()
+{
+    using clock = timer_wheel::clock_type;
+
+    constexpr std::size_t num_timers = 10000;
+
+    timer_wheel timers;
+    std::mt19937 gen(42);
+
+    // timers spread over a wide range of levels
+    clock::time_point const start = clock::now();
+    std::vector<std::unique_ptr<timer_wheel::entry>> entries;
+    std::vector<clock::time_point> expiries;
+    std::vector<bool> canceled;
+    for (std::size_t i = 0; i != num_timers; ++i)
+    {
+        std::uint64_t const range = std::uint64_t(1) << (gen() % 36);
+        entries.emplace_back(new timer_wheel::entry);
+        expiries.push_back(start + std::chrono::microseconds(100) +
+            std::chrono::nanoseconds(
+                ((std::uint64_t(gen()) << 32) | gen()) % range));
+
+        bool earliest = false;
+        HPX_TEST(timers.add(*entries.back(), expiries.back(),
+            hpx::threads::thread_id_ref_type(),
+            hpx::threads::thread_priority::normal, true, earliest));
+
+        canceled.push_back(gen() % 4 == 0);
+        if (canceled.back())
+        {
+            HPX_TEST(timers.cancel(*entries.back()));
+        }
+    }
+    HPX_TEST(!timers.empty());
+    HPX_TEST(timers.next_expiry() <= start + std::chrono::microseconds(101));
+
+    // timers in the past are rejected
+    {
+        timer_wheel::entry e;
+        bool earliest = false;
+        HPX_TEST(!timers.add(e, start - std::chrono::seconds(1),
+            hpx::threads::thread_id_ref_type(),
+            hpx::threads::thread_priority::normal, true, earliest));
+        HPX_TEST(!timers.cancel(e));
+    }
+
+    // advance the wheel in irregular steps, none of the remaining timers may
+    // have expired before its time, all of them must have expired after it
+    timer_wheel::expired_timer expired[16];
+    clock::time_point now = start;
+    std::size_t checked = 0;
+    while (checked != num_timers)
+    {
+        now += std::chrono::nanoseconds(gen() % (std::uint64_t(1) << 34));
+        while (timers.expire(now, expired, 16) != 0)
+        {
+        }
+
+        for (std::size_t i = 0; i != num_timers; ++i)
+        {
+            if (!entries[i])
+                continue;
+
+            if (canceled[i])
+            {
+                HPX_TEST(!timers.cancel(*entries[i]));
+            }
+            else if (expiries[i] <= now)
+            {
+                HPX_TEST(!timers.cancel(*entries[i]));
+            }
+            else if (gen() % 8 == 0)
+            {
+                HPX_TEST(timers.cancel(*entries[i]));
+            }
+            else
+            {
+                continue;
+            }
+
+            entries[i].reset();
+            ++checked;
+        }
+    }
+    HPX_TEST(timers.empty());
+}
+
+void test_timer_wheel_wakeup_parameters()
+{
+    using clock = timer_wheel::clock_type;
+
+    timer_wheel timers;
+
+    // expired timers report the priority and retry policy they were armed
+    // with
+    clock::time_point const start = clock::now();
+    timer_wheel::entry e;
+    bool earliest = false;
+    HPX_TEST(timers.add(e, start + std::chrono::microseconds(100),
+        hpx::threads::thread_id_ref_type(),
+        hpx::threads::thread_priority::low, false, earliest));
+    HPX_TEST(earliest);
+
+    timer_wheel::expired_timer expired[1];
+    HPX_TEST_EQ(
+        timers.expire(start + std::chrono::seconds(1), expired, 1), 1u);
+    HPX_TEST(expired[0].priority == hpx::threads::thread_priority::low);
+    HPX_TEST(!expired[0].retry_on_active);
+    HPX_TEST(timers.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sleep_for()
+{
+    constexpr std::size_t num_threads = 1000;
+
+    std::vector<hpx::future<bool>> results;
+    results.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        results.push_back(hpx::async([i]() {
+            auto const duration = std::chrono::microseconds(100 * (i % 100));
+            auto const start = std::chrono::steady_clock::now();
+            hpx::this_thread::sleep_for(duration);
+            return std::chrono::steady_clock::now() - start >= duration;
+        }));
+    }
+
+    for (auto& f : results)
+    {
+        HPX_TEST(f.get());
+    }
+}
+
+void test_wait_for()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+    bool ready = false;
+
+    // timed out wait
+    {
+        std::unique_lock<hpx::mutex> l(mtx);
+        auto const start = std::chrono::steady_clock::now();
+        HPX_TEST(cond.wait_for(l, std::chrono::milliseconds(10)) ==
+            hpx::cv_status::timeout);
+        HPX_TEST(std::chrono::steady_clock::now() - start >=
+            std::chrono::milliseconds(10));
+    }
+
+    // notified wait, cancels the timer
+    hpx::future<void> f = hpx::async([&]() {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::lock_guard<hpx::mutex> l(mtx);
+        ready = true;
+        cond.notify_one();
+    });
+
+    {
+        std::unique_lock<hpx::mutex> l(mtx);
+        HPX_TEST(cond.wait_for(l, std::chrono::seconds(100),
+            [&ready]() { return ready; }));
+    }
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_timer_wheel();
+    test_timer_wheel_wakeup_parameters();
+    test_sleep_for();
+    test_wait_for();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+
+    return hpx::util::report_errors();
+}
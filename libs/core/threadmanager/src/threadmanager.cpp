@@ -143,6 +143,12 @@ namespace hpx { namespace threads {
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
+        std::int64_t const idle_backoff_spin_count =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.idle_backoff_spin_count", HPX_IDLE_BACKOFF_SPIN_COUNT);
+        std::int64_t const idle_backoff_pause_count =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.idle_backoff_pause_count", HPX_IDLE_BACKOFF_PAUSE_COUNT);
 
         std::ptrdiff_t small_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::small_);
@@ -158,7 +164,8 @@ namespace hpx { namespace threads {
             min_tasks_to_steal_staged, min_add_new_count, max_add_new_count,
             min_delete_count, max_delete_count, max_terminated_threads,
             init_threads_count, max_idle_backoff_time, small_stacksize,
-            medium_stacksize, large_stacksize, huge_stacksize);
+            medium_stacksize, large_stacksize, huge_stacksize,
+            idle_backoff_spin_count, idle_backoff_pause_count);
 
         if (!rtcfg_.enable_networking())
         {
@@ -487,16 +494,187 @@ namespace hpx { namespace threads {
                 break;
             }
 
+            case resource::local_workrequesting_fifo:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.high_priority_queues",
+                        thread_pool_init.num_threads_);
+                detail::check_num_high_priority_queues(
+                    thread_pool_init.num_threads_, num_high_priority_queues);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_workrequesting_scheduler<
+                        std::mutex, hpx::threads::policies::lockfree_fifo>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_workrequesting_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+                break;
+            }
+
+            case resource::local_workrequesting_lifo:
+            {
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.high_priority_queues",
+                        thread_pool_init.num_threads_);
+                detail::check_num_high_priority_queues(
+                    thread_pool_init.num_threads_, num_high_priority_queues);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_workrequesting_scheduler<
+                        std::mutex, hpx::threads::policies::lockfree_lifo>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_workrequesting_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option "
+                    "--hpx:queuing=local-workrequesting-lifo "
+                    "is not configured in this build. Please make sure 128bit "
+                    "atomics are available.");
+#endif
+                break;
+            }
+
+            case resource::deadline:
+            {
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::deadline_queue_scheduler<>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, thread_queue_init,
+                    "core-deadline_queue_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+                break;
+            }
+
+            case resource::local_priority_chase_lev:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.high_priority_queues",
+                        thread_pool_init.num_threads_);
+                detail::check_num_high_priority_queues(
+                    thread_pool_init.num_threads_, num_high_priority_queues);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_priority_queue_scheduler<
+                        std::mutex, hpx::threads::policies::lockfree_chase_lev>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init,
+                    "core-local_priority_queue_scheduler_chase_lev");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+                break;
+            }
+
             case resource::shared_priority:
             {
                 // instantiate the scheduler
                 typedef hpx::threads::policies::
                     shared_priority_queue_scheduler<>
                         local_sched_type;
+                // the number of victims to steal from on each level of the
+                // machine hierarchy, negative values remove the limit
+                policies::steal_budgets budgets =
+                    policies::default_steal_budgets();
+                for (std::size_t l = 0; l != policies::steal_level_count; ++l)
+                {
+                    std::int64_t const budget =
+                        hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                            std::string("hpx.thread_queue.steal_budget_") +
+                                policies::get_steal_level_name(
+                                    static_cast<policies::steal_level>(l)),
+                            -1);
+                    if (budget >= 0)
+                        budgets[l] = static_cast<std::size_t>(budget);
+                }
+
                 local_sched_type::init_parameter_type init(
                     thread_pool_init.num_threads_, {1, 1, 1},
                     thread_pool_init.affinity_data_, thread_queue_init,
-                    "core-shared_priority_queue_scheduler");
+                    "core-shared_priority_queue_scheduler", budgets);
 
                 std::unique_ptr<local_sched_type> sched(
                     new local_sched_type(init));
@@ -187,6 +187,19 @@ namespace hpx { namespace threads {
         mask_cref_type get_core_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit available to the given thread sharing the
+        ///        data (or unified) cache of the given level (1 to 3) with
+        ///        it. If the cache of the requested level is not reported
+        ///        by the system, the mask of the next lower level is
+        ///        returned (the core affinity mask for level 1).
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            std::size_t level, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread.
         ///
@@ -307,6 +320,8 @@ namespace hpx { namespace threads {
             std::size_t num_numa_node) const;
         mask_type init_core_affinity_mask_from_core(std::size_t num_core,
             mask_cref_type default_mask = empty_mask) const;
+        mask_type init_cache_affinity_mask(std::size_t num_thread,
+            std::size_t level, mask_cref_type default_mask) const;
         mask_type init_thread_affinity_mask(std::size_t num_thread) const;
         mask_type init_thread_affinity_mask(
             std::size_t num_core, std::size_t num_pu) const;
@@ -405,6 +420,10 @@ namespace hpx { namespace threads {
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
+
+        // one vector of affinity masks for each of the cache levels 1 to 3
+        static constexpr std::size_t max_cache_level = 3;
+        std::vector<mask_type> cache_affinity_masks_[max_cache_level];
     };
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -305,6 +305,22 @@ namespace hpx { namespace threads {
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
         }
+
+        // caches not reported by the system fall back to the mask of the
+        // next lower level
+        for (std::size_t level = 0; level != max_cache_level; ++level)
+        {
+            std::vector<mask_type> const& default_masks = (level == 0) ?
+                core_affinity_masks_ :
+                cache_affinity_masks_[level - 1];
+
+            cache_affinity_masks_[level].reserve(num_of_pus_);
+            for (std::size_t i = 0; i < num_of_pus_; ++i)
+            {
+                cache_affinity_masks_[level].push_back(
+                    init_cache_affinity_mask(i, level + 1, default_masks[i]));
+            }
+        }
     }    // }}}
 
     void topology::write_to_log() const
@@ -340,6 +356,10 @@ namespace hpx { namespace threads {
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
         detail::write_to_log_mask(
             "thread_affinity_mask", thread_affinity_masks_);
+        detail::write_to_log_mask(
+            "l2_cache_affinity_mask", cache_affinity_masks_[1]);
+        detail::write_to_log_mask(
+            "l3_cache_affinity_mask", cache_affinity_masks_[2]);
     }
 
     topology::~topology()
@@ -457,6 +477,33 @@ namespace hpx { namespace threads {
         return empty_mask;
     }
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, std::size_t level, error_code& ec) const
+    {    // {{{
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (level == 0 || level > max_cache_level)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "hpx::threads::topology::get_cache_affinity_mask",
+                "cache level {1} is out of range", level);
+            return empty_mask;
+        }
+
+        if (num_pu < cache_affinity_masks_[level - 1].size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[level - 1][num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter,
+            "hpx::threads::topology::get_cache_affinity_mask",
+            "thread number {1} is out of range", num_thread);
+        return empty_mask;
+    }    // }}}
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {    // {{{
@@ -1121,6 +1168,42 @@ namespace hpx { namespace threads {
         return default_mask;
     }    // }}}
 
+    mask_type topology::init_cache_affinity_mask(std::size_t num_thread,
+        std::size_t level, mask_cref_type default_mask) const
+    {    // {{{
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+        }
+
+        // find the data (or unified) cache of the requested level the given
+        // processing unit is attached to
+        for (/**/; obj != nullptr; obj = obj->parent)
+        {
+#if HWLOC_API_VERSION >= 0x00020000
+            if (hwloc_obj_type_is_dcache(obj->type) &&
+                obj->attr->cache.depth == level)
+#else
+            if (hwloc_compare_types(HWLOC_OBJ_CACHE, obj->type) == 0 &&
+                obj->attr->cache.type != HWLOC_OBJ_CACHE_INSTRUCTION &&
+                obj->attr->cache.depth == level)
+#endif
+            {
+                mask_type cache_affinity_mask = mask_type();
+                resize(cache_affinity_mask, get_number_of_pus());
+
+                extract_node_mask(obj, cache_affinity_mask);
+                return cache_affinity_mask;
+            }
+        }
+
+        return default_mask;
+    }    // }}}
+
     mask_type topology::init_thread_affinity_mask(std::size_t num_thread) const
     {    // {{{
 
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <hpx/parallel/algorithms/counting_sort.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/algorithms/sort_by_key.hpp>
 #include <hpx/parallel/algorithms/stable_sort.hpp>
+#include <hpx/parallel/container_algorithms/counting_sort.hpp>
 #include <hpx/parallel/container_algorithms/sort.hpp>
 #include <hpx/parallel/container_algorithms/stable_sort.hpp>
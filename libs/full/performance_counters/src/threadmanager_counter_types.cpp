@@ -21,6 +21,11 @@
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 
+#if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&   \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -430,6 +435,57 @@ namespace hpx { namespace performance_counters { namespace detail {
         return naming::invalid_gid;
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // stack pool counter creation function
+#if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&   \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+    using stack_pool_counter_type = std::uint64_t
+        threads::coroutines::detail::posix::stack_pool_counters::*;
+
+    // /threads{locality#%d/total}/stack-pool/<counter>
+    naming::gid_type stack_pool_counter_creator(
+        stack_pool_counter_type counter, bool monotonic,
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        // the values are summed up over the pools of all stack sizes, a reset
+        // of a monotonic counter only affects this counter instance
+        hpx::function<std::int64_t(bool)> f =
+            [counter, monotonic, base = std::uint64_t(0)](
+                bool reset) mutable {
+                std::uint64_t value = 0;
+                for (auto const& c : threads::coroutines::detail::posix::
+                         get_stack_pool_counters())
+                {
+                    value += c.*counter;
+                }
+
+                if (!monotonic)
+                {
+                    return static_cast<std::int64_t>(value);
+                }
+
+                std::int64_t const result =
+                    static_cast<std::int64_t>(value - base);
+                if (reset)
+                {
+                    base = value;
+                }
+                return result;
+            };
+
+        return counter_creator(
+            info, paths, f, hpx::function<std::int64_t(bool)>(), "", 0, ec);
+    }
+#endif
 }}}    // namespace hpx::performance_counters::detail
 
 namespace hpx { namespace performance_counters {
@@ -704,6 +760,79 @@ namespace hpx { namespace performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+#if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&   \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+            {"/threads/stack-pool/mapped-bytes", counter_type::raw,
+                "returns the overall size of the memory mappings the stack "
+                "pools carve HPX-thread stacks from for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        mapped_bytes,
+                    false),
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/stack-pool/mappings",
+                counter_type::monotonically_increasing,
+                "returns the overall number of memory mappings created by the "
+                "stack pools for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        mappings,
+                    true),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/in-use", counter_type::raw,
+                "returns the current number of HPX-thread stacks handed out "
+                "by the stack pools for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        stacks_in_use,
+                    false),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/cached", counter_type::raw,
+                "returns the current number of HPX-thread stacks cached for "
+                "reuse by the stack pools for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        stacks_cached,
+                    false),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/allocations",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-thread stacks allocated "
+                "from the stack pools for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        allocations,
+                    true),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/reuses",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-thread stack allocations "
+                "served from the stacks cached by the stack pools for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        reused,
+                    true),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/reclaims",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-thread stacks whose memory "
+                "was given back to the operating system by the stack pools "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::stack_pool_counter_creator,
+                    &threads::coroutines::detail::posix::stack_pool_counters::
+                        reclaimed,
+                    true),
+                &locality_counter_discoverer, ""},
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
                 counter_type::monotonically_increasing,
@@ -788,6 +917,49 @@ namespace hpx { namespace performance_counters {
                 hpx::bind_front(
                     &detail::locality_pool_thread_no_total_counter_creator, &tm,
                     &threads::thread_pool_base::get_busy_loop_count),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // idle worker parking
+            {"/threads/idle-park-count/instantaneous", counter_type::raw,
+                "returns the number of times the scheduler has parked the "
+                "referenced idle worker thread",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_park_count),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            {"/threads/idle-wake-count/instantaneous", counter_type::raw,
+                "returns the number of times the referenced parked worker "
+                "thread has been woken up because of new work",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_wake_count),
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            {"/threads/time/idle-park", counter_type::elapsed_time,
+                "returns the overall time the referenced worker thread has "
+                "spent being parked",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_park_time),
+                &locality_pool_thread_no_total_counter_discoverer, "ns"},
+            {"/threads/time/idle-wake-latency", counter_type::elapsed_time,
+                "returns the overall time which has passed between new work "
+                "being scheduled for the referenced parked worker thread and "
+                "the worker thread resuming its execution",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_idle_wake_latency),
+                &locality_pool_thread_no_total_counter_discoverer, "ns"},
+            // deadline scheduling
+            {"/threads/deadline-miss-count/instantaneous", counter_type::raw,
+                "returns the number of times the referenced worker thread has "
+                "started running an HPX thread after its deadline had passed",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(
+                    &detail::locality_pool_thread_no_total_counter_creator, &tm,
+                    &threads::thread_pool_base::get_deadline_miss_count),
                 &locality_pool_thread_no_total_counter_discoverer, ""}
         };
 
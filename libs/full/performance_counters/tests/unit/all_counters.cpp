@@ -66,6 +66,11 @@ char const* const locality_pool_thread_no_total_counter_names[] =
 {
     "/threads/idle-loop-count/instantaneous",
     "/threads/busy-loop-count/instantaneous",
+    "/threads/idle-park-count/instantaneous",
+    "/threads/idle-wake-count/instantaneous",
+    "/threads/time/idle-park",
+    "/threads/time/idle-wake-latency",
+    "/threads/deadline-miss-count/instantaneous",
     nullptr
 };
 // clang-format on
@@ -82,6 +87,13 @@ char const* const locality_counter_names[] = {
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
 #endif
+#endif
+#if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&   \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+    "/threads/stack-pool/mapped-bytes", "/threads/stack-pool/mappings",
+    "/threads/stack-pool/in-use", "/threads/stack-pool/cached",
+    "/threads/stack-pool/allocations", "/threads/stack-pool/reuses",
+    "/threads/stack-pool/reclaims",
 #endif
     "/scheduler/utilization/instantaneous", nullptr};
 
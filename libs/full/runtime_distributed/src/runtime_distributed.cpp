@@ -21,6 +21,7 @@
 #include <hpx/format.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/itt_notify/thread_name.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
@@ -1052,6 +1053,47 @@ namespace hpx {
                 "s"    // unit of measure is seconds
             },
 
+            // future shared state pool counters
+            {"/futures/count/shared-state-allocations",
+                performance_counters::counter_type::monotonically_increasing,
+                "returns the number of future shared states allocated on "
+                "this locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                [](performance_counters::counter_info const& info,
+                    error_code& ec) {
+                    return performance_counters::locality_raw_counter_creator(
+                        info,
+                        &lcos::detail::get_shared_state_pool_allocation_count,
+                        ec);
+                },
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/futures/count/shared-state-pool-hits",
+                performance_counters::counter_type::monotonically_increasing,
+                "returns the number of future shared states on this locality "
+                "which were allocated from a per-thread pool",
+                HPX_PERFORMANCE_COUNTER_V1,
+                [](performance_counters::counter_info const& info,
+                    error_code& ec) {
+                    return performance_counters::locality_raw_counter_creator(
+                        info, &lcos::detail::get_shared_state_pool_hit_count,
+                        ec);
+                },
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/futures/count/shared-state-remote-frees",
+                performance_counters::counter_type::monotonically_increasing,
+                "returns the number of future shared states on this locality "
+                "which were released on a thread other than the one which "
+                "allocated them",
+                HPX_PERFORMANCE_COUNTER_V1,
+                [](performance_counters::counter_info const& info,
+                    error_code& ec) {
+                    return performance_counters::locality_raw_counter_creator(
+                        info,
+                        &lcos::detail::get_shared_state_pool_remote_free_count,
+                        ec);
+                },
+                &performance_counters::locality_counter_discoverer, ""},
+
             // component instance counters
             {"/runtime/count/component",
                 performance_counters::counter_type::raw,
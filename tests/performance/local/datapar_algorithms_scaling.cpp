@@ -0,0 +1,202 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the vectorized (simd, par_simd) and the scalar (seq, par) versions
+// of count, minmax_element, replace, inclusive_scan and search.
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+std::int64_t measure(int count, F&& f)
+{
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != count; ++i)
+        f();
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / count;
+}
+
+struct benchmark_data
+{
+    std::vector<float> data;
+    std::vector<float> dest;
+    std::vector<float> needle;
+};
+
+template <typename ExPolicy>
+void run_count(ExPolicy&& policy, benchmark_data& d)
+{
+    hpx::count(policy, std::begin(d.data), std::end(d.data), 42.0f);
+}
+
+template <typename ExPolicy>
+void run_minmax_element(ExPolicy&& policy, benchmark_data& d)
+{
+    hpx::minmax_element(policy, std::begin(d.data), std::end(d.data));
+}
+
+template <typename ExPolicy>
+void run_replace(ExPolicy&& policy, benchmark_data& d)
+{
+    // replaces nothing, the data stays the same for all iterations
+    hpx::replace(policy, std::begin(d.data), std::end(d.data), -1.0f, -2.0f);
+}
+
+template <typename ExPolicy>
+void run_inclusive_scan(ExPolicy&& policy, benchmark_data& d)
+{
+    hpx::inclusive_scan(policy, std::begin(d.data), std::end(d.data),
+        std::begin(d.dest), std::plus<>());
+}
+
+template <typename ExPolicy>
+void run_search(ExPolicy&& policy, benchmark_data& d)
+{
+    hpx::search(policy, std::begin(d.data), std::end(d.data),
+        std::begin(d.needle), std::end(d.needle));
+}
+
+template <typename Policy, typename SimdPolicy, typename F>
+void report(std::string const& name, int test_count, bool csvoutput,
+    Policy&& policy, SimdPolicy&& simd_policy, benchmark_data& d, F&& f)
+{
+    // warm up caches
+    f(policy, d);
+
+    std::int64_t time_simd =
+        measure(test_count, [&]() { f(simd_policy, d); });
+    std::int64_t time_scalar = measure(test_count, [&]() { f(policy, d); });
+
+    if (csvoutput)
+    {
+        std::cout << name << "," << time_scalar / 1e9 << ","
+                  << time_simd / 1e9 << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << name << ": " << std::right << std::setw(15)
+                  << time_scalar / 1e9 << " " << std::right << std::setw(15)
+                  << time_simd / 1e9 << " (speedup " << std::setprecision(3)
+                  << double(time_scalar) / double(time_simd) << ")\n"
+                  << std::setprecision(6) << std::flush;
+    }
+}
+
+template <typename Policy, typename SimdPolicy>
+void run_benchmarks(std::string const& suffix, int test_count, bool csvoutput,
+    Policy&& policy, SimdPolicy&& simd_policy, benchmark_data& d)
+{
+    report("count" + suffix, test_count, csvoutput, policy, simd_policy, d,
+        [](auto&& p, benchmark_data& data) { run_count(p, data); });
+    report("minmax_element" + suffix, test_count, csvoutput, policy,
+        simd_policy, d,
+        [](auto&& p, benchmark_data& data) { run_minmax_element(p, data); });
+    report("replace" + suffix, test_count, csvoutput, policy, simd_policy, d,
+        [](auto&& p, benchmark_data& data) { run_replace(p, data); });
+    report("inclusive_scan" + suffix, test_count, csvoutput, policy,
+        simd_policy, d,
+        [](auto&& p, benchmark_data& data) { run_inclusive_scan(p, data); });
+    report("search" + suffix, test_count, csvoutput, policy, simd_policy, d,
+        [](auto&& p, benchmark_data& data) { run_search(p, data); });
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+
+    std::size_t size = vm["vector_size"].as<std::size_t>();
+    bool csvoutput = vm["csv_output"].as<int>() ? true : false;
+    int test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than zero...\n" << std::flush;
+        return hpx::local::finalize();
+    }
+
+    benchmark_data d;
+    d.data.resize(size);
+    d.dest.resize(size);
+
+    std::uniform_real_distribution<float> dis(0.0f, 1000.0f);
+    for (auto& v : d.data)
+    {
+        v = dis(gen);
+    }
+
+    // the needle is not part of the data
+    d.needle = {-1.0f, -2.0f, -3.0f};
+
+    if (!csvoutput)
+    {
+        std::cout << "algorithm: " << std::right << std::setw(15) << "scalar"
+                  << " " << std::right << std::setw(15) << "datapar"
+                  << "\n";
+    }
+
+    run_benchmarks("(seq)", test_count, csvoutput, hpx::execution::seq,
+        hpx::execution::simd, d);
+    run_benchmarks("(par)", test_count, csvoutput, hpx::execution::par,
+        hpx::execution::par_simd, d);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of vector")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,153 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the lock types usable from HPX
+// threads under varying contention. For each of the lock types and for an
+// increasing number of concurrently running HPX threads, every thread
+// repeatedly acquires the lock, busy waits inside the critical section, and
+// busy waits outside of it. The uncontended case is measured using a single
+// HPX thread.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include "worker_timed.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_iterations = 100000;
+std::uint64_t inner_delay = 0;
+std::uint64_t outer_delay = 0;
+std::size_t repetitions = 5;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Mutex>
+double measure(Mutex& mtx, std::size_t num_threads)
+{
+    std::uint64_t counter = 0;
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(num_threads);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([&]() {
+            for (std::uint64_t j = 0; j != num_iterations; ++j)
+            {
+                {
+                    std::lock_guard<Mutex> l(mtx);
+                    worker_timed(inner_delay);
+                    ++counter;
+                }
+                worker_timed(outer_delay);
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    double const elapsed = t.elapsed();
+    if (counter != num_threads * num_iterations)
+    {
+        std::cerr << "unexpected number of critical sections executed\n";
+    }
+    return elapsed;
+}
+
+template <typename Mutex>
+void run(char const* name)
+{
+    std::size_t const num_cores = hpx::get_os_thread_count();
+
+    std::vector<std::size_t> num_threads = {1};
+    for (std::size_t n = 2; n < 4 * num_cores; n *= 2)
+    {
+        num_threads.push_back(n);
+    }
+    num_threads.push_back(4 * num_cores);
+
+    for (std::size_t n : num_threads)
+    {
+        Mutex mtx;
+        double elapsed = 0;
+        for (std::size_t i = 0; i != repetitions; ++i)
+        {
+            elapsed += measure(mtx, n);
+        }
+        elapsed /= repetitions;
+
+        hpx::util::format_to(std::cout, "{},{},{},{},{},{},{}", name,
+            num_cores, n, inner_delay, outer_delay, elapsed,
+            1e9 * elapsed / double(n * num_iterations))
+            << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("no-header") == 0)
+    {
+        std::cout << "mutex,num_cores,num_threads,inner_delay[ns],"
+                     "outer_delay[ns],time[s],time_per_lock[ns]"
+                  << std::endl;
+    }
+
+    run<hpx::mutex>("hpx::mutex");
+    run<hpx::spinlock>("hpx::spinlock");
+    run<std::mutex>("std::mutex");
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = hpx::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("num_iterations",
+            po::value<std::uint64_t>(&num_iterations)->default_value(100000),
+            "number of critical sections executed by each of the threads "
+            "(default: 100000)")
+        ("inner_delay",
+            po::value<std::uint64_t>(&inner_delay)->default_value(0),
+            "time to busy wait inside of the critical section [nanoseconds] "
+            "(default: no busy waiting)")
+        ("outer_delay",
+            po::value<std::uint64_t>(&outer_delay)->default_value(0),
+            "time to busy wait outside of the critical section [nanoseconds] "
+            "(default: no busy waiting)")
+        ("repetitions",
+            po::value<std::size_t>(&repetitions)->default_value(5),
+            "number of times to repeat each of the measurements (default: 5)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(&hpx_main, argc, argv, init_args);
+}
+#endif
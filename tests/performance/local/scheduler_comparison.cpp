@@ -0,0 +1,195 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the work stealing behavior of the available
+// schedulers. It runs two workloads for each of the schedulers:
+//
+//  - 'spawn': a single HPX thread creates all tasks, every other worker thread
+//    has to steal (or request) its work,
+//  - 'tree':  a fork/join tree of tasks (similar to the skynet benchmark)
+//    where work is created on all cores but gets distributed unevenly.
+//
+// Both workloads keep most of the worker threads idle for most of the time,
+// which stresses the stealing machinery of the schedulers.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/assert.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/threadmanager.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "worker_timed.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t num_tasks = 100000;
+std::uint64_t delay = 0;
+std::size_t repetitions = 5;
+
+///////////////////////////////////////////////////////////////////////////////
+void just_wait()
+{
+    worker_timed(delay * 1000);
+}
+
+double measure_spawn()
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(&just_wait));
+    }
+    hpx::wait_all(tasks);
+
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t tree(std::size_t size)
+{
+    if (size <= 1)
+    {
+        just_wait();
+        return 1;
+    }
+
+    hpx::future<std::size_t> left = hpx::async(&tree, size / 2);
+    std::size_t right = tree(size - size / 2);
+    return left.get() + right;
+}
+
+double measure_tree()
+{
+    hpx::chrono::high_resolution_timer t;
+
+    std::size_t result = tree(num_tasks);
+    HPX_ASSERT(result == num_tasks);
+    (void) result;
+
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string scheduler_name;
+bool header_printed = false;
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    double spawn_time = 0;
+    double tree_time = 0;
+
+    for (std::size_t i = 0; i != repetitions; ++i)
+    {
+        spawn_time += measure_spawn();
+        tree_time += measure_tree();
+    }
+
+    if (!header_printed && vm.count("no-header") == 0)
+    {
+        std::cout << "scheduler,num_cores,num_tasks,delay[us],spawn_time[s],"
+                     "tree_time[s]"
+                  << std::endl;
+    }
+    header_printed = true;
+
+    hpx::util::format_to(std::cout, "{},{},{},{},{},{}", scheduler_name,
+        hpx::get_os_thread_count(), num_tasks, delay, spawn_time / repetitions,
+        tree_time / repetitions)
+        << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int run_benchmark(int argc, char* argv[],
+    hpx::program_options::options_description const& cmdline,
+    hpx::resource::scheduling_policy scheduler, char const* name)
+{
+    scheduler_name = name;
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler);
+    };
+
+    return hpx::local::init(&hpx_main, argc, argv, init_args);
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = hpx::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("delay",
+            po::value<std::uint64_t>(&delay)->default_value(0),
+            "time to busy wait in delay loop [microseconds] "
+            "(default: no busy waiting)")
+        ("num_tasks",
+            po::value<std::size_t>(&num_tasks)->default_value(100000),
+            "number of tasks to create for each of the workloads "
+            "(default: 100000)")
+        ("repetitions",
+            po::value<std::size_t>(&repetitions)->default_value(5),
+            "number of times to repeat each of the workloads (default: 5)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    std::vector<std::pair<hpx::resource::scheduling_policy, char const*>>
+        schedulers = {
+            {hpx::resource::scheduling_policy::local, "local"},
+            {hpx::resource::scheduling_policy::local_priority_fifo,
+                "local-priority-fifo"},
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+            {hpx::resource::scheduling_policy::local_priority_lifo,
+                "local-priority-lifo"},
+            {hpx::resource::scheduling_policy::abp_priority_fifo,
+                "abp-priority-fifo"},
+            {hpx::resource::scheduling_policy::abp_priority_lifo,
+                "abp-priority-lifo"},
+#endif
+            {hpx::resource::scheduling_policy::shared_priority,
+                "shared-priority"},
+            {hpx::resource::scheduling_policy::local_workrequesting_fifo,
+                "local-workrequesting-fifo"},
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+            {hpx::resource::scheduling_policy::local_workrequesting_lifo,
+                "local-workrequesting-lifo"},
+#endif
+            {hpx::resource::scheduling_policy::deadline, "deadline"},
+            {hpx::resource::scheduling_policy::local_priority_chase_lev,
+                "local-priority-chase-lev"},
+        };
+
+    for (auto const& scheduler : schedulers)
+    {
+        int result = run_benchmark(
+            argc, argv, cmdline, scheduler.first, scheduler.second);
+        if (result != 0)
+            return result;
+    }
+    return 0;
+}
+#endif